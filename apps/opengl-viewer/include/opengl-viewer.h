@@ -28,17 +28,25 @@
 #include <GL/glew.h>
 #include <nfd.h>
 #endif
+#include <async-scene-loader.h>
+#include <bvh.h>
+#include <frustum-culler.h>
 #include <glfw-context.h>
 #include <glfw-window.h>
 #include <gltf-scene-importer.h>
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
+#include <meshlet-builder.h>
+#include <occlusion-culler.h>
+#include <occlusion-queries.h>
 #include <opengl-shader.h>
+#include <render-queue.h>
 #include <scene-uploader.h>
 #include <texture-manager.h>
 #include <usd-scene-importer.h>
 
+#include <array>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -63,7 +71,6 @@ enum class TextureSlot : int {
 struct PbrUniforms {
   GLint model{-1};
   GLint mvp{-1};
-  GLint matrix{-1};
   GLint lightPosition{-1};
   GLint cameraPosition{-1};
   GLint scaleIblAmbient{-1};
@@ -87,6 +94,8 @@ struct PbrUniforms {
   GLint roughnessFactor{-1};
   GLint alphaMaskSet{-1};
   GLint alphaMaskCutoff{-1};
+  GLint positionOffset{-1};
+  GLint positionScale{-1};
 
   void Cache(uint32_t programId) noexcept;
 };
@@ -96,6 +105,33 @@ struct ViewMatrices {
   glm::mat4 model{1.0f};
   glm::mat4 view{1.0f};
   glm::mat4 projection{1.0f};
+  // Pixels covered by one unit of view-space size at distance 1
+  float pixelScale{1.0f};
+};
+
+struct RenderStats {
+  uint32_t drawCalls{0};
+  uint32_t instanceBatches{0};
+  uint32_t instances{0};
+  uint32_t vaoBinds{0};
+  uint32_t textureBinds{0};
+  // Changes of the material uniforms between consecutive draws
+  uint32_t materialBinds{0};
+  uint32_t triangles{0};
+  // Primitives drawn with a simplified level
+  uint32_t lodDraws{0};
+  uint32_t meshletsCulled{0};
+  // Primitive draws tested against the view frustum
+  uint32_t primitivesVisible{0};
+  uint32_t primitivesCulled{0};
+  // Primitive draws hidden behind the software-rasterized occluders
+  uint32_t primitivesOccluded{0};
+  uint32_t occluders{0};
+  uint32_t occluderTriangles{0};
+  // Primitive draws skipped because their last occlusion query failed
+  uint32_t primitivesQueryHidden{0};
+  // Draw calls a renderer without instancing would issue for the same frame
+  uint32_t drawCallsWithoutInstancing{0};
 };
 
 struct TransformVectors {
@@ -124,6 +160,17 @@ class OpenGlViewer {
   void LoadDefaultScene();
   void LoadDefaultIbl();
 
+  // Batches with more instances skip meshlet culling, whose per-instance
+  // tests would cost more than the triangles they save
+  static constexpr uint32_t kMeshletCullMaxInstances = 4;
+  static constexpr float kNearPlane = 0.1f;
+  static constexpr float kFarPlane = 1000.0f;
+  // Primitive instances covering less of the screen are not occluders
+  static constexpr float kOccluderMinCoverage = 0.02f;
+  static constexpr size_t kOccluderTriangleBudget = 32768;
+  // The scene cache lives in the temp directory, so keep it bounded
+  static constexpr uint64_t kSceneCacheSizeLimit = uint64_t{1} << 30;
+
   // Per-frame pipeline
   void RenderFrame();
   void UpdateMatrices();
@@ -132,18 +179,26 @@ class OpenGlViewer {
   void RenderUi();
   void EndFrame();
 
-  // Scene traversal
-  void TraverseNode(const std::shared_ptr<Mgtt::Rendering::Node>& node) const;
-  void RenderMesh(const std::shared_ptr<Mgtt::Rendering::Node>& node) const;
-  void BindMeshTextures(const Mgtt::Rendering::PbrMaterial& mat) const;
+  // Scene drawing
+  void UpdateCullBounds();
+  void RasterizeOccluders();
+  void QueueInstanceBatch(const Mgtt::Rendering::InstanceBatch& batch,
+                          size_t batchIndex);
+  void SubmitRenderQueue();
+  [[nodiscard]] float LodErrorScale(
+      const Mgtt::Rendering::InstanceBatch& batch) const;
+  void BindMeshTextures(const Mgtt::Rendering::PbrMaterial& mat);
 
   // ImGui panels
   void PanelScene();
   void PanelTransform();
   void PanelLight();
+  void PanelStats();
 
   // Helpers
+  void PickPrimitive();
   void ReloadScene(std::string_view path);
+  void SwapLoadedScene();
   static void FramebufferSizeCallback(GLFWwindow*, int32_t w, int32_t h);
 
   // Platform constants
@@ -155,6 +210,8 @@ class OpenGlViewer {
     static std::pair<std::string_view, std::string_view>
     BrdfLutPaths() noexcept;
     static std::pair<std::string_view, std::string_view> EnvMapPaths() noexcept;
+    static std::pair<std::string_view, std::string_view>
+    BoundsShaderPaths() noexcept;
     static const char* ImGuiGlslVersion() noexcept;
   };
 
@@ -165,6 +222,8 @@ class OpenGlViewer {
   std::unique_ptr<Mgtt::Rendering::UsdSceneImporter> usdSceneImporter_;
   std::unique_ptr<Mgtt::Rendering::SceneUploader> sceneUploader_;
   std::unique_ptr<Mgtt::Rendering::TextureManager> textureManager_;
+  // Declared after the importers, which its worker thread uses
+  std::unique_ptr<Mgtt::Rendering::AsyncSceneLoader> sceneLoader_;
 
   Mgtt::Rendering::Scene scene_;
   Mgtt::Rendering::RenderTexturesContainer ibl_;
@@ -172,9 +231,38 @@ class OpenGlViewer {
   PbrUniforms uniforms_{};
   ViewMatrices matrices_{};
   TransformVectors transform_{};
+  RenderStats stats_{};
+  // Skips redundant binds while submitting the sorted draws
+  uint32_t boundVao_{0};
+  std::array<uint32_t, 5> boundTextures_{};
+  Mgtt::Rendering::RenderQueue renderQueue_;
+  // Set when batches or texture ids change; material ids are reassigned
+  bool stateIdsDirty_{true};
+  Mgtt::Rendering::FrustumCuller frustumCuller_;
+  // World-space bounds of every primitive instance, for culling and picking
+  Mgtt::Rendering::Bvh sceneBvh_;
+  Mgtt::Rendering::OcclusionCuller occlusionCuller_;
+  Mgtt::Rendering::OcclusionQueries occlusionQueries_;
+  // Set when the batches change; the hierarchy is rebuilt
+  bool cullBoundsDirty_{true};
+  // Set when only instance matrices change; the hierarchy is refitted
+  bool cullBoundsMoved_{false};
+  // Mesh and primitive name under the last click
+  std::string pickedName_;
+  // Spent on uploading a newly loaded scene each frame
+  Mgtt::Rendering::UploadBudget uploadBudget_{size_t{16} << 20,
+                                              std::chrono::microseconds(4000)};
 
   glm::vec3 cameraPos_{0.0f, 0.0f, -3.0f};
   float scaleIblAmbient_{1.0f};
+  // Largest on-screen deviation accepted when picking a mesh LOD
+  float lodPixelError_{1.0f};
+  bool meshletCulling_{true};
+  bool frustumCulling_{true};
+  bool bvhCulling_{true};
+  bool occlusionCulling_{true};
+  // Draws hidden in the previous frames' queries, results arrive late
+  bool queryCulling_{false};
   bool showEnvMap_{false};
   float windowW_{1000.0f};
   float windowH_{1000.0f};
@@ -23,9 +23,14 @@
 #ifdef MGTT_OPENGL_VIEWER
 #include <opengl-viewer.h>
 
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <filesystem>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten/emscripten.h>
@@ -41,7 +46,6 @@ void PbrUniforms::Cache(uint32_t id) noexcept {
   auto loc = [id](const char* n) { return glGetUniformLocation(id, n); };
   model = loc("model");
   mvp = loc("mvp");
-  matrix = loc("matrix");
   lightPosition = loc("lightPosition");
   cameraPosition = loc("cameraPosition");
   scaleIblAmbient = loc("scaleIblAmbient");
@@ -65,15 +69,17 @@ void PbrUniforms::Cache(uint32_t id) noexcept {
   roughnessFactor = loc("roughnessFactor");
   alphaMaskSet = loc("alphaMaskSet");
   alphaMaskCutoff = loc("alphaMaskCutoff");
+  positionOffset = loc("positionOffset");
+  positionScale = loc("positionScale");
 }
 
 // Platform constants
 std::pair<std::string_view, std::string_view>
 OpenGlViewer::Platform::PbrShaderPaths() noexcept {
 #ifdef __EMSCRIPTEN__
-  return {"assets/shader/es/pbr.vert", "assets/shader/es/pbr.frag"};
+  return {"assets/shader/es/pbr-packed.vert", "assets/shader/es/pbr.frag"};
 #else
-  return {"assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  return {"assets/shader/core/pbr-packed.vert", "assets/shader/core/pbr.frag"};
 #endif
 }
 
@@ -106,6 +112,15 @@ OpenGlViewer::Platform::EnvMapPaths() noexcept {
 #endif
 }
 
+std::pair<std::string_view, std::string_view>
+OpenGlViewer::Platform::BoundsShaderPaths() noexcept {
+#ifdef __EMSCRIPTEN__
+  return {"assets/shader/es/bounds.vert", "assets/shader/es/bounds.frag"};
+#else
+  return {"assets/shader/core/bounds.vert", "assets/shader/core/bounds.frag"};
+#endif
+}
+
 const char* OpenGlViewer::Platform::ImGuiGlslVersion() noexcept {
 #ifdef __EMSCRIPTEN__
   return "#version 300 es";
@@ -120,7 +135,37 @@ OpenGlViewer::OpenGlViewer()
           std::make_unique<Mgtt::Rendering::GltfSceneImporter>()),
       sceneUploader_(std::make_unique<Mgtt::Rendering::SceneUploader>()),
       textureManager_(std::make_unique<Mgtt::Rendering::TextureManager>()),
-      usdSceneImporter_(std::make_unique<Mgtt::Rendering::UsdSceneImporter>()) {
+      usdSceneImporter_(std::make_unique<Mgtt::Rendering::UsdSceneImporter>()),
+      sceneLoader_(std::make_unique<Mgtt::Rendering::AsyncSceneLoader>()) {
+  gltfSceneImporter_->SetTextureDecodeThreadCount(
+      std::max(1u, std::thread::hardware_concurrency()));
+  gltfSceneImporter_->SetMemoryMappedGlb(true);
+  gltfSceneImporter_->SetTangentGeneration(
+      true, std::max(1u, std::thread::hardware_concurrency()));
+  usdSceneImporter_->SetTangentGeneration(
+      true, std::max(1u, std::thread::hardware_concurrency()));
+  gltfSceneImporter_->SetVertexWelding(true);
+  usdSceneImporter_->SetVertexWelding(true);
+  gltfSceneImporter_->SetMeshOptimization(true);
+  usdSceneImporter_->SetMeshOptimization(true);
+  gltfSceneImporter_->SetLodGeneration(true);
+  usdSceneImporter_->SetLodGeneration(true);
+  gltfSceneImporter_->SetMeshletGeneration(true);
+  usdSceneImporter_->SetMeshletGeneration(true);
+  occlusionCuller_.SetThreadCount(
+      std::max(1u, std::thread::hardware_concurrency()));
+  sceneUploader_->SetSharedBuffers(true);
+  sceneUploader_->SetPackedVertices(true);
+#ifndef __EMSCRIPTEN__
+  std::error_code tmpError;
+  const auto kTmpDir = std::filesystem::temp_directory_path(tmpError);
+  if (!tmpError) {
+    const std::string kCacheDir = (kTmpDir / "mgtt-scene-cache").string();
+    gltfSceneImporter_->SetCacheDirectory(kCacheDir, kSceneCacheSizeLimit);
+    usdSceneImporter_->SetCacheDirectory(kCacheDir, kSceneCacheSizeLimit);
+  }
+#endif
+
   glfwContext_ = std::make_unique<Mgtt::Window::GlfwContext>();
   window_ = std::make_unique<Mgtt::Window::GlfwWindow>("opengl-viewer",
                                                        windowW_, windowH_);
@@ -138,8 +183,11 @@ OpenGlViewer::OpenGlViewer()
 }
 
 OpenGlViewer::~OpenGlViewer() {
+  // Stops a running load while the GL context still exists
+  sceneLoader_.reset();
   gltfSceneImporter_->Clear(scene_);
   textureManager_->Clear(ibl_);
+  occlusionQueries_.Clear();
   ImGui_ImplOpenGL3_Shutdown();
   ImGui_ImplGlfw_Shutdown();
   ImGui::DestroyContext();
@@ -158,6 +206,10 @@ void OpenGlViewer::InitGl() {
     throw std::runtime_error("PBR shader: " + r.error());
   }
   uniforms_.Cache(scene_.shader.GetProgramId());
+  if (auto r = occlusionQueries_.Init(Platform::BoundsShaderPaths());
+      r.err()) {
+    throw std::runtime_error("Bounds shader: " + r.error());
+  }
 
   ibl_ = Mgtt::Rendering::RenderTexturesContainer(Platform::Eq2CubeMapPaths(),
                                                   Platform::BrdfLutPaths(),
@@ -203,6 +255,7 @@ void OpenGlViewer::LoadDefaultScene() {
   if (auto r = sceneUploader_->Upload(scene_); r.err()) {
     std::cerr << "Upload failed: " << r.error() << '\n';
   }
+  cullBoundsDirty_ = true;
 }
 
 void OpenGlViewer::LoadDefaultIbl() {
@@ -237,11 +290,25 @@ void OpenGlViewer::RenderFrame() {
   glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+  SwapLoadedScene();
+  if (sceneUploader_->IsUploading()) {
+    if (auto r = sceneUploader_->UploadStep(scene_, uploadBudget_); r.err()) {
+      std::cerr << "Upload failed: " << r.error() << '\n';
+    }
+    stateIdsDirty_ = true;
+  }
+  // Only nodes whose transform changed since the last frame are touched
+  if (!sceneUploader_->IsUploading() &&
+      scene_.transforms.Update(scene_.nodes) > 0) {
+    sceneUploader_->UpdateInstanceMatrices(scene_);
+    cullBoundsMoved_ = true;
+  }
   UpdateMatrices();
 
   ImGui_ImplOpenGL3_NewFrame();
   ImGui_ImplGlfw_NewFrame();
   ImGui::NewFrame();
+  PickPrimitive();
 
   auto [scrW, scrH] = window_->GetWindowSize();
   ImGui::SetNextWindowSize(
@@ -260,8 +327,10 @@ void OpenGlViewer::UpdateMatrices() {
 
   matrices_.view = glm::translate(glm::mat4(1.0f), cameraPos_);
   matrices_.projection = glm::perspective(
-      glm::radians(45.0f), static_cast<float>(w) / static_cast<float>(h), 0.1f,
-      1000.0f);
+      glm::radians(45.0f), static_cast<float>(w) / static_cast<float>(h),
+      kNearPlane, kFarPlane);
+  matrices_.pixelScale =
+      matrices_.projection[1][1] * static_cast<float>(h) * 0.5f;
 
   const glm::vec3 kOffset = -scene_.aabb.center + transform_.translation;
 
@@ -306,9 +375,58 @@ void OpenGlViewer::RenderScene() {
   glActiveTexture(GL_TEXTURE0 + static_cast<int>(TextureSlot::BrdfLut));
   glBindTexture(GL_TEXTURE_2D, ibl_.brdfLutTextureId);
 
-  for (const auto& node : scene_.nodes) {
-    TraverseNode(node);
+  // Material texture units and the alpha mask are the same for every draw
+  glUniform1i(uniforms_.baseColorMap,
+              static_cast<int>(TextureSlot::BaseColor));
+  glUniform1i(uniforms_.physicalDescriptorMap,
+              static_cast<int>(TextureSlot::MetallicRoughness));
+  glUniform1i(uniforms_.normalMap, static_cast<int>(TextureSlot::Normal));
+  glUniform1i(uniforms_.emissiveMap, static_cast<int>(TextureSlot::Emissive));
+  glUniform1i(uniforms_.occlusionMap,
+              static_cast<int>(TextureSlot::Occlusion));
+  glUniform1i(uniforms_.alphaMaskSet, 1);
+
+  stats_ = {};
+  boundVao_ = 0;
+  UpdateCullBounds();
+  if (stateIdsDirty_) {
+    renderQueue_.AssignStateIds(scene_.instanceBatches);
+    stateIdsDirty_ = false;
+  }
+  if (frustumCulling_) {
+    // mvp maps the space of the instance matrices to clip space
+    const auto kPlanes = Mgtt::Rendering::ExtractFrustumPlanes(scene_.mvp);
+    auto cullStats = bvhCulling_ ? frustumCuller_.Cull(kPlanes, sceneBvh_)
+                                 : frustumCuller_.Cull(kPlanes);
+    if (occlusionCulling_) {
+      RasterizeOccluders();
+      cullStats = frustumCuller_.CullOccluded(occlusionCuller_);
+    }
+    stats_.primitivesVisible = cullStats.visible;
+    stats_.primitivesCulled = cullStats.culled;
+    stats_.primitivesOccluded = cullStats.occluded;
+  } else {
+    stats_.primitivesVisible = static_cast<uint32_t>(frustumCuller_.Size());
+  }
+  if (queryCulling_) {
+    occlusionQueries_.BeginFrame();
+  }
+  renderQueue_.BeginFrame();
+  for (size_t idx = 0; idx < scene_.instanceBatches.size(); ++idx) {
+    if (frustumCulling_ && !frustumCuller_.IsBatchVisible(idx)) {
+      continue;
+    }
+    QueueInstanceBatch(scene_.instanceBatches[idx], idx);
   }
+  renderQueue_.Sort();
+  SubmitRenderQueue();
+  if (queryCulling_) {
+    // Tested against this frame's depth, used from the next frame on
+    occlusionQueries_.IssueQueries(scene_.mvp, frustumCuller_);
+  }
+  glDisable(GL_CULL_FACE);
+  glBindVertexArray(0);
+  boundVao_ = 0;
 }
 
 void OpenGlViewer::RenderEnvMap() {
@@ -344,6 +462,7 @@ void OpenGlViewer::RenderUi() {
     PanelScene();
     PanelTransform();
     PanelLight();
+    PanelStats();
     ImGui::EndTabBar();
   }
   ImGui::End();
@@ -355,72 +474,326 @@ void OpenGlViewer::EndFrame() {
   window_->SwapBuffersAndPollEvents();
 }
 
-// Scene traversal
-void OpenGlViewer::TraverseNode(
-    const std::shared_ptr<Mgtt::Rendering::Node>& node) const {
-  RenderMesh(node);
-  for (const auto& child : node->children) {
-    TraverseNode(child);
+// Scene drawing
+void OpenGlViewer::UpdateCullBounds() {
+  if (!cullBoundsDirty_ && !cullBoundsMoved_) {
+    return;
+  }
+  frustumCuller_.Build(scene_.instanceBatches);
+  if (cullBoundsDirty_) {
+    occlusionQueries_.Reset(frustumCuller_.Size());
+    stateIdsDirty_ = true;
+  }
+  auto items = Mgtt::Rendering::CollectBvhItems(scene_.instanceBatches);
+  // Moved instances keep the tree and only update its bounds
+  if (cullBoundsDirty_ || sceneBvh_.Refit(items).err()) {
+    sceneBvh_.Build(std::move(items),
+                    std::max(1u, std::thread::hardware_concurrency()));
+  }
+  cullBoundsDirty_ = false;
+  cullBoundsMoved_ = false;
+}
+
+void OpenGlViewer::RasterizeOccluders() {
+  occlusionCuller_.BeginFrame(scene_.mvp);
+  // Occluders may use any level whose error stays under one buffer pixel
+  auto [w, h] = window_->GetWindowSize();
+  const float kMaxLodError =
+      static_cast<float>(h) / static_cast<float>(occlusionCuller_.GetHeight());
+  std::vector<float> lodErrorScales(scene_.instanceBatches.size(), -1.0f);
+  size_t triangleBudget = kOccluderTriangleBudget;
+  for (size_t idx = 0; idx < sceneBvh_.Size(); ++idx) {
+    const auto& item = sceneBvh_.GetItem(idx);
+    const auto& batch = scene_.instanceBatches[item.batch];
+    const size_t kDraw = frustumCuller_.GetFirstDraw(item.batch) +
+                         item.primitive;
+    if (batch.mesh == nullptr || !frustumCuller_.IsVisible(kDraw) ||
+        occlusionCuller_.GetScreenCoverage(item.bounds) <
+            kOccluderMinCoverage) {
+      continue;
+    }
+    if (lodErrorScales[item.batch] < 0.0f) {
+      lodErrorScales[item.batch] = LodErrorScale(batch);
+    }
+
+    const auto& prim = batch.mesh->meshPrimitives[item.primitive];
+    uint32_t firstIndex = prim.firstIndex;
+    uint32_t indexCount = prim.indexCount;
+    for (const auto& lod : prim.lods) {
+      if (lod.error * lodErrorScales[item.batch] > kMaxLodError) {
+        break;
+      }
+      firstIndex = lod.firstIndex;
+      indexCount = lod.indexCount;
+    }
+    if (indexCount / 3 > triangleBudget) {
+      continue;
+    }
+    triangleBudget -= indexCount / 3;
+    occlusionCuller_.AddOccluder(*batch.mesh, firstIndex, indexCount,
+                                 batch.instanceMatrices[item.instance]);
   }
+  stats_.occluderTriangles =
+      static_cast<uint32_t>(occlusionCuller_.Rasterize());
+  stats_.occluders =
+      static_cast<uint32_t>(occlusionCuller_.GetOccluderCount());
 }
 
-void OpenGlViewer::RenderMesh(
-    const std::shared_ptr<Mgtt::Rendering::Node>& node) const {
-  if (node->mesh == nullptr) {
+void OpenGlViewer::QueueInstanceBatch(
+    const Mgtt::Rendering::InstanceBatch& batch, size_t batchIndex) {
+  const auto kInstanceCount =
+      static_cast<uint32_t>(batch.instanceMatrices.size());
+  // Batches of a scene that is still being uploaded have no vao yet
+  if (batch.mesh == nullptr || batch.mesh->vao == 0 || kInstanceCount == 0) {
     return;
   }
+  ++stats_.instanceBatches;
+  stats_.instances += kInstanceCount;
+  const float kLodErrorScale = LodErrorScale(batch);
+
+  // Meshlet bounds are in mesh space, so each instance gets its own planes
+  // and viewer position; a meshlet is drawn if any instance may see it
+  const bool kCullMeshlets =
+      meshletCulling_ && kInstanceCount <= kMeshletCullMaxInstances;
+  std::array<Mgtt::Rendering::FrustumPlanes, kMeshletCullMaxInstances>
+      instancePlanes;
+  std::array<glm::vec3, kMeshletCullMaxInstances> instanceViewers;
+  if (kCullMeshlets) {
+    for (uint32_t instance = 0; instance < kInstanceCount; ++instance) {
+      const glm::mat4 kModelView = matrices_.view * matrices_.model *
+                                   batch.instanceMatrices[instance];
+      instancePlanes[instance] = Mgtt::Rendering::ExtractFrustumPlanes(
+          matrices_.projection * kModelView);
+      instanceViewers[instance] = glm::vec3(glm::inverse(kModelView) *
+                                            glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    }
+  }
 
-  glUniformMatrix4fv(uniforms_.matrix, 1, GL_FALSE, &node->mesh->matrix[0][0]);
+  const auto& prims = batch.mesh->meshPrimitives;
+  size_t draw = frustumCuller_.GetFirstDraw(batchIndex);
+  for (uint32_t primIdx = 0; primIdx < prims.size(); ++primIdx, ++draw) {
+    const auto& prim = prims[primIdx];
+    if (frustumCulling_ && !frustumCuller_.IsVisible(draw)) {
+      continue;
+    }
+    if (queryCulling_ && !occlusionQueries_.IsVisible(draw)) {
+      ++stats_.primitivesQueryHidden;
+      continue;
+    }
+
+    // Coarsest level whose error stays under the pixel threshold
+    uint32_t firstIndex = prim.firstIndex;
+    uint32_t indexCount = prim.indexCount;
+    for (const auto& lod : prim.lods) {
+      if (lod.error * kLodErrorScale > lodPixelError_) {
+        break;
+      }
+      firstIndex = lod.firstIndex;
+      indexCount = lod.indexCount;
+    }
+    if (firstIndex != prim.firstIndex) {
+      ++stats_.lodDraws;
+    }
+
+    if (!kCullMeshlets || firstIndex != prim.firstIndex ||
+        prim.meshlets.size() < 2) {
+      renderQueue_.AddRange(firstIndex, indexCount);
+    } else {
+      // Consecutive visible meshlets are merged into one range
+      const bool kSingleSided = !prim.pbrMaterial.doubleSided;
+      uint32_t runFirst = 0;
+      uint32_t runCount = 0;
+      for (const auto& meshlet : prim.meshlets) {
+        bool visible = false;
+        for (uint32_t instance = 0; !visible && instance < kInstanceCount;
+             ++instance) {
+          visible = Mgtt::Rendering::IsMeshletVisible(
+              meshlet, instancePlanes[instance], instanceViewers[instance],
+              kSingleSided);
+        }
+        if (!visible) {
+          ++stats_.meshletsCulled;
+          if (runCount > 0) {
+            renderQueue_.AddRange(runFirst, runCount);
+            runCount = 0;
+          }
+          continue;
+        }
+        if (runCount == 0) {
+          runFirst = meshlet.firstIndex;
+        }
+        runCount += meshlet.indexCount;
+      }
+      if (runCount > 0) {
+        renderQueue_.AddRange(runFirst, runCount);
+      }
+    }
+
+    // Distance of the draw bounds orders draws that share all state
+    float depth = 1.0f;
+    const auto kBounds = frustumCuller_.GetBounds(draw);
+    if (kBounds.min.x != -FLT_MAX) {
+      const glm::vec4 kClip =
+          scene_.mvp * glm::vec4((kBounds.min + kBounds.max) * 0.5f, 1.0f);
+      depth = (kClip.w - kNearPlane) / (kFarPlane - kNearPlane);
+    }
+    renderQueue_.Push(
+        Mgtt::Rendering::RenderQueue::MakeKey(
+            Mgtt::Rendering::RenderQueue::GetPass(prim.pbrMaterial), 0,
+            renderQueue_.GetMaterialId(batchIndex, primIdx),
+            renderQueue_.GetTextureSetId(batchIndex, primIdx),
+            batch.mesh->vao, depth),
+        static_cast<uint32_t>(batchIndex), primIdx);
+  }
+}
+
+void OpenGlViewer::SubmitRenderQueue() {
+  const auto& geometry = scene_.sharedGeometry;
+  const Mgtt::Rendering::InstanceBatch* boundBatch = nullptr;
+  uint32_t boundMaterial = UINT32_MAX;
+  boundTextures_.fill(UINT32_MAX);
+
+  for (const auto& item : renderQueue_.GetItems()) {
+    const auto& batch = scene_.instanceBatches[item.batch];
+    const auto& mesh = *batch.mesh;
+    const auto& prim = mesh.meshPrimitives[item.primitive];
+    const auto kInstanceCount =
+        static_cast<uint32_t>(batch.instanceMatrices.size());
+
+    if (mesh.vao != boundVao_) {
+      glBindVertexArray(mesh.vao);
+      boundVao_ = mesh.vao;
+      ++stats_.vaoBinds;
+    }
+    if (&batch != boundBatch) {
+      boundBatch = &batch;
+      if (mesh.sharedBuffers && geometry.instanceLocation >= 0) {
+        // Point the per-instance attribute at this batch's range
+        glBindBuffer(GL_ARRAY_BUFFER, geometry.instanceVbo);
+        for (uint32_t column = 0; column < 4; ++column) {
+          glVertexAttribPointer(
+              static_cast<uint32_t>(geometry.instanceLocation) + column, 4,
+              GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+              // NOLINTNEXTLINE(performance-no-int-to-ptr)
+              reinterpret_cast<const void*>(batch.firstInstance *
+                                                sizeof(glm::mat4) +
+                                            column * sizeof(glm::vec4)));
+        }
+      }
+
+      // Quantized positions are dequantized in the vertex shader
+      const glm::vec3 kPositionOffset =
+          mesh.packedVertices ? mesh.positionOffset : glm::vec3(0.0f);
+      const glm::vec3 kPositionScale =
+          mesh.packedVertices ? mesh.positionScale : glm::vec3(1.0f);
+      glUniform3fv(uniforms_.positionOffset, 1, &kPositionOffset[0]);
+      glUniform3fv(uniforms_.positionScale, 1, &kPositionScale[0]);
+    }
 
-  for (const auto& prim : node->mesh->meshPrimitives) {
     BindMeshTextures(prim.pbrMaterial);
+    const uint32_t kMaterial =
+        renderQueue_.GetMaterialId(item.batch, item.primitive);
+    if (kMaterial != boundMaterial) {
+      boundMaterial = kMaterial;
+      ++stats_.materialBinds;
+      const auto& mat = prim.pbrMaterial;
+      glUniform4fv(uniforms_.baseColorFactor, 1,
+                   &mat.baseColorTexture.color[0]);
+      glUniform3fv(uniforms_.emissiveFactor, 1,
+                   &mat.emissiveTexture.color[0]);
+      glUniform1f(uniforms_.occlusionFactor, mat.occlusionTexture.strength);
+      glUniform1f(uniforms_.metallicFactor,
+                  mat.metallicRoughnessTexture.metallicFactor);
+      glUniform1f(uniforms_.roughnessFactor,
+                  mat.metallicRoughnessTexture.roughnessFactor);
+      glUniform1f(uniforms_.alphaMaskCutoff, mat.alphaCutoff);
+      if (mat.doubleSided) {
+        glDisable(GL_CULL_FACE);
+      } else {
+        glEnable(GL_CULL_FACE);
+      }
+    }
+
+    const GLenum kIndexType = Mgtt::Rendering::GetIndexGlType(mesh.indexType);
+    const size_t kIndexSize = Mgtt::Rendering::GetIndexSize(mesh.indexType);
+    for (uint32_t range = 0; range < item.rangeCount; ++range) {
+      const auto& indexRange = renderQueue_.GetRange(item.firstRange + range);
+      // NOLINTNEXTLINE(performance-no-int-to-ptr)
+      const auto* kIndexOffset = reinterpret_cast<const void*>(
+          (mesh.baseIndex + indexRange.firstIndex) * kIndexSize);
+#ifdef __EMSCRIPTEN__
+      // Shared-buffer indices are rebased at upload, baseVertex is always 0
+      glDrawElementsInstanced(
+          GL_TRIANGLES, static_cast<GLsizei>(indexRange.indexCount),
+          kIndexType, kIndexOffset, static_cast<GLsizei>(kInstanceCount));
+#else
+      glDrawElementsInstancedBaseVertex(
+          GL_TRIANGLES, static_cast<GLsizei>(indexRange.indexCount),
+          kIndexType, kIndexOffset, static_cast<GLsizei>(kInstanceCount),
+          mesh.baseVertex);
+#endif
+
+      ++stats_.drawCalls;
+      stats_.drawCallsWithoutInstancing += kInstanceCount;
+      stats_.triangles += indexRange.indexCount / 3 * kInstanceCount;
+    }
+  }
+}
+
+float OpenGlViewer::LodErrorScale(
+    const Mgtt::Rendering::InstanceBatch& batch) const {
+  const auto& aabb = batch.mesh->aabb;
+  if (!(aabb.min.x <= aabb.max.x)) {
+    // No bounds, so no distance: always draw full detail
+    return FLT_MAX;
+  }
+  const glm::vec4 kCenter((aabb.min + aabb.max) * 0.5f, 1.0f);
+  const float kRadius = glm::length(aabb.max - aabb.min) * 0.5f;
+  const glm::mat4 kViewModel = matrices_.view * matrices_.model;
+
+  // The instance nearest to the camera decides for the whole batch
+  float scale = 0.0f;
+  for (const auto& instance : batch.instanceMatrices) {
+    const glm::mat4 kModelView = kViewModel * instance;
+    const float kMaxScale =
+        std::max({glm::length(glm::vec3(kModelView[0])),
+                  glm::length(glm::vec3(kModelView[1])),
+                  glm::length(glm::vec3(kModelView[2]))});
+    const float kDistance = glm::length(glm::vec3(kModelView * kCenter));
+    scale = std::max(
+        scale, kMaxScale / std::max(kDistance - kRadius * kMaxScale, 0.1f));
+  }
+  return scale * matrices_.pixelScale;
+}
 
-    glUniform4fv(uniforms_.baseColorFactor, 1,
-                 &prim.pbrMaterial.baseColorTexture.color[0]);
-    glUniform3fv(uniforms_.emissiveFactor, 1,
-                 &prim.pbrMaterial.emissiveTexture.color[0]);
-    glUniform1f(uniforms_.occlusionFactor,
-                prim.pbrMaterial.occlusionTexture.strength);
-    glUniform1f(uniforms_.metallicFactor,
-                prim.pbrMaterial.metallicRoughnessTexture.metallicFactor);
-    glUniform1f(uniforms_.roughnessFactor,
-                prim.pbrMaterial.metallicRoughnessTexture.roughnessFactor);
-    glUniform1i(uniforms_.alphaMaskSet, 1);
-    glUniform1f(uniforms_.alphaMaskCutoff, prim.pbrMaterial.alphaCutoff);
-
-    glBindVertexArray(node->mesh->vao);
-    glDrawElements(
-        GL_TRIANGLES, static_cast<GLsizei>(prim.indexCount), GL_UNSIGNED_INT,
-        // NOLINTNEXTLINE(performance-no-int-to-ptr)
-        reinterpret_cast<const void*>(prim.firstIndex * sizeof(uint32_t)));
-    glBindVertexArray(0);
-  }
-}
-
-void OpenGlViewer::BindMeshTextures(
-    const Mgtt::Rendering::PbrMaterial& mat) const {
-  auto bind = [&](uint32_t texId, TextureSlot slot, GLint flagLoc,
-                  GLint samplerLoc) {
-    const bool kHas = texId > 0;
-    glUniform1i(flagLoc, kHas ? 1 : 0);
-    if (!kHas) {
+void OpenGlViewer::BindMeshTextures(const Mgtt::Rendering::PbrMaterial& mat) {
+  auto bind = [&](uint32_t texId, TextureSlot slot, GLint flagLoc) {
+    auto& boundId = boundTextures_[static_cast<size_t>(slot)];
+    if (texId == boundId) {
+      return;
+    }
+    // The flag only changes between having and lacking a texture
+    if (boundId == UINT32_MAX || (boundId > 0) != (texId > 0)) {
+      glUniform1i(flagLoc, texId > 0 ? 1 : 0);
+    }
+    boundId = texId;
+    if (texId == 0) {
       return;
     }
-    glUniform1i(samplerLoc, static_cast<int>(slot));
     glActiveTexture(GL_TEXTURE0 + static_cast<int>(slot));
     glBindTexture(GL_TEXTURE_2D, texId);
+    ++stats_.textureBinds;
   };
 
   bind(mat.baseColorTexture.id, TextureSlot::BaseColor,
-       uniforms_.baseColorTextureSet, uniforms_.baseColorMap);
+       uniforms_.baseColorTextureSet);
   bind(mat.metallicRoughnessTexture.id, TextureSlot::MetallicRoughness,
-       uniforms_.physicalDescriptorTextureSet, uniforms_.physicalDescriptorMap);
-  bind(mat.normalTexture.id, TextureSlot::Normal, uniforms_.normalTextureSet,
-       uniforms_.normalMap);
+       uniforms_.physicalDescriptorTextureSet);
+  bind(mat.normalTexture.id, TextureSlot::Normal, uniforms_.normalTextureSet);
   bind(mat.emissiveTexture.id, TextureSlot::Emissive,
-       uniforms_.emissiveTextureSet, uniforms_.emissiveMap);
+       uniforms_.emissiveTextureSet);
   bind(mat.occlusionTexture.id, TextureSlot::Occlusion,
-       uniforms_.occlusionTextureSet, uniforms_.occlusionMap);
+       uniforms_.occlusionTextureSet);
 }
 
 // ImGui panels
@@ -445,6 +818,14 @@ void OpenGlViewer::PanelScene() {
     NFD_Quit();
   }
 #endif
+  if (sceneLoader_->IsLoading()) {
+    ImGui::Dummy(ImVec2(0, 5));
+    ImGui::Text("Loading %s", sceneLoader_->GetPath().c_str());
+    ImGui::ProgressBar(sceneLoader_->GetProgress());
+    if (ImGui::Button("Cancel")) {
+      sceneLoader_->Cancel();
+    }
+  }
   ImGui::EndTabItem();
 }
 
@@ -475,15 +856,94 @@ void OpenGlViewer::PanelLight() {
   ImGui::EndTabItem();
 }
 
+void OpenGlViewer::PanelStats() {
+  if (!ImGui::BeginTabItem("Stats")) {
+    return;
+  }
+  ImGui::Text("Draw calls: %u", stats_.drawCalls);
+  ImGui::Text("Draw calls without instancing: %u",
+              stats_.drawCallsWithoutInstancing);
+  ImGui::Dummy(ImVec2(0, 5));
+  ImGui::Text("Instance batches: %u", stats_.instanceBatches);
+  ImGui::Text("Instances: %u", stats_.instances);
+  ImGui::Text("VAO binds: %u", stats_.vaoBinds);
+  ImGui::Text("Texture binds: %u", stats_.textureBinds);
+  ImGui::Text("Material changes: %u (%u materials)", stats_.materialBinds,
+              renderQueue_.GetMaterialCount());
+  ImGui::Text("Triangles: %u", stats_.triangles);
+  ImGui::Text("LOD draws: %u", stats_.lodDraws);
+  ImGui::Text("Meshlets culled: %u", stats_.meshletsCulled);
+  ImGui::Text("Primitives visible: %u", stats_.primitivesVisible);
+  ImGui::Text("Primitives culled: %u", stats_.primitivesCulled);
+  ImGui::Text("Primitives occluded: %u", stats_.primitivesOccluded);
+  ImGui::Text("Occluders: %u (%u triangles)", stats_.occluders,
+              stats_.occluderTriangles);
+  ImGui::SliderFloat("LOD pixel error", &lodPixelError_, 0.0f, 8.0f);
+  ImGui::Checkbox("Meshlet culling", &meshletCulling_);
+  ImGui::Checkbox("Frustum culling", &frustumCulling_);
+  ImGui::Checkbox("Walk BVH when culling", &bvhCulling_);
+  ImGui::Checkbox("Occlusion culling", &occlusionCulling_);
+  ImGui::Checkbox("Occlusion queries", &queryCulling_);
+  if (queryCulling_) {
+    const auto& kQueryStats = occlusionQueries_.GetStats();
+    ImGui::Text("Primitives hidden by queries: %u",
+                stats_.primitivesQueryHidden);
+    ImGui::Text("Queries issued: %u, read: %u, pending: %u",
+                kQueryStats.issued, kQueryStats.read, kQueryStats.pending);
+    ImGui::Text("Query latency: %.1f frames (max %u)",
+                kQueryStats.averageLatency, kQueryStats.maxLatency);
+  }
+  ImGui::Text("BVH nodes: %zu", sceneBvh_.GetNodes().size());
+  ImGui::Text("Picked: %s",
+              pickedName_.empty() ? "nothing" : pickedName_.c_str());
+  if (sceneUploader_->IsUploading()) {
+    ImGui::Dummy(ImVec2(0, 5));
+    ImGui::Text("Pending upload: %zu KiB",
+                sceneUploader_->GetPendingBytes() / 1024);
+  }
+  ImGui::EndTabItem();
+}
+
 // Helpers
-void OpenGlViewer::ReloadScene(std::string_view path) {
-  gltfSceneImporter_->Clear(scene_);
+void OpenGlViewer::PickPrimitive() {
+  if (!ImGui::IsMouseClicked(ImGuiMouseButton_Left) ||
+      ImGui::GetIO().WantCaptureMouse) {
+    return;
+  }
+  UpdateCullBounds();
+  auto [w, h] = window_->GetWindowSize();
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+  // Unproject the cursor onto the near and far planes
+  const ImVec2 kMouse = ImGui::GetMousePos();
+  const float kNdcX = 2.0f * kMouse.x / static_cast<float>(w) - 1.0f;
+  const float kNdcY = 1.0f - 2.0f * kMouse.y / static_cast<float>(h);
+  const glm::mat4 kInverse = glm::inverse(scene_.mvp);
+  glm::vec4 nearPoint = kInverse * glm::vec4(kNdcX, kNdcY, -1.0f, 1.0f);
+  glm::vec4 farPoint = kInverse * glm::vec4(kNdcX, kNdcY, 1.0f, 1.0f);
+  nearPoint /= nearPoint.w;
+  farPoint /= farPoint.w;
+
+  const glm::vec3 kOrigin(nearPoint);
+  const auto kHit =
+      sceneBvh_.Raycast(kOrigin, glm::vec3(farPoint) - kOrigin, 1.0f);
+  pickedName_.clear();
+  if (!kHit.has_value()) {
+    return;
+  }
+  const auto& item = sceneBvh_.GetItem(kHit->item);
+  const auto& mesh = *scene_.instanceBatches[item.batch].mesh;
+  pickedName_ = mesh.name + " / " + mesh.meshPrimitives[item.primitive].name;
+}
 
-  if (auto r = scene_.shader.Compile(Platform::PbrShaderPaths()); r.err()) {
+void OpenGlViewer::ReloadScene(std::string_view path) {
+  // The current scene keeps rendering until SwapLoadedScene() replaces it
+  Mgtt::Rendering::OpenGlShader shader;
+  if (auto r = shader.Compile(Platform::PbrShaderPaths()); r.err()) {
     std::cerr << "Shader recompile: " << r.error() << '\n';
     return;
   }
-  uniforms_.Cache(scene_.shader.GetProgramId());
 
   auto hasSuffix = [](std::string_view s, std::string_view suffix) -> bool {
     return s.size() >= suffix.size() &&
@@ -493,21 +953,31 @@ void OpenGlViewer::ReloadScene(std::string_view path) {
                       hasSuffix(path, ".usda") || hasSuffix(path, ".USDA") ||
                       hasSuffix(path, ".usdc") || hasSuffix(path, ".USDC") ||
                       hasSuffix(path, ".usdz") || hasSuffix(path, ".USDZ");
-  if (kIsUsd) {
-    if (auto r = usdSceneImporter_->Load(scene_, path); r.err()) {
-      std::cerr << "USD load failed: " << r.error() << '\n';
-      return;
-    }
-  } else {
-    if (auto r = gltfSceneImporter_->Load(scene_, path); r.err()) {
-      std::cerr << "glTF load failed: " << r.error() << '\n';
-      return;
-    }
+  Mgtt::Rendering::ISceneImporter& importer =
+      kIsUsd ? static_cast<Mgtt::Rendering::ISceneImporter&>(*usdSceneImporter_)
+             : *gltfSceneImporter_;
+
+  if (auto r = sceneLoader_->Start(importer, path, std::move(shader));
+      r.err()) {
+    std::cerr << "Scene load failed: " << r.error() << '\n';
   }
+}
 
-  if (auto r = sceneUploader_->Upload(scene_); r.err()) {
-    std::cerr << "Upload failed: " << r.error() << '\n';
+void OpenGlViewer::SwapLoadedScene() {
+  if (!sceneLoader_->IsFinished()) {
+    return;
+  }
+
+  Mgtt::Rendering::Scene loaded;
+  if (auto r = sceneLoader_->Poll(loaded); r.err()) {
+    std::cerr << "Scene load failed: " << r.error() << '\n';
+    return;
   }
+  // Uploaded over the next frames; batches become visible as they finish
+  scene_ = std::move(loaded);
+  sceneUploader_->BeginUpload(scene_);
+  cullBoundsDirty_ = true;
+  uniforms_.Cache(scene_.shader.GetProgramId());
 
   scaleIblAmbient_ = 1.0f;
   showEnvMap_ = false;
@@ -0,0 +1,7 @@
+#version 330 core
+
+out vec4 fragmentColor;
+
+void main() {
+	fragmentColor = vec4(1.0f);
+}
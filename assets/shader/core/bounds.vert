@@ -0,0 +1,13 @@
+#version 330 core
+
+// Unit cube stretched over an axis-aligned box, drawn for occlusion queries
+
+layout (location = 0) in vec3 inVertexPosition;
+
+uniform mat4 mvp;
+uniform vec3 boundsMin;
+uniform vec3 boundsMax;
+
+void main() {
+	gl_Position = mvp * vec4(mix(boundsMin, boundsMax, inVertexPosition), 1.0f);
+}
@@ -0,0 +1,39 @@
+#version 330 core
+
+// Packed vertex: normalized int16 position relative to the mesh bounds,
+// 2_10_10_10 normal and tangent, half-float texture coordinates
+layout (location = 0) in vec3 inVertexPosition;
+layout (location = 1) in vec3 inVertexNormal;
+layout (location = 2) in vec2 inVertexTextureCoordinates;
+// xyz tangent, w bitangent sign; all zero when the mesh has none
+layout (location = 3) in vec4 inVertexTangent;
+// Per-instance world matrix, occupies locations 4 to 7
+layout (location = 4) in mat4 inInstanceMatrix;
+
+out vec3 outVertexNormal;
+out vec4 outVertexTangent;
+out vec3 outWorldPosition;
+out vec2 outVertexTextureCoordinates;
+
+uniform mat4 model;
+uniform mat4 mvp;
+// Dequantization of inVertexPosition: offset + position * scale
+uniform vec3 positionOffset;
+uniform vec3 positionScale;
+
+void main() {
+    vec3 vertexPosition = positionOffset + inVertexPosition * positionScale;
+
+	vec4 localVertexPosition;
+    localVertexPosition = inInstanceMatrix * vec4(vertexPosition, 1.0);
+
+    mat4 modelMatrix = model * inInstanceMatrix;
+    outVertexNormal = mat3(modelMatrix) * normalize(inVertexNormal);
+    outVertexTangent = vec4(mat3(modelMatrix) * inVertexTangent.xyz, inVertexTangent.w);
+    outWorldPosition = mat3(modelMatrix) * vertexPosition;
+
+	outVertexTextureCoordinates = inVertexTextureCoordinates;
+
+	vec3 normalizedVertexPosition = localVertexPosition.xyz / localVertexPosition.w;
+	gl_Position = mvp * vec4(normalizedVertexPosition, 1.0);
+}
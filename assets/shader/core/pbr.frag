@@ -5,6 +5,7 @@
 out vec4 fragmentColor;
 
 in vec3 outVertexNormal;
+in vec4 outVertexTangent;
 in vec3 outWorldPosition;
 in vec2 outVertexTextureCoordinates;
 
@@ -54,6 +55,14 @@ const float epsilon = 0.1;
 vec3 GetNormal(){
     vec3 tangentNormal = texture(normalMap, outVertexTextureCoordinates).xyz * 2.0 - 1.0;
 
+    // Per-vertex tangent (MikkTSpace convention), the interpolated vectors
+    // are used unnormalized
+    if (dot(outVertexTangent.xyz, outVertexTangent.xyz) > 0.0) {
+        vec3 B = cross(outVertexNormal, outVertexTangent.xyz) * outVertexTangent.w;
+        return normalize(mat3(outVertexTangent.xyz, B, outVertexNormal) * tangentNormal);
+    }
+
+    // No tangent: derive one from screen-space derivatives
     vec3 q1 = dFdx(outWorldPosition);
     vec3 q2 = dFdy(outWorldPosition);
     vec2 st1 = dFdx(outVertexTextureCoordinates);
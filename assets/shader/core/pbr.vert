@@ -3,8 +3,11 @@
 layout (location = 0) in vec3 inVertexPosition;
 layout (location = 1) in vec3 inVertexNormal;
 layout (location = 2) in vec2 inVertexTextureCoordinates;
+// xyz tangent, w bitangent sign; all zero when the mesh has none
+layout (location = 3) in vec4 inVertexTangent;
 
 out vec3 outVertexNormal;
+out vec4 outVertexTangent;
 out vec3 outWorldPosition;
 out vec2 outVertexTextureCoordinates;
 
@@ -18,6 +21,7 @@ void main() {
 
     mat4 modelMatrix = model * matrix;
     outVertexNormal = mat3(modelMatrix) * inVertexNormal;
+    outVertexTangent = vec4(mat3(modelMatrix) * inVertexTangent.xyz, inVertexTangent.w);
     outWorldPosition = mat3(modelMatrix) * inVertexPosition;
 
 	outVertexTextureCoordinates = inVertexTextureCoordinates;
@@ -0,0 +1,10 @@
+#version 300 es
+
+precision highp int;
+precision highp float;
+
+out vec4 fragmentColor;
+
+void main() {
+	fragmentColor = vec4(1.0f);
+}
@@ -0,0 +1,95 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Bulk copy kernels for glTF accessor data.
+ *
+ * All kernels write into pre-sized destination arrays. Tightly packed
+ * sources are copied with a single memcpy, strided sources are gathered one
+ * element at a time with 16-byte SSE moves where available. Index widening
+ * and rebasing use AVX2 when the library is compiled with it, SSE2 on other
+ * x86 targets and a scalar loop everywhere else.
+ */
+
+/**
+ * @brief Copy vec3 elements from a (possibly strided) float accessor.
+ *
+ * @param src        First byte of the first element.
+ * @param count      Number of elements.
+ * @param byteStride Distance in bytes between two elements.
+ * @param dst        Destination holding at least count elements.
+ */
+void CopyAccessor(const unsigned char* src, size_t count, size_t byteStride,
+                  glm::vec3* dst);
+
+/**
+ * @brief Copy vec2 elements from a (possibly strided) float accessor.
+ *
+ * @param src        First byte of the first element.
+ * @param count      Number of elements.
+ * @param byteStride Distance in bytes between two elements.
+ * @param dst        Destination holding at least count elements.
+ */
+void CopyAccessor(const unsigned char* src, size_t count, size_t byteStride,
+                  glm::vec2* dst);
+
+/**
+ * @brief Copy vec4 elements from a (possibly strided) float accessor.
+ *
+ * @param src        First byte of the first element.
+ * @param count      Number of elements.
+ * @param byteStride Distance in bytes between two elements.
+ * @param dst        Destination holding at least count elements.
+ */
+void CopyAccessor(const unsigned char* src, size_t count, size_t byteStride,
+                  glm::vec4* dst);
+
+/**
+ * @brief Normalize count vectors in place.
+ *
+ * @param data  First vector.
+ * @param count Number of vectors.
+ */
+void NormalizeVectors(glm::vec3* data, size_t count);
+
+/**
+ * @brief Widen unsigned indices to uint32 and add a base vertex.
+ *
+ * @param src           First index.
+ * @param count         Number of indices.
+ * @param componentSize Size of one source index in bytes (1, 2 or 4).
+ *                      Other sizes leave dst untouched.
+ * @param baseVertex    Value added to every index.
+ * @param dst           Destination holding at least count indices.
+ */
+void CopyIndices(const unsigned char* src, size_t count, size_t componentSize,
+                 uint32_t baseVertex, uint32_t* dst);
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,119 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <iscene-importer.h>
+#include <opengl-shader.h>
+#include <result.h>
+#include <scene.h>
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Runs ISceneImporter::Load() on a worker thread.
+ *
+ * The GL thread starts a load with a shader it compiled itself, keeps
+ * rendering its current scene and calls Poll() once per frame. When the
+ * worker is done, Poll() hands over the CPU-side scene, which the GL thread
+ * then uploads and swaps in. Builds for Emscripten without pthreads load
+ * synchronously inside Start().
+ */
+class AsyncSceneLoader {
+ public:
+  AsyncSceneLoader() = default;
+  ~AsyncSceneLoader() noexcept;
+
+  AsyncSceneLoader(const AsyncSceneLoader&) = delete;
+  AsyncSceneLoader& operator=(const AsyncSceneLoader&) = delete;
+  AsyncSceneLoader(AsyncSceneLoader&&) = delete;
+  AsyncSceneLoader& operator=(AsyncSceneLoader&&) = delete;
+
+  /**
+   * @brief Start loading a scene in the background.
+   *
+   * A load that is still running is cancelled and discarded first. The
+   * importer must not be used elsewhere until Poll() reports the result.
+   *
+   * @param importer Importer for the file type of path.
+   * @param path     File path of the scene.
+   * @param shader   Compiled shader, moved into the loaded scene.
+   * @return Err if the shader is not compiled.
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> Start(
+      Mgtt::Rendering::ISceneImporter& importer, std::string_view path,
+      Mgtt::Rendering::OpenGlShader&& shader);
+
+  /**
+   * @brief Ask the running load to stop. Poll() then reports Err.
+   */
+  void Cancel() noexcept;
+
+  /**
+   * @brief Collect a finished load. Must be called on the GL thread.
+   *
+   * @param scene Receives the loaded scene on success. Not touched otherwise.
+   * @return Ok(true) if scene was filled, Ok(false) while nothing finished,
+   * Err with the importer's message if the load failed or was cancelled.
+   */
+  [[nodiscard]] Mgtt::Common::Result<bool> Poll(Mgtt::Rendering::Scene& scene);
+
+  /**
+   * @brief Whether a load was started and not yet collected by Poll().
+   */
+  [[nodiscard]] bool IsLoading() const noexcept;
+
+  /**
+   * @brief Whether a load finished and is waiting for Poll().
+   */
+  [[nodiscard]] bool IsFinished() const noexcept;
+
+  /**
+   * @brief Completed fraction of the running load, in [0, 1].
+   */
+  [[nodiscard]] float GetProgress() const noexcept;
+
+  /**
+   * @brief Path of the running load.
+   */
+  [[nodiscard]] const std::string& GetPath() const noexcept;
+
+ private:
+  void DiscardPendingScene() noexcept;
+  void Join() noexcept;
+
+  Mgtt::Rendering::LoadProgress progress_;
+  std::thread worker_;
+  std::atomic<bool> finished_{false};
+  bool loading_{false};
+  std::string path_;
+  // Written by the worker, read on the GL thread once finished_ is set
+  Mgtt::Rendering::Scene pendingScene_;
+  std::string pendingError_;
+};
+
+}  // namespace Mgtt::Rendering
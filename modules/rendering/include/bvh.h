@@ -0,0 +1,172 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <aabb.h>
+#include <instance-batch.h>
+#include <meshlet-builder.h>
+#include <result.h>
+
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <optional>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief One primitive of one instance, bounded in world space.
+ */
+struct BvhItem {
+  Mgtt::Rendering::AABB bounds;
+  uint32_t batch{0};
+  uint32_t primitive{0};
+  uint32_t instance{0};
+};
+
+/**
+ * @brief Node of a Bvh, 32 bytes.
+ */
+struct BvhNode {
+  glm::vec3 min{FLT_MAX};
+  // Leaves: first position in the item order. Interior nodes: index of the
+  // left child, the right child follows it.
+  uint32_t first{0};
+  glm::vec3 max{-FLT_MAX};
+  // Items of a leaf, 0 for interior nodes
+  uint32_t count{0};
+};
+
+/**
+ * @brief Closest item hit by a ray.
+ */
+struct BvhHit {
+  uint32_t item{0};
+  // Distance along the ray direction to the entry point of the item bounds
+  float distance{0.0f};
+};
+
+/**
+ * @brief Bound every primitive of every instance of the batches, with
+ * AABB::CalculateBoundingBox() on the instance matrices.
+ *
+ * @param batches Instance batches of a scene.
+ * @return One item per batch, primitive and instance, in that order.
+ */
+[[nodiscard]] std::vector<Mgtt::Rendering::BvhItem> CollectBvhItems(
+    const std::vector<Mgtt::Rendering::InstanceBatch>& batches);
+
+/**
+ * @brief Bounding volume hierarchy over world-space item bounds.
+ *
+ * Nodes are split with the surface area heuristic evaluated over
+ * kBinCount centroid bins per axis. Every child is stored after its
+ * parent, so Refit() is a single reverse pass. Queries walk the tree with
+ * an explicit stack.
+ */
+class Bvh {
+ public:
+  static constexpr uint32_t kBinCount = 16;
+  static constexpr uint32_t kMaxLeafItems = 8;
+
+  /**
+   * @brief Build the hierarchy. The top levels are split on the calling
+   * thread, the subtrees below them are built in parallel.
+   *
+   * @param items       Items to bound, taken over by the hierarchy.
+   * @param threadCount Worker threads, 0 or 1 builds on the calling thread.
+   */
+  void Build(std::vector<Mgtt::Rendering::BvhItem> items,
+             uint32_t threadCount = 1);
+
+  void Clear() noexcept;
+
+  /**
+   * @brief Take new item bounds and update the node bounds without
+   * changing the tree, e.g. after node transforms changed.
+   *
+   * @param items Items in the order passed to Build().
+   * @return Err if the item count differs from the built one.
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> Refit(
+      const std::vector<Mgtt::Rendering::BvhItem>& items);
+
+  /**
+   * @brief Collect the items whose bounds intersect the frustum.
+   *
+   * @param planes Frustum planes in world space.
+   * @param items  Receives the item indices, cleared first.
+   */
+  void QueryFrustum(const Mgtt::Rendering::FrustumPlanes& planes,
+                    std::vector<uint32_t>& items) const;
+
+  /**
+   * @brief Find the item whose bounds a ray enters first.
+   *
+   * @param origin      Ray origin in world space.
+   * @param direction   Ray direction, distances are in its units.
+   * @param maxDistance Hits further away are ignored.
+   * @return The closest hit, or nothing.
+   */
+  [[nodiscard]] std::optional<Mgtt::Rendering::BvhHit> Raycast(
+      const glm::vec3& origin, const glm::vec3& direction,
+      float maxDistance = FLT_MAX) const;
+
+  [[nodiscard]] size_t Size() const noexcept { return items_.size(); }
+
+  [[nodiscard]] const Mgtt::Rendering::BvhItem& GetItem(size_t item) const {
+    return items_[item];
+  }
+
+  [[nodiscard]] const std::vector<Mgtt::Rendering::BvhNode>& GetNodes()
+      const noexcept {
+    return nodes_;
+  }
+
+ private:
+  /**
+   * @brief Bound the items of order_[begin, end) into nodes[node] and, if
+   * a split pays off, partition them and append two children.
+   *
+   * @return Position of the split in order_, nothing if node became a leaf.
+   */
+  std::optional<uint32_t> SplitNode(
+      std::vector<Mgtt::Rendering::BvhNode>& nodes, uint32_t node,
+      uint32_t begin, uint32_t end);
+
+  /**
+   * @brief Split nodes[root] and its descendants down to the leaves.
+   */
+  void BuildSubtree(std::vector<Mgtt::Rendering::BvhNode>& nodes,
+                    uint32_t root, uint32_t begin, uint32_t end);
+
+  std::vector<Mgtt::Rendering::BvhItem> items_;
+  std::vector<glm::vec3> centroids_;
+  // Item indices in leaf order
+  std::vector<uint32_t> order_;
+  std::vector<Mgtt::Rendering::BvhNode> nodes_;
+};
+
+}  // namespace Mgtt::Rendering
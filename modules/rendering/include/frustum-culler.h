@@ -0,0 +1,148 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <bvh.h>
+#include <instance-batch.h>
+#include <meshlet-builder.h>
+#include <occlusion-culler.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Outcome of the last FrustumCuller::Cull().
+ */
+struct CullStats {
+  uint32_t visible{0};
+  // Outside the frustum; occluded draws are counted separately
+  uint32_t culled{0};
+  uint32_t occluded{0};
+};
+
+/**
+ * @brief Frustum test of every primitive draw of a scene.
+ *
+ * A draw is one primitive of one instance batch. Its bounds are the union
+ * of the primitive AABB under all instance matrices of the batch, kept in
+ * six parallel min/max arrays in batch order. Cull() tests them against
+ * the frustum planes four at a time with SSE2 where available. For large
+ * scenes the hierarchy of a Bvh can be walked instead.
+ */
+class FrustumCuller {
+ public:
+  /**
+   * @brief Compute the draw bounds of all batches. Call again whenever the
+   * batches or their instance matrices change.
+   *
+   * @param batches Instance batches of the scene.
+   */
+  void Build(const std::vector<Mgtt::Rendering::InstanceBatch>& batches);
+
+  void Clear() noexcept;
+
+  /**
+   * @brief Classify every draw against the frustum.
+   *
+   * @param planes Frustum planes in the space of the instance matrices,
+   *               e.g. from ExtractFrustumPlanes(Scene::mvp).
+   * @return Number of visible and culled draws.
+   */
+  Mgtt::Rendering::CullStats Cull(const Mgtt::Rendering::FrustumPlanes& planes);
+
+  /**
+   * @brief Classify every draw by walking a hierarchy; a draw is visible if
+   * any of its instances is. Primitives without bounds stay visible.
+   *
+   * @param planes Frustum planes in the space of the instance matrices.
+   * @param bvh    Hierarchy over CollectBvhItems() of the same batches.
+   * @return Number of visible and culled draws.
+   */
+  Mgtt::Rendering::CullStats Cull(const Mgtt::Rendering::FrustumPlanes& planes,
+                                  const Mgtt::Rendering::Bvh& bvh);
+
+  /**
+   * @brief Cull the draws left visible by the last Cull() whose bounds are
+   * hidden behind the rasterized occluders.
+   *
+   * @param occlusion Occlusion buffer of the current frame.
+   * @return Number of visible, culled and occluded draws.
+   */
+  Mgtt::Rendering::CullStats CullOccluded(
+      const Mgtt::Rendering::OcclusionCuller& occlusion);
+
+  [[nodiscard]] size_t Size() const noexcept { return visible_.size(); }
+
+  /**
+   * @brief Index of the first draw of a batch; its primitives follow in
+   * order.
+   */
+  [[nodiscard]] size_t GetFirstDraw(size_t batch) const {
+    return firstDraws_[batch];
+  }
+
+  /**
+   * @brief Whether any primitive of a batch survived the last Cull().
+   */
+  [[nodiscard]] bool IsBatchVisible(size_t batch) const {
+    return batchVisible_[batch] != 0;
+  }
+
+  [[nodiscard]] bool IsVisible(size_t draw) const {
+    return visible_[draw] != 0;
+  }
+
+  /**
+   * @brief Union bounds of a draw over all instances; min is -FLT_MAX for
+   * primitives without bounds.
+   */
+  [[nodiscard]] Mgtt::Rendering::AABB GetBounds(size_t draw) const;
+
+  [[nodiscard]] const Mgtt::Rendering::CullStats& GetStats() const noexcept {
+    return stats_;
+  }
+
+ private:
+  /**
+   * @brief Fill stats_ and batchVisible_ from visible_.
+   */
+  void CountVisible();
+
+  std::vector<float> minX_;
+  std::vector<float> minY_;
+  std::vector<float> minZ_;
+  std::vector<float> maxX_;
+  std::vector<float> maxY_;
+  std::vector<float> maxZ_;
+  std::vector<uint8_t> visible_;
+  std::vector<size_t> firstDraws_;
+  std::vector<uint8_t> batchVisible_;
+  // Item indices returned by Bvh::QueryFrustum()
+  std::vector<uint32_t> bvhItems_;
+  Mgtt::Rendering::CullStats stats_;
+};
+
+}  // namespace Mgtt::Rendering
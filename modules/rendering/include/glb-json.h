@@ -0,0 +1,65 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <result.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief JSON chunk of a .glb rewritten to parse without its BIN chunk.
+ *
+ * tinygltf copies the BIN chunk into the GLB-stored buffer while parsing.
+ * The rewritten document declares that buffer as a one-byte data URI
+ * instead and points every image embedded in a bufferView at a one-byte
+ * view appended to bufferViews, so the parser never reads the BIN chunk.
+ * The caller restores buffer 0, the image bufferViews and the view list
+ * on the parsed model afterwards and reads the BIN chunk in place.
+ */
+struct DetachedGlbJson {
+  std::string json;
+  // False if buffer 0 has a URI, json is then the unchanged chunk
+  bool detached{false};
+  // bufferView of every image of the source document, -1 where it has none
+  std::vector<int> imageBufferViews;
+  // Index of the appended view, -1 if no image needed it
+  int placeholderView{-1};
+};
+
+/**
+ * @brief Rewrite the JSON chunk of a .glb, see DetachedGlbJson.
+ *
+ * Only the members involved are scanned; the rest of the document is
+ * copied verbatim and left to the glTF parser to validate.
+ *
+ * @param json JSON chunk of the .glb.
+ * @return The rewritten document, or Err if the chunk is not a JSON object.
+ */
+[[nodiscard]] Mgtt::Common::Result<DetachedGlbJson> DetachGlbBinChunk(
+    std::string_view json);
+
+}  // namespace Mgtt::Rendering
@@ -23,6 +23,8 @@
 #pragma once
 
 #include <iscene-importer.h>
+#include <mapped-file.h>
+#include <scene-cache.h>
 #include <stb_image.h>
 #include <tiny_gltf.h>
 
@@ -83,27 +85,253 @@ class GltfSceneImporter : public ISceneImporter {
    */
   void Clear(Mgtt::Rendering::Scene& scene) noexcept override;
 
+  /**
+   * @brief Set the number of worker threads used to decode textures.
+   *
+   * 0 or 1 keeps the serial decode on the calling thread. Larger values
+   * decode all images of the model concurrently; the results are inserted
+   * into Scene::textureMap in glTF texture order afterwards, so the
+   * resulting scene does not depend on the thread count.
+   *
+   * @param threadCount Number of decode workers.
+   */
+  void SetTextureDecodeThreadCount(uint32_t threadCount) noexcept;
+
+  /**
+   * @brief Number of worker threads used to decode textures.
+   */
+  [[nodiscard]] uint32_t GetTextureDecodeThreadCount() const noexcept;
+
+  /**
+   * @brief Enable the memory-mapped loading path for .glb files.
+   *
+   * The file is mapped read-only instead of being read into a heap buffer.
+   * tinygltf only parses the JSON chunk, accessors and embedded images are
+   * read straight from the mapped BIN chunk, which is never copied. Has no
+   * effect on .gltf files.
+   *
+   * @param enabled True to map .glb files.
+   */
+  void SetMemoryMappedGlb(bool enabled) noexcept;
+
+  /**
+   * @brief Whether .glb files are loaded through a memory mapping.
+   */
+  [[nodiscard]] bool IsMemoryMappedGlb() const noexcept;
+
+  /**
+   * @brief Enable the binary scene cache.
+   *
+   * A fully converted scene is written to the directory after every cold
+   * load, on a background thread, and later loads of an unchanged source
+   * are served from it without parsing or image decoding. An empty
+   * directory disables the cache.
+   *
+   * @param directory Directory holding cache entries.
+   * @param sizeLimit Total size of the entries above which the least
+   *                  recently used are evicted, 0 for no limit.
+   */
+  void SetCacheDirectory(
+      std::string_view directory,
+      uint64_t sizeLimit = Mgtt::Rendering::SceneCache::kDefaultSizeLimit);
+
  private:
+  /**
+   * @brief State of a single Load(), kept off the importer so that loads on
+   * different threads do not share it.
+   */
+  struct LoadContext {
+    // Mapped BIN chunk standing in for the GLB-stored buffer, if any
+    const unsigned char* binChunk{nullptr};
+    size_t binChunkSize{0};
+    // Meshes built so far, indexed by glTF mesh index
+    std::vector<std::shared_ptr<Mgtt::Rendering::Mesh>> meshes;
+  };
+
   [[nodiscard]] std::string ExtractFolderPath(std::string_view path) const;
 
+  /**
+   * @brief Parse a .glb file through a read-only memory mapping.
+   *
+   * @param gltfModel Model receiving the parsed glTF document.
+   * @param mappedGlb Mapping opened on the file; must outlive the scene build.
+   * @param path      Path to the .glb file.
+   * @param context   Receives the location of the mapped BIN chunk.
+   * @return Ok on success, Err with a descriptive message on failure.
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> ParseMappedGlb(
+      tinygltf::Model& gltfModel, Mgtt::Rendering::MappedFile& mappedGlb,
+      const std::string& path, LoadContext& context);
+
+  /**
+   * @brief Build textures, materials and the node hierarchy of the scene.
+   *
+   * @param scene     Scene to populate.
+   * @param gltfModel Parsed glTF document.
+   * @param context   State of the running load.
+   * @return Ok on success, Err with a descriptive message on failure.
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> BuildScene(
+      Mgtt::Rendering::Scene& scene, tinygltf::Model& gltfModel,
+      LoadContext& context);
+
+  /**
+   * @brief Start of the bytes of a glTF buffer.
+   *
+   * Resolves to the mapped BIN chunk of the context for the GLB-stored
+   * buffer of a memory-mapped .glb.
+   */
+  [[nodiscard]] static const unsigned char* BufferData(
+      const tinygltf::Model& model, const LoadContext& context,
+      int bufferIndex);
+
+  /**
+   * @brief Size in bytes of a glTF buffer, see BufferData().
+   */
+  [[nodiscard]] static size_t BufferSize(const tinygltf::Model& model,
+                                         const LoadContext& context,
+                                         int bufferIndex);
+
+  /**
+   * @brief Key of a glTF image in Scene::textureMap.
+   *
+   * The image URI, or a synthetic "#image<index>" key for images embedded
+   * in a bufferView, which have no URI.
+   */
+  [[nodiscard]] static std::string TextureKey(const tinygltf::Model& model,
+                                              int imageIndex);
+
+  /**
+   * @brief Decode a single glTF image into CPU memory.
+   *
+   * Embedded images are decoded from their bufferView, external files and
+   * data URIs from the encoded bytes tinygltf read while parsing. Safe to
+   * call concurrently for distinct textures.
+   *
+   * @param texture    Texture receiving the stbi data pointer and metadata.
+   * @param folderPath Directory of the glTF file.
+   * @param model      glTF document owning the image.
+   * @param context    State of the running load.
+   * @param imageIndex Index of the glTF image to decode.
+   */
+  void DecodeTexture(Mgtt::Rendering::Texture& texture,
+                     const std::string& folderPath,
+                     const tinygltf::Model& model, const LoadContext& context,
+                     int imageIndex) const;
+
   [[nodiscard]] Mgtt::Common::Result<void> LoadTextures(
-      Mgtt::Rendering::Scene& scene, tinygltf::Model& gltfModel);
+      Mgtt::Rendering::Scene& scene, tinygltf::Model& gltfModel,
+      const LoadContext& context);
 
   void LoadMaterials(Mgtt::Rendering::Scene& scene, tinygltf::Model& gltfModel);
 
-  [[nodiscard]] Mgtt::Common::Result<void> LoadNode(
-      const std::shared_ptr<Mgtt::Rendering::Node>& parent,
-      Mgtt::Rendering::Scene& scene, const tinygltf::Node& node,
-      uint32_t nodeIndex, const tinygltf::Model& model);
+  /**
+   * @brief Append one glTF node below parent, without its children.
+   *
+   * @return Index of the new node in Scene::nodes.
+   */
+  [[nodiscard]] Mgtt::Common::Result<uint32_t> LoadNode(
+      uint32_t parent, Mgtt::Rendering::Scene& scene,
+      const tinygltf::Node& node, uint32_t nodeIndex,
+      const tinygltf::Model& model, LoadContext& context);
+
+  /**
+   * @brief Build the vertex, index and primitive data of a glTF mesh.
+   *
+   * @param scene    Scene whose loaded materials are moved into primitives.
+   * @param gltfMesh glTF mesh to convert.
+   * @param model    glTF document owning the mesh.
+   * @param context  State of the running load.
+   * @return The new mesh, or Err with a descriptive message on failure.
+   */
+  [[nodiscard]] Mgtt::Common::Result<std::shared_ptr<Mgtt::Rendering::Mesh>>
+  LoadMesh(Mgtt::Rendering::Scene& scene, const tinygltf::Mesh& gltfMesh,
+           const tinygltf::Model& model, const LoadContext& context);
+
+  /**
+   * @brief Parse EXT_mesh_gpu_instancing of a node into instance matrices.
+   *
+   * Leaves instanceMatrices untouched if the node has no such extension.
+   *
+   * @param node             glTF node that may carry the extension.
+   * @param model            glTF document owning the node.
+   * @param context          State of the running load.
+   * @param instanceMatrices Receives one local TRS matrix per instance.
+   * @return Ok on success, Err if an instance accessor is malformed.
+   */
+  [[nodiscard]] static Mgtt::Common::Result<void> LoadInstanceMatrices(
+      const tinygltf::Node& node, const tinygltf::Model& model,
+      const LoadContext& context, std::vector<glm::mat4>& instanceMatrices);
+
+  /**
+   * @brief Read a float or normalized integer accessor into floats.
+   *
+   * @param model         glTF document owning the accessor.
+   * @param context       State of the running load.
+   * @param accessorIndex Index of the accessor.
+   * @param components    Expected number of components per element.
+   * @param values        Receives count * components floats.
+   * @return Ok on success, Err on an invalid index, type or component type.
+   */
+  [[nodiscard]] static Mgtt::Common::Result<void> ReadFloatAccessor(
+      const tinygltf::Model& model, const LoadContext& context,
+      int accessorIndex, int components, std::vector<float>& values);
+
+  /**
+   * @brief Check that every element of an accessor lies inside its buffer.
+   *
+   * The mapped BIN chunk is not validated by tinygltf, so this must pass
+   * before an accessor is read through AccessorData().
+   *
+   * @param model       glTF document owning the accessor.
+   * @param context     State of the running load.
+   * @param accessor    Accessor to check.
+   * @param elementSize Size in bytes of one element.
+   * @param packed      True if the elements are read tightly packed, as
+   *                    indices are, regardless of the view's byteStride.
+   * @return Ok, or Err on an invalid bufferView or buffer index or if the
+   *         last element ends past the buffer.
+   */
+  [[nodiscard]] static Mgtt::Common::Result<void> CheckAccessorBounds(
+      const tinygltf::Model& model, const LoadContext& context,
+      const tinygltf::Accessor& accessor, size_t elementSize,
+      bool packed = false);
+
+  /**
+   * @brief Start of the first element of an accessor, see BufferData().
+   */
+  [[nodiscard]] static const unsigned char* AccessorData(
+      const tinygltf::Model& model, const LoadContext& context,
+      const tinygltf::Accessor& accessor);
+
+  /**
+   * @brief Byte stride of an accessor, or packedSize if tightly packed.
+   */
+  [[nodiscard]] static size_t AccessorStride(const tinygltf::Model& model,
+                                             const tinygltf::Accessor& accessor,
+                                             size_t packedSize);
+
+  /**
+   * @brief Drop everything a failed or cancelled Load() produced, keeping the
+   * scene's shader.
+   */
+  void DiscardScene(Mgtt::Rendering::Scene& scene) noexcept;
 
   void FreeTextureData(Mgtt::Rendering::Texture& texture);
-  void UpdateNodeMeshMatrices(
-      const std::shared_ptr<Mgtt::Rendering::Node>& node);
+  /**
+   * @brief Bound every mesh node and the scene in one pass over
+   * Scene::nodes. Scene::transforms must be built.
+   */
   void CalculateSceneDimensions(Mgtt::Rendering::Scene& scene);
-  void CalculateSceneAABB(Mgtt::Rendering::Scene& scene,
-                          const std::shared_ptr<Mgtt::Rendering::Node>& node);
-  void CalculateSceneNodesAABBs(
-      const std::shared_ptr<Mgtt::Rendering::Node>& node);
+
+  /**
+   * @brief Bound a mesh node under its world matrix and instances.
+   */
+  void CalculateSceneNodesAABBs(Mgtt::Rendering::Node& node);
+
+  uint32_t textureDecodeThreadCount_{1};
+  bool memoryMappedGlb_{false};
+  Mgtt::Rendering::SceneCache sceneCache_;
 };
 
 }  // namespace Mgtt::Rendering
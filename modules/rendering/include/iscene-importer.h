@@ -24,11 +24,25 @@
 #include <result.h>
 #include <scene.h>
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <string_view>
 
 namespace Mgtt::Rendering {
 
+/**
+ * @brief Progress of a Load() running on another thread.
+ *
+ * Written by the importer, read by the thread that started the load. Setting
+ * cancelRequested makes the running Load() stop at its next checkpoint and
+ * return Err.
+ */
+struct LoadProgress {
+  std::atomic<float> fraction{0.0f};
+  std::atomic<bool> cancelRequested{false};
+};
+
 /**
  * @brief Interface for importing 3D scenes.
  *
@@ -52,6 +66,9 @@ class ISceneImporter {
   /**
    * @brief Load the scene from a specified file path.
    *
+   * Makes no GL calls, so it may run on a worker thread. On failure the scene
+   * is left empty apart from its shader.
+   *
    * @param scene Reference to the 3D scene to populate.
    * @param path  File path from which to load the scene.
    * @return Ok on success, Err with a descriptive message on failure.
@@ -65,6 +82,155 @@ class ISceneImporter {
    * @param scene Reference to the 3D scene to clear.
    */
   virtual void Clear(Mgtt::Rendering::Scene& scene) noexcept = 0;
+
+  /**
+   * @brief Report progress of subsequent Load() calls and honour
+   * cancellation.
+   *
+   * @param progress Progress sink, or nullptr to detach. Must outlive the
+   * Load() calls it is attached to.
+   */
+  void SetLoadProgress(Mgtt::Rendering::LoadProgress* progress) noexcept {
+    loadProgress_ = progress;
+  }
+
+  /**
+   * @brief Run OptimizeMeshes() on scenes imported from source.
+   *
+   * Reorders triangles and vertices for vertex cache, overdraw and vertex
+   * fetch efficiency. Off by default, as it adds to cold load times.
+   *
+   * @param enabled True to optimize meshes in subsequent Load() calls.
+   */
+  void SetMeshOptimization(bool enabled) noexcept {
+    meshOptimization_ = enabled;
+  }
+
+  [[nodiscard]] bool IsMeshOptimization() const noexcept {
+    return meshOptimization_;
+  }
+
+  /**
+   * @brief Run GenerateTangentSpace() on scenes imported from source.
+   *
+   * Runs after welding, so duplicated vertices get one smooth normal
+   * instead of one flat normal per face. Exact duplicates are merged for
+   * that even when SetVertexWelding() is off.
+   *
+   * @param enabled     True to fill in missing normals and tangents in
+   *                    subsequent Load() calls.
+   * @param threadCount Worker threads used for the generation.
+   */
+  void SetTangentGeneration(bool enabled, uint32_t threadCount = 1) noexcept {
+    tangentGeneration_ = enabled;
+    tangentThreadCount_ = threadCount;
+  }
+
+  [[nodiscard]] bool IsTangentGeneration() const noexcept {
+    return tangentGeneration_;
+  }
+
+  /**
+   * @brief Run WeldVertices() on scenes imported from source.
+   *
+   * Welding runs before tangent generation and mesh optimization, so both
+   * see the shared vertices.
+   *
+   * @param enabled True to weld vertices in subsequent Load() calls.
+   * @param epsilon Per-component tolerance, 0 merges exact duplicates only.
+   */
+  void SetVertexWelding(bool enabled, float epsilon = 0.0f) noexcept {
+    vertexWelding_ = enabled;
+    vertexWeldEpsilon_ = epsilon;
+  }
+
+  [[nodiscard]] bool IsVertexWelding() const noexcept {
+    return vertexWelding_;
+  }
+
+  [[nodiscard]] float GetVertexWeldEpsilon() const noexcept {
+    return vertexWeldEpsilon_;
+  }
+
+  /**
+   * @brief Run GenerateLods() on scenes imported from source.
+   *
+   * LODs are built last, from the welded and optimized meshes.
+   *
+   * @param enabled True to build LOD chains in subsequent Load() calls.
+   */
+  void SetLodGeneration(bool enabled) noexcept { lodGeneration_ = enabled; }
+
+  [[nodiscard]] bool IsLodGeneration() const noexcept {
+    return lodGeneration_;
+  }
+
+  /**
+   * @brief Run BuildMeshlets() on scenes imported from source.
+   *
+   * @param enabled True to split primitives into meshlets in subsequent
+   *                Load() calls.
+   */
+  void SetMeshletGeneration(bool enabled) noexcept {
+    meshletGeneration_ = enabled;
+  }
+
+  [[nodiscard]] bool IsMeshletGeneration() const noexcept {
+    return meshletGeneration_;
+  }
+
+  /**
+   * @brief Describe the options that change what Load() produces.
+   *
+   * Used to key scene cache entries, so an entry is only served to loads
+   * with the same options.
+   */
+  [[nodiscard]] std::string GetImportOptions() const;
+
+ protected:
+  /**
+   * @brief Publish the completed fraction of the running Load().
+   *
+   * @param fraction Value in [0, 1].
+   * @return False if the load was cancelled and should stop.
+   */
+  [[nodiscard]] bool ReportProgress(float fraction) const noexcept {
+    if (loadProgress_ == nullptr) {
+      return true;
+    }
+    loadProgress_->fraction.store(fraction, std::memory_order_relaxed);
+    return !IsLoadCancelled();
+  }
+
+  /**
+   * @brief Whether the running Load() was asked to stop.
+   */
+  [[nodiscard]] bool IsLoadCancelled() const noexcept {
+    return loadProgress_ != nullptr &&
+           loadProgress_->cancelRequested.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Weld, complete, optimize and build meshlets and LODs for the
+   * meshes of a freshly imported scene, as enabled by
+   * SetVertexWelding(), SetTangentGeneration(), SetMeshOptimization(),
+   * SetMeshletGeneration() and SetLodGeneration().
+   *
+   * @param scene Scene whose meshes are processed in place.
+   * @return Ok on success, Err if a mesh is malformed.
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> ProcessMeshes(
+      Mgtt::Rendering::Scene& scene) const;
+
+ private:
+  Mgtt::Rendering::LoadProgress* loadProgress_{nullptr};
+  bool meshOptimization_{false};
+  bool tangentGeneration_{false};
+  uint32_t tangentThreadCount_{1};
+  bool vertexWelding_{false};
+  float vertexWeldEpsilon_{0.0f};
+  bool lodGeneration_{false};
+  bool meshletGeneration_{false};
 };
 
 }  // namespace Mgtt::Rendering
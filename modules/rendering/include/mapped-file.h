@@ -0,0 +1,75 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <result.h>
+
+#include <cstddef>
+#include <string_view>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * Backed by mmap on POSIX systems and by a file mapping object on Windows.
+ * Pages are loaded by the OS on first access and are not counted against
+ * the process heap, so large assets can be parsed in place.
+ */
+class MappedFile {
+ public:
+  MappedFile() noexcept = default;
+  ~MappedFile() noexcept;
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  /**
+   * @brief Map the file at path. Any previous mapping is released first.
+   *
+   * @param path Path to the file.
+   * @return Ok on success, Err with a descriptive message on failure.
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> Open(std::string_view path);
+
+  /**
+   * @brief Release the mapping and the underlying file handles.
+   */
+  void Close() noexcept;
+
+  [[nodiscard]] const unsigned char* Data() const noexcept;
+  [[nodiscard]] size_t Size() const noexcept;
+  [[nodiscard]] bool IsOpen() const noexcept;
+
+ private:
+  const unsigned char* data_{nullptr};
+  size_t size_{0};
+#ifdef _WIN32
+  void* file_{nullptr};
+  void* mapping_{nullptr};
+#endif
+};
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,160 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mesh.h>
+#include <result.h>
+#include <scene.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief FIFO size assumed by the optimizer and the cache metrics.
+ */
+inline constexpr uint32_t kVertexCacheSize = 16;
+
+/**
+ * @brief Maximum ACMR of an overdraw cluster relative to the
+ * cache-optimized order it was cut from.
+ */
+inline constexpr float kOverdrawThreshold = 1.05f;
+
+/**
+ * @brief Post-transform vertex cache efficiency of a triangle list,
+ * measured with a simulated FIFO cache of kVertexCacheSize entries.
+ */
+struct VertexCacheStats {
+  uint64_t triangleCount{0};
+  // Distinct vertices referenced by the triangles
+  uint64_t vertexCount{0};
+  // Cache misses, i.e. vertex shader invocations
+  uint64_t transformedCount{0};
+  // Average cache miss ratio: transformed vertices per triangle
+  float acmr{0.0f};
+  // Average transform to vertex ratio: transformed per referenced vertex
+  float atvr{0.0f};
+};
+
+/**
+ * @brief Cache metrics of a mesh before and after optimization.
+ */
+struct MeshOptimizationReport {
+  Mgtt::Rendering::VertexCacheStats before;
+  Mgtt::Rendering::VertexCacheStats after;
+};
+
+/**
+ * @brief Simulate a FIFO vertex cache over a triangle list.
+ *
+ * @param indices     Triangle list.
+ * @param indexCount  Number of indices, a trailing partial triangle is
+ *                    ignored.
+ * @param vertexCount Number of vertices the indices refer to.
+ * @param cacheSize   Number of FIFO entries.
+ * @return Cache metrics of the index order.
+ */
+[[nodiscard]] Mgtt::Rendering::VertexCacheStats AnalyzeVertexCache(
+    const uint32_t* indices, size_t indexCount, size_t vertexCount,
+    uint32_t cacheSize = kVertexCacheSize);
+
+/**
+ * @brief Reorder triangles for post-transform vertex cache locality.
+ *
+ * Implements Tipsify (Sander et al. 2007): triangles are emitted as fans
+ * around vertices that are still in the cache, falling back to recently
+ * used vertices and then to input order at dead ends. Runs in linear time.
+ *
+ * @param indices     Triangle list.
+ * @param indexCount  Number of indices, a multiple of 3.
+ * @param vertexCount Number of vertices the indices refer to.
+ * @param cacheSize   Number of FIFO entries to optimize for.
+ * @return The triangles of indices in the new order.
+ */
+[[nodiscard]] std::vector<uint32_t> OptimizeVertexCache(
+    const uint32_t* indices, size_t indexCount, size_t vertexCount,
+    uint32_t cacheSize = kVertexCacheSize);
+
+/**
+ * @brief Reorder triangle clusters to reduce overdraw.
+ *
+ * Expects cache-optimized input. The triangles are cut into clusters at
+ * cache flushes and wherever a cluster's own ACMR is within threshold of
+ * its flush-to-flush span. Clusters are then drawn outside-in: sorted by
+ * how far their centroid lies along their average normal, measured from
+ * center. The order is view independent.
+ *
+ * @param indices    Triangle list.
+ * @param indexCount Number of indices, a multiple of 3.
+ * @param positions  Vertex positions the indices refer to.
+ * @param center     Center of the geometry, usually its AABB center.
+ * @param cacheSize  Number of FIFO entries.
+ * @param threshold  Allowed ACMR ratio of a cluster, >= 1.
+ * @return The triangles of indices in the new order.
+ */
+[[nodiscard]] std::vector<uint32_t> OptimizeOverdraw(
+    const uint32_t* indices, size_t indexCount,
+    const std::vector<glm::vec3>& positions, const glm::vec3& center,
+    uint32_t cacheSize = kVertexCacheSize,
+    float threshold = kOverdrawThreshold);
+
+/**
+ * @brief Reorder the vertices of a mesh by first use in its index buffer.
+ *
+ * All vertex attribute arrays and the indices are remapped. Vertices no
+ * triangle refers to are kept after the referenced ones.
+ *
+ * @param mesh Mesh to reorder in place.
+ */
+void OptimizeVertexFetch(Mgtt::Rendering::Mesh& mesh);
+
+/**
+ * @brief Run the vertex cache, overdraw and vertex fetch passes on a mesh.
+ *
+ * Triangles are reordered within each MeshPrimitive so draw ranges and
+ * materials are unchanged. Must run before the mesh is uploaded.
+ *
+ * @param mesh      Mesh to optimize in place.
+ * @param threshold Overdraw threshold, see OptimizeOverdraw().
+ * @return Cache metrics before and after, Err if an index is out of range.
+ */
+[[nodiscard]] Mgtt::Common::Result<Mgtt::Rendering::MeshOptimizationReport>
+OptimizeMesh(Mgtt::Rendering::Mesh& mesh,
+             float threshold = kOverdrawThreshold);
+
+/**
+ * @brief Optimize every distinct mesh reachable from the scene's nodes.
+ *
+ * @param scene     Scene whose meshes are optimized in place.
+ * @param threshold Overdraw threshold, see OptimizeOverdraw().
+ * @return Cache metrics summed over all meshes, Err on the first failure.
+ */
+[[nodiscard]] Mgtt::Common::Result<Mgtt::Rendering::MeshOptimizationReport>
+OptimizeMeshes(Mgtt::Rendering::Scene& scene,
+               float threshold = kOverdrawThreshold);
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,91 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mesh.h>
+#include <result.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Default largest deviation of a LOD, relative to the extent of the
+ * primitive it was built from.
+ */
+inline constexpr float kLodMaxError = 0.05f;
+
+/**
+ * @brief One level produced by SimplifyTriangles().
+ */
+struct SimplifiedLevel {
+  std::vector<uint32_t> indices;
+  // Largest object-space deviation from the source surface
+  float error{0.0f};
+};
+
+/**
+ * @brief Simplify a triangle list into progressively coarser levels.
+ *
+ * Collapses edges onto existing vertices in the order of a quadric error
+ * metric (Garland and Heckbert 1997), so every level indexes the vertices
+ * of the mesh. Open borders and attribute seams get extra edge quadrics and
+ * only collapse along themselves; vertices with differing normals or
+ * texture coordinates are penalized, and collapses that flip a triangle are
+ * rejected. Levels are cut from one run, so errors accumulate against the
+ * source surface.
+ *
+ * @param mesh       Mesh providing the vertex attributes.
+ * @param indices    Triangle list into the mesh's vertices.
+ * @param indexCount Number of indices, a multiple of 3.
+ * @param ratios     Decreasing target triangle fractions, e.g. 0.5, 0.25.
+ * @param maxError   Largest deviation relative to the extent of the
+ *                   triangles.
+ * @return One level per ratio reached. The chain ends early, possibly with
+ * a level above its target, once collapses would exceed maxError.
+ */
+[[nodiscard]] std::vector<Mgtt::Rendering::SimplifiedLevel> SimplifyTriangles(
+    const Mgtt::Rendering::Mesh& mesh, const uint32_t* indices,
+    size_t indexCount, const std::vector<float>& ratios,
+    float maxError = kLodMaxError);
+
+/**
+ * @brief Build the LOD chain of every indexed primitive of a mesh.
+ *
+ * The indices of each level are cache optimized, appended to Mesh::indices
+ * and recorded in MeshPrimitive::lods. A previous chain is replaced. Must
+ * run before the mesh is uploaded.
+ *
+ * @param mesh     Mesh to extend in place.
+ * @param ratios   Decreasing target triangle fractions.
+ * @param maxError Largest deviation relative to each primitive's extent.
+ * @return Ok on success, Err if an index is out of range.
+ */
+[[nodiscard]] Mgtt::Common::Result<void> GenerateLods(
+    Mgtt::Rendering::Mesh& mesh,
+    const std::vector<float>& ratios = {0.5f, 0.25f, 0.1f},
+    float maxError = kLodMaxError);
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,102 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mesh.h>
+#include <result.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Cluster limits, sized for mesh shader style workloads.
+ */
+inline constexpr uint32_t kMeshletMaxVertices = 64;
+inline constexpr uint32_t kMeshletMaxTriangles = 124;
+
+/**
+ * @brief Split every indexed primitive of a mesh into meshlets.
+ *
+ * Triangles are taken in index order, so the primitive's range is not
+ * reordered and each meshlet is a contiguous subrange of it. Run after
+ * OptimizeVertexCache(), whose ordering keeps neighbouring triangles
+ * together. Results are stored in MeshPrimitive::meshlets, replacing
+ * previous ones.
+ *
+ * @param mesh         Mesh whose primitives receive meshlets.
+ * @param maxVertices  Largest number of distinct vertices per meshlet.
+ * @param maxTriangles Largest number of triangles per meshlet.
+ * @return Number of meshlets built, Err if an index is out of range.
+ */
+[[nodiscard]] Mgtt::Common::Result<size_t> BuildMeshlets(
+    Mgtt::Rendering::Mesh& mesh, uint32_t maxVertices = kMeshletMaxVertices,
+    uint32_t maxTriangles = kMeshletMaxTriangles);
+
+/**
+ * @brief Compute the bounding sphere and normal cone of a triangle range.
+ *
+ * @param mesh       Mesh providing the positions.
+ * @param firstIndex First index of the range in Mesh::indices.
+ * @param indexCount Number of indices, a multiple of 3.
+ * @return Meshlet covering the range.
+ */
+[[nodiscard]] Mgtt::Rendering::Meshlet ComputeMeshletBounds(
+    const Mgtt::Rendering::Mesh& mesh, uint32_t firstIndex,
+    uint32_t indexCount);
+
+/**
+ * @brief Frustum planes (a, b, c, d), inside where a*x + b*y + c*z + d >= 0.
+ */
+using FrustumPlanes = std::array<glm::vec4, 6>;
+
+/**
+ * @brief Extract the frustum planes of a clip transform (Gribb and
+ * Hartmann). For projection * view * model the planes are in model space.
+ *
+ * @param clip Transform from the target space to clip space.
+ * @return Normalized planes: left, right, bottom, top, near, far.
+ */
+[[nodiscard]] Mgtt::Rendering::FrustumPlanes ExtractFrustumPlanes(
+    const glm::mat4& clip);
+
+/**
+ * @brief Whether a meshlet may contribute pixels.
+ *
+ * @param meshlet  Meshlet to test.
+ * @param planes   Frustum planes in mesh space.
+ * @param viewer   Camera position in mesh space.
+ * @param backface True to also test the normal cone; only valid when back
+ *                 faces are culled, i.e. for single-sided materials.
+ * @return False if the bounding sphere is outside the frustum or, with
+ * backface set, the normal cone faces away from the viewer.
+ */
+[[nodiscard]] bool IsMeshletVisible(
+    const Mgtt::Rendering::Meshlet& meshlet,
+    const Mgtt::Rendering::FrustumPlanes& planes, const glm::vec3& viewer,
+    bool backface = true);
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,104 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#ifdef __EMSCRIPTEN__
+#include <GLES3/gl3.h>
+#else
+#include <GL/glew.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Element type of an uploaded index buffer.
+ */
+enum class IndexType : uint8_t {
+  UInt16 = 0,
+  UInt32 = 1,
+};
+
+/**
+ * @brief Select the narrowest index type that addresses a vertex range.
+ *
+ * @param vertexCount Number of vertices the indices may refer to.
+ * @return IndexType::UInt16 for up to 65536 vertices, else UInt32.
+ */
+[[nodiscard]] IndexType SelectIndexType(size_t vertexCount) noexcept;
+
+/**
+ * @brief Select the narrowest index type for a mesh's rebased indices.
+ *
+ * @param indices     Mesh-relative indices.
+ * @param vertexCount Number of vertices the indices should refer to.
+ * @param baseVertex  Value added to every index.
+ * @return The type addressing both the vertex range and the largest index.
+ */
+[[nodiscard]] IndexType SelectIndexType(const std::vector<uint32_t>& indices,
+                                        size_t vertexCount,
+                                        uint32_t baseVertex = 0) noexcept;
+
+/**
+ * @brief Size in bytes of one index of the given type.
+ */
+[[nodiscard]] size_t GetIndexSize(IndexType type) noexcept;
+
+/**
+ * @brief GL enum passed to glDrawElements* for the given type.
+ */
+[[nodiscard]] GLenum GetIndexGlType(IndexType type) noexcept;
+
+/**
+ * @brief Type-tagged copy of a mesh's indices ready for upload.
+ *
+ * Meshes keep 32-bit indices on the CPU; this holds them in the narrowest
+ * type for the vertex range and the largest index, optionally offset by a
+ * base vertex.
+ */
+struct IndexBuffer {
+  IndexBuffer() = default;
+
+  /**
+   * @brief Narrow and rebase indices.
+   *
+   * @param indices     Mesh-relative indices.
+   * @param vertexCount Number of vertices the indices refer to.
+   * @param baseVertex  Value added to every index.
+   */
+  IndexBuffer(const std::vector<uint32_t>& indices, size_t vertexCount,
+              uint32_t baseVertex = 0);
+
+  [[nodiscard]] size_t GetCount() const noexcept;
+  [[nodiscard]] size_t GetByteSize() const noexcept;
+  [[nodiscard]] const void* GetData() const noexcept;
+
+  IndexType type{IndexType::UInt32};
+  std::vector<uint16_t> indices16;
+  std::vector<uint32_t> indices32;
+};
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,66 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#ifdef __EMSCRIPTEN__
+#include <GLES3/gl3.h>
+#else
+#include <GL/glew.h>
+#endif
+
+#include <mesh.h>
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief All placements of one mesh, drawn with instanced draw calls.
+ *
+ * Each primitive of the mesh is drawn once for the whole batch. The
+ * per-instance world matrices are streamed from instanceVbo, which is
+ * attached to the mesh VAO as a per-instance vertex attribute. In
+ * shared-buffer mode instanceVbo stays 0 and the matrices live in
+ * Scene::sharedGeometry starting at firstInstance.
+ */
+struct InstanceBatch {
+  InstanceBatch() = default;
+  ~InstanceBatch() noexcept;
+
+  InstanceBatch(const InstanceBatch&) = delete;
+  InstanceBatch& operator=(const InstanceBatch&) = delete;
+  InstanceBatch(InstanceBatch&&) noexcept;
+  InstanceBatch& operator=(InstanceBatch&&) noexcept;
+
+  void Clear();
+
+  std::shared_ptr<Mgtt::Rendering::Mesh> mesh;
+  std::vector<glm::mat4> instanceMatrices;
+
+  uint32_t instanceVbo{0};
+  uint32_t firstInstance{0};
+};
+
+}  // namespace Mgtt::Rendering
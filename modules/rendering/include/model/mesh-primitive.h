@@ -25,10 +25,40 @@
 #include <aabb.h>
 #include <material.h>
 
+#include <cstdint>
+#include <glm/glm.hpp>
 #include <string>
+#include <vector>
 
 namespace Mgtt::Rendering {
 
+/**
+ * @brief A simplified level of a primitive, drawn instead of its full
+ * index range when the error is small on screen.
+ */
+struct MeshLod {
+  uint32_t firstIndex{0};
+  uint32_t indexCount{0};
+  // Largest object-space deviation from the full-detail surface
+  float error{0.0f};
+};
+
+/**
+ * @brief A cluster of neighbouring triangles within a primitive's index
+ * range, with the bounds needed to cull it on its own.
+ */
+struct Meshlet {
+  uint32_t firstIndex{0};
+  uint32_t indexCount{0};
+  // Bounding sphere in mesh space
+  glm::vec3 center{0.0f};
+  float radius{0.0f};
+  // Normal cone: all triangles face away from a viewer for whom
+  // dot(center - viewer, coneAxis) >= coneCutoff * |center - viewer| + radius
+  glm::vec3 coneAxis{0.0f, 0.0f, 1.0f};
+  float coneCutoff{1.0f};
+};
+
 /**
  * @brief Represents a single draw-call unit within a mesh.
  */
@@ -49,6 +79,10 @@ struct MeshPrimitive {
 
   Mgtt::Rendering::PbrMaterial pbrMaterial;
   AABB aabb;
+  // Coarser levels in Mesh::indices, ordered by increasing error
+  std::vector<Mgtt::Rendering::MeshLod> lods;
+  // Consecutive clusters covering the full-detail index range
+  std::vector<Mgtt::Rendering::Meshlet> meshlets;
 };
 
 }  // namespace Mgtt::Rendering
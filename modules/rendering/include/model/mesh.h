@@ -29,6 +29,7 @@
 #endif
 
 #include <aabb.h>
+#include <index-buffer.h>
 #include <mesh-primitive.h>
 
 #include <glm/glm.hpp>
@@ -62,17 +63,34 @@ struct Mesh {
   std::vector<glm::vec3> vertexPositionAttribs;
   std::vector<glm::vec3> vertexNormalAttribs;
   std::vector<glm::vec2> vertexTextureAttribs;
+  // xyz tangent, w bitangent sign; w = 0 marks a tangent still to generate
+  std::vector<glm::vec4> vertexTangentAttribs;
   std::vector<glm::ivec4> vertexJointAttribs;
   std::vector<glm::vec4> vertexWeightAttribs;
 
-  glm::mat4 matrix{1.0f};
-
   uint32_t vao{0};
   uint32_t ebo{0};
   uint32_t pos{0};
   uint32_t normal{0};
   uint32_t tex{0};
+  uint32_t tangent{0};
+  // Element type of ebo, chosen at upload from the vertex count
+  Mgtt::Rendering::IndexType indexType{Mgtt::Rendering::IndexType::UInt32};
+
+  // Set when the buffers above belong to Scene::sharedGeometry. The mesh
+  // then starts at baseVertex and at baseIndex, which counts indexType
+  // elements, and does not delete them.
+  bool sharedBuffers{false};
+  int32_t baseVertex{0};
+  uint32_t baseIndex{0};
+
+  // Set when pos holds interleaved PackedVertex data; positions are then
+  // restored as positionOffset + position * positionScale
+  bool packedVertices{false};
+  glm::vec3 positionOffset{0.0f};
+  glm::vec3 positionScale{1.0f};
 
+  // Bounds in mesh space; a mesh may be shared by several nodes
   Mgtt::Rendering::AABB aabb;
 };
 
@@ -35,6 +35,7 @@
 #include <glm/gtc/type_ptr.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -65,25 +66,35 @@ struct Node {
 
   /**
    * @brief Compute the world-space transformation by walking up the parent
-   * chain.
+   * chain. Costs O(depth); Scene::transforms keeps all world matrices.
+   *
+   * @param nodes Node storage of the scene the node belongs to.
    */
-  [[nodiscard]] glm::mat4 GetGlobalMatrix() const;
+  [[nodiscard]] glm::mat4 GetGlobalMatrix(
+      const std::vector<Mgtt::Rendering::Node>& nodes) const;
 
-  /**
-   * @brief Propagate the global transform to mesh->matrix recursively.
-   */
-  void InitialTransform();
+  static constexpr uint32_t kNoParent = UINT32_MAX;
 
   std::string name;
-  std::weak_ptr<Mgtt::Rendering::Node> parent;
+  // Indices into Scene::nodes
+  uint32_t parent{kNoParent};
+  std::vector<uint32_t> children;
+  // Shared between the nodes instancing the mesh and its InstanceBatch
   std::shared_ptr<Mgtt::Rendering::Mesh> mesh;
-  std::vector<std::shared_ptr<Mgtt::Rendering::Node>> children;
 
   glm::vec3 pos{0.0f};
   glm::quat rot{1.0f, 0.0f, 0.0f, 0.0f};
   glm::vec3 scale{1.0f};
   glm::mat4 matrix{1.0f};
   uint32_t index{0};
+
+  // World transform of the node, shared meshes are drawn with it
+  glm::mat4 worldMatrix{1.0f};
+  // World-space bounds of mesh under worldMatrix and all instances
+  Mgtt::Rendering::AABB aabb;
+  // Local instance transforms (EXT_mesh_gpu_instancing). If not empty, the
+  // mesh is drawn once per entry with worldMatrix * instanceMatrices[i]
+  std::vector<glm::mat4> instanceMatrices;
 };
 
 }  // namespace Mgtt::Rendering
@@ -29,9 +29,12 @@
 #endif
 
 #include <aabb.h>
+#include <instance-batch.h>
 #include <node.h>
 #include <opengl-shader.h>
+#include <shared-geometry.h>
 #include <texture.h>
+#include <transform-hierarchy.h>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -67,6 +70,17 @@ struct Scene {
    */
   void Clear();
 
+  /**
+   * @brief Append a node to the scene and link it below parent.
+   *
+   * Appending may reallocate nodes, so hold on to indices rather than
+   * references while building the graph.
+   *
+   * @param parent Index of the parent node, Node::kNoParent for a root.
+   * @return Index of the new node in nodes.
+   */
+  uint32_t AddNode(uint32_t parent = Mgtt::Rendering::Node::kNoParent);
+
   std::string name;
   std::string path;
   glm::vec3 pos{0.0f};
@@ -78,20 +92,20 @@ struct Scene {
   // Prevents loading the same texture into RAM more than once
   std::map<std::string, Mgtt::Rendering::Texture> textureMap;
 
-  std::vector<std::shared_ptr<Mgtt::Rendering::Node>> nodes;
-  std::vector<std::shared_ptr<Mgtt::Rendering::Node>> linearNodes;
+  // All nodes of the scene, contiguous and indexed by Node::parent and
+  // Node::children. A parent always precedes its children.
+  std::vector<Mgtt::Rendering::Node> nodes;
+  std::vector<uint32_t> rootNodes;
+  // Flattened node transforms, built by the importers
+  Mgtt::Rendering::TransformHierarchy transforms;
   std::vector<Mgtt::Rendering::PbrMaterial> materials;
+  // One batch per distinct mesh, filled by SceneUploader::Upload()
+  std::vector<Mgtt::Rendering::InstanceBatch> instanceBatches;
+  // Buffers of all meshes when uploaded in shared-buffer mode
+  Mgtt::Rendering::SharedGeometry sharedGeometry;
 
   Mgtt::Rendering::AABB aabb;
   Mgtt::Rendering::OpenGlShader shader;
-
- private:
-  /**
-   * @brief Recursively flatten the scene hierarchy into linearNodes.
-   *
-   * @param node Root of the subtree to linearize.
-   */
-  void Linearize(const std::shared_ptr<Mgtt::Rendering::Node>& node);
 };
 
 }  // namespace Mgtt::Rendering
@@ -0,0 +1,69 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#ifdef __EMSCRIPTEN__
+#include <GLES3/gl3.h>
+#else
+#include <GL/glew.h>
+#endif
+
+#include <cstdint>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Scene-wide vertex, index and instance buffers behind one VAO.
+ *
+ * Filled by SceneUploader in shared-buffer mode. Every mesh occupies a range
+ * of the buffers starting at Mesh::baseVertex and Mesh::baseIndex, and every
+ * instance batch a range of instanceVbo starting at
+ * InstanceBatch::firstInstance.
+ */
+struct SharedGeometry {
+  SharedGeometry() = default;
+  ~SharedGeometry() noexcept;
+
+  SharedGeometry(const SharedGeometry&) = delete;
+  SharedGeometry& operator=(const SharedGeometry&) = delete;
+  SharedGeometry(SharedGeometry&&) noexcept;
+  SharedGeometry& operator=(SharedGeometry&&) noexcept;
+
+  void Clear();
+
+  uint32_t vao{0};
+  uint32_t ebo{0};
+  uint32_t pos{0};
+  uint32_t normal{0};
+  uint32_t tex{0};
+  uint32_t tangent{0};
+  uint32_t instanceVbo{0};
+
+  // First location of the inInstanceMatrix attribute, -1 if unused
+  int32_t instanceLocation{-1};
+  // pos holds interleaved PackedVertex data, normal, tex and tangent are
+  // unused
+  bool packedVertices{false};
+};
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,127 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <glm/glm.hpp>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/quaternion.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+struct Node;
+
+/**
+ * @brief Flattened transform store of a scene's node hierarchy.
+ *
+ * Local transforms, world matrices and dirty flags live in parallel arrays
+ * indexed by slot. Slots follow depth-first pre-order, so every parent
+ * precedes its children and each subtree occupies a contiguous slot range.
+ * Update() walks the slots once and recomputes only the subtrees of dirty
+ * nodes, each world matrix from its already updated parent, and writes the
+ * result back to the scene's nodes.
+ */
+class TransformHierarchy {
+ public:
+  static constexpr uint32_t kNoParent = UINT32_MAX;
+
+  /**
+   * @brief Flatten the hierarchy below roots and compute all world matrices.
+   *
+   * @param nodes Node storage of the scene, receives the world matrices.
+   * @param roots Indices of the root nodes.
+   */
+  void Build(std::vector<Mgtt::Rendering::Node>& nodes,
+             const std::vector<uint32_t>& roots);
+
+  void Clear() noexcept;
+
+  /**
+   * @brief Recompute the world matrices of dirty nodes and their
+   * descendants and write them and the local transforms back to nodes.
+   *
+   * @param nodes The node storage passed to Build().
+   * @return Number of world matrices recomputed, 0 if nothing was dirty.
+   */
+  size_t Update(std::vector<Mgtt::Rendering::Node>& nodes);
+
+  [[nodiscard]] size_t Size() const noexcept { return nodeIndices_.size(); }
+
+  [[nodiscard]] uint32_t GetParent(size_t slot) const {
+    return parents_[slot];
+  }
+
+  /**
+   * @brief Index into Scene::nodes of the node at slot.
+   */
+  [[nodiscard]] uint32_t GetNodeIndex(size_t slot) const {
+    return nodeIndices_[slot];
+  }
+
+  [[nodiscard]] const glm::mat4& GetWorldMatrix(size_t slot) const {
+    return worldMatrices_[slot];
+  }
+
+  /**
+   * @brief One past the last slot of the subtree rooted at slot.
+   */
+  [[nodiscard]] size_t GetSubtreeEnd(size_t slot) const {
+    return subtreeEnds_[slot];
+  }
+
+  [[nodiscard]] bool IsDirty(size_t slot) const { return dirty_[slot] != 0; }
+
+  /**
+   * @brief Setters update the slot's local transform and mark it dirty.
+   * The node and world matrices change on the next Update().
+   */
+  void SetTranslation(size_t slot, const glm::vec3& translation);
+  void SetRotation(size_t slot, const glm::quat& rotation);
+  void SetScale(size_t slot, const glm::vec3& scale);
+  void SetMatrix(size_t slot, const glm::mat4& matrix);
+
+ private:
+  void MarkDirty(size_t slot) noexcept;
+
+  /**
+   * @brief translation * rotation * scale * matrix of one slot, the same
+   * product as Node::LocalMatrix().
+   */
+  [[nodiscard]] glm::mat4 LocalMatrix(size_t slot) const;
+
+  std::vector<uint32_t> parents_;
+  std::vector<uint32_t> subtreeEnds_;
+  std::vector<glm::vec3> translations_;
+  std::vector<glm::quat> rotations_;
+  std::vector<glm::vec3> scales_;
+  std::vector<glm::mat4> matrices_;
+  std::vector<glm::mat4> worldMatrices_;
+  std::vector<uint8_t> dirty_;
+  std::vector<uint32_t> nodeIndices_;
+  // Lowest dirty slot, Size() if none
+  size_t firstDirty_{0};
+};
+
+}  // namespace Mgtt::Rendering
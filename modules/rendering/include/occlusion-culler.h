@@ -0,0 +1,167 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <aabb.h>
+#include <mesh.h>
+#include <worker-pool.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Software occlusion culling against a low-resolution depth buffer.
+ *
+ * Each frame, large primitives or their coarsest LOD are queued as
+ * occluders and rasterized on the CPU into a small depth buffer. Every
+ * other primitive is then tested by comparing the nearest depth of its
+ * screen-space bounding rectangle against the buffer. Occluders write the
+ * farthest depth of each triangle and tests accept ties, so nothing that
+ * could be visible is rejected.
+ *
+ * The buffer is split into bands of kBandRows rows that are rasterized in
+ * parallel on a worker pool kept across frames, four pixels at a time with
+ * SSE2 where available.
+ */
+class OcclusionCuller {
+ public:
+  static constexpr uint32_t kBandRows = 16;
+  static constexpr uint32_t kDefaultWidth = 256;
+  static constexpr uint32_t kDefaultHeight = 144;
+
+  OcclusionCuller() { Resize(kDefaultWidth, kDefaultHeight); }
+
+  /**
+   * @brief Set the buffer size. The width is rounded up to a multiple of 4.
+   */
+  void Resize(uint32_t width, uint32_t height);
+
+  /**
+   * @brief Worker threads used by Rasterize(), 0 or 1 for the calling
+   * thread. The threads are started here and reused every frame.
+   */
+  void SetThreadCount(uint32_t threadCount) {
+    workers_.SetThreadCount(threadCount);
+  }
+
+  /**
+   * @brief Drop the occluders of the previous frame and clear the buffer.
+   *
+   * @param viewProjection Transform from world to clip space.
+   */
+  void BeginFrame(const glm::mat4& viewProjection);
+
+  /**
+   * @brief Fraction of the screen covered by the bounding rectangle of a
+   * box, 0 if the box reaches behind the camera.
+   */
+  [[nodiscard]] float GetScreenCoverage(
+      const Mgtt::Rendering::AABB& bounds) const;
+
+  /**
+   * @brief Queue a triangle range of a mesh as occluder. The mesh must stay
+   * alive until Rasterize() returns.
+   *
+   * @param mesh       Mesh providing positions and indices.
+   * @param firstIndex First index of the range in Mesh::indices.
+   * @param indexCount Number of indices, a multiple of 3.
+   * @param model      Transform from mesh to world space.
+   */
+  void AddOccluder(const Mgtt::Rendering::Mesh& mesh, uint32_t firstIndex,
+                   uint32_t indexCount, const glm::mat4& model);
+
+  /**
+   * @brief Rasterize the queued occluders into the depth buffer.
+   *
+   * @return Number of triangles rasterized. Triangles reaching behind the
+   * near plane are skipped.
+   */
+  size_t Rasterize();
+
+  /**
+   * @brief Whether a box may be visible past the rasterized occluders.
+   *
+   * @param bounds World-space box.
+   * @return False only if every pixel of its bounding rectangle is nearer
+   * than the box.
+   */
+  [[nodiscard]] bool IsVisible(const Mgtt::Rendering::AABB& bounds) const;
+
+  [[nodiscard]] uint32_t GetWidth() const noexcept { return width_; }
+  [[nodiscard]] uint32_t GetHeight() const noexcept { return height_; }
+
+  /**
+   * @brief Depth in [0, 1] of a pixel, row 0 at the bottom; 1 where no
+   * occluder was drawn.
+   */
+  [[nodiscard]] float GetDepth(uint32_t x, uint32_t y) const {
+    return depth_[static_cast<size_t>(y) * width_ + x];
+  }
+
+  [[nodiscard]] size_t GetOccluderCount() const noexcept {
+    return occluders_.size();
+  }
+
+ private:
+  struct Occluder {
+    const Mgtt::Rendering::Mesh* mesh;
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    glm::mat4 clip;
+  };
+
+  // Pixel coordinates, counter-clockwise, with the farthest vertex depth
+  struct ScreenTriangle {
+    glm::vec2 v0;
+    glm::vec2 v1;
+    glm::vec2 v2;
+    float depth;
+  };
+
+  /**
+   * @brief Pixel rectangle and nearest depth of a box.
+   *
+   * @return False if the box reaches behind the near plane.
+   */
+  bool ProjectBounds(const Mgtt::Rendering::AABB& bounds, glm::vec2& min,
+                     glm::vec2& max, float& nearest) const;
+
+  void SetupTriangles(const Occluder& occluder,
+                      std::vector<ScreenTriangle>& triangles) const;
+  void RasterizeBand(uint32_t band);
+
+  uint32_t width_{0};
+  uint32_t height_{0};
+  glm::mat4 viewProjection_{1.0f};
+  std::vector<float> depth_;
+  std::vector<Occluder> occluders_;
+  // Screen triangles of each occluder, filled by Rasterize()
+  std::vector<std::vector<ScreenTriangle>> triangles_;
+  Mgtt::Rendering::WorkerPool workers_;
+};
+
+}  // namespace Mgtt::Rendering
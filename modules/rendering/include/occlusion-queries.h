@@ -0,0 +1,168 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#ifdef __EMSCRIPTEN__
+#include <GLES3/gl3.h>
+#else
+#include <GL/glew.h>
+#endif
+#include <frustum-culler.h>
+#include <opengl-shader.h>
+#include <result.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <glm/glm.hpp>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Query activity of the last OcclusionQueries::BeginFrame() and
+ * IssueQueries().
+ */
+struct OcclusionQueryStats {
+  uint32_t issued{0};
+  uint32_t read{0};
+  // Issued but not yet available
+  uint32_t pending{0};
+  // Frames between issuing and reading the results read this frame
+  float averageLatency{0.0f};
+  uint32_t maxLatency{0};
+};
+
+/**
+ * @brief Hardware occlusion queries on the bounds of primitive draws, with
+ * temporal coherence in the style of CHC++.
+ *
+ * After the scene is drawn, the bounding box of each draw due for a test
+ * is rasterized against the depth buffer inside a GL_ANY_SAMPLES_PASSED
+ * query. Results are read at the start of later frames, only once the GPU
+ * reports them available, so the CPU never waits. A draw is skipped while
+ * its latest result says occluded; hidden draws are tested every frame and
+ * visible ones every kVisibleQueryInterval frames, staggered by draw.
+ * Draws that became visible are drawn again as soon as their result has
+ * been read, usually one or two frames later.
+ */
+class OcclusionQueries {
+ public:
+  static constexpr uint32_t kVisibleQueryInterval = 4;
+  // Draws without a result for this many frames count as visible
+  static constexpr uint32_t kStaleFrames = 8;
+
+  OcclusionQueries() noexcept = default;
+  ~OcclusionQueries() noexcept { Clear(); }
+
+  OcclusionQueries(const OcclusionQueries&) = delete;
+  OcclusionQueries& operator=(const OcclusionQueries&) = delete;
+  OcclusionQueries(OcclusionQueries&&) = delete;
+  OcclusionQueries& operator=(OcclusionQueries&&) = delete;
+
+  /**
+   * @brief Compile the bounds shader and create the box geometry. Needs a
+   * current GL context.
+   *
+   * @param shaderPaths Vertex and fragment shader of the bounding boxes.
+   * @return Err if the shader does not compile.
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> Init(
+      const std::pair<std::string_view, std::string_view>& shaderPaths);
+
+  /**
+   * @brief Delete all GL objects.
+   */
+  void Clear() noexcept;
+
+  /**
+   * @brief Forget all results, e.g. after the draws were rebuilt. Queries
+   * still in flight are read and dropped.
+   *
+   * @param drawCount Number of draws, FrustumCuller::Size().
+   */
+  void Reset(size_t drawCount);
+
+  /**
+   * @brief Start a frame and read every query result already available.
+   */
+  void BeginFrame();
+
+  /**
+   * @brief Whether a draw was visible in its latest result.
+   */
+  [[nodiscard]] bool IsVisible(size_t draw) const;
+
+  /**
+   * @brief Query the bounds of the draws in the frustum that are due for a
+   * test. Call after the scene is drawn; color, depth writes and face
+   * culling are restored afterwards.
+   *
+   * @param mvp    Transform from the space of the draw bounds to clip
+   *               space.
+   * @param culler Draw bounds and frustum visibility of this frame.
+   */
+  void IssueQueries(const glm::mat4& mvp,
+                    const Mgtt::Rendering::FrustumCuller& culler);
+
+  [[nodiscard]] const Mgtt::Rendering::OcclusionQueryStats& GetStats()
+      const noexcept {
+    return stats_;
+  }
+
+ private:
+  // Draw index of queries issued before the last Reset()
+  static constexpr uint32_t kDroppedDraw = UINT32_MAX;
+  // Result frame of draws never tested; frames count from 1
+  static constexpr uint64_t kNoResult = 0;
+
+  struct PendingQuery {
+    GLuint query;
+    uint32_t draw;
+    uint64_t frame;
+  };
+
+  [[nodiscard]] bool IsDue(size_t draw) const;
+
+  Mgtt::Rendering::OpenGlShader shader_;
+  GLint mvpLocation_{-1};
+  GLint boundsMinLocation_{-1};
+  GLint boundsMaxLocation_{-1};
+  GLuint cubeVao_{0};
+  GLuint cubeVbo_{0};
+  GLuint cubeEbo_{0};
+
+  // Query objects not in flight, reused before generating new ones
+  std::vector<GLuint> freeQueries_;
+  // In issue order, which is also the order results become available
+  std::deque<PendingQuery> pending_;
+  std::vector<uint8_t> visible_;
+  std::vector<uint8_t> inFlight_;
+  std::vector<uint64_t> resultFrames_;
+  uint64_t frame_{0};
+  Mgtt::Rendering::OcclusionQueryStats stats_;
+};
+
+}  // namespace Mgtt::Rendering
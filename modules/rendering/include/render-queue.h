@@ -0,0 +1,185 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <instance-batch.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Passes in submission order.
+ */
+enum class RenderPass : uint8_t { Opaque = 0, Mask = 1, Blend = 2 };
+
+/**
+ * @brief Index range drawn for a queued draw.
+ */
+struct IndexRange {
+  uint32_t firstIndex{0};
+  uint32_t indexCount{0};
+};
+
+/**
+ * @brief One primitive of one instance batch, with the index ranges that
+ * survived LOD selection and culling.
+ */
+struct DrawItem {
+  uint64_t key{0};
+  uint32_t batch{0};
+  uint32_t primitive{0};
+  // Ranges are RenderQueue::GetRange(firstRange + i) for i < rangeCount
+  uint32_t firstRange{0};
+  uint32_t rangeCount{0};
+};
+
+/**
+ * @brief Collects the draws of a frame and orders them to minimize GL state
+ * changes.
+ *
+ * Every draw gets a 64-bit key; from the most significant bits down it
+ * holds pass, shader, material, texture set, VAO and depth, so sorting
+ * the keys groups draws by the state that is most expensive to change
+ * and orders draws sharing all state front to back. Blended draws keep
+ * the pass but put the inverted depth right below it, so they are drawn
+ * back to front. Keys are sorted with an LSD radix sort, one byte per
+ * pass; bytes equal in all keys are skipped.
+ *
+ * Material ids number the distinct sets of material factors and texture
+ * set ids the distinct combinations of texture objects, so draws that
+ * would set the same uniforms or bind the same textures get the same id.
+ * Ids past what their field holds share the largest value.
+ */
+class RenderQueue {
+ public:
+  static constexpr uint32_t kShaderBits = 4;
+  static constexpr uint32_t kMaterialBits = 14;
+  static constexpr uint32_t kTextureSetBits = 12;
+  static constexpr uint32_t kVaoBits = 10;
+  static constexpr uint32_t kDepthBits = 22;
+
+  /**
+   * @brief Pack the sort key of a draw.
+   *
+   * @param pass       Pass of the draw material.
+   * @param shader     Program variant.
+   * @param material   Id from GetMaterialId().
+   * @param textureSet Id from GetTextureSetId().
+   * @param vao        GL name of the vertex array; only the low bits are
+   *                   kept.
+   * @param depth      Distance from the camera mapped to [0, 1].
+   * @return Key that sorts in submission order.
+   */
+  [[nodiscard]] static uint64_t MakeKey(Mgtt::Rendering::RenderPass pass,
+                                        uint32_t shader, uint32_t material,
+                                        uint32_t textureSet, uint32_t vao,
+                                        float depth);
+
+  /**
+   * @brief Pass of a material from its alpha mode.
+   */
+  [[nodiscard]] static Mgtt::Rendering::RenderPass GetPass(
+      const Mgtt::Rendering::PbrMaterial& material);
+
+  /**
+   * @brief Number the materials and texture sets of every primitive. Call
+   * again when the batches change or their textures are uploaded.
+   *
+   * @param batches Instance batches of the scene.
+   */
+  void AssignStateIds(
+      const std::vector<Mgtt::Rendering::InstanceBatch>& batches);
+
+  [[nodiscard]] uint32_t GetMaterialId(size_t batch, size_t primitive) const {
+    return materialIds_[firstPrimitives_[batch] + primitive];
+  }
+
+  [[nodiscard]] uint32_t GetTextureSetId(size_t batch,
+                                         size_t primitive) const {
+    return textureSetIds_[firstPrimitives_[batch] + primitive];
+  }
+
+  [[nodiscard]] uint32_t GetMaterialCount() const noexcept {
+    return materialCount_;
+  }
+
+  [[nodiscard]] uint32_t GetTextureSetCount() const noexcept {
+    return textureSetCount_;
+  }
+
+  /**
+   * @brief Drop the draws of the previous frame; state ids are kept.
+   */
+  void BeginFrame() noexcept;
+
+  /**
+   * @brief Drop draws and state ids.
+   */
+  void Clear() noexcept;
+
+  /**
+   * @brief Add an index range to the next draw pushed.
+   */
+  void AddRange(uint32_t firstIndex, uint32_t indexCount);
+
+  /**
+   * @brief Queue a draw with the ranges added since the previous Push().
+   * Draws without ranges are dropped.
+   */
+  void Push(uint64_t key, uint32_t batch, uint32_t primitive);
+
+  /**
+   * @brief Order the queued draws by ascending key; draws with equal keys
+   * keep their order.
+   */
+  void Sort();
+
+  [[nodiscard]] const std::vector<Mgtt::Rendering::DrawItem>& GetItems()
+      const noexcept {
+    return items_;
+  }
+
+  [[nodiscard]] const Mgtt::Rendering::IndexRange& GetRange(
+      size_t range) const {
+    return ranges_[range];
+  }
+
+ private:
+  std::vector<Mgtt::Rendering::DrawItem> items_;
+  // Radix sort buffer, kept to avoid reallocating every frame
+  std::vector<Mgtt::Rendering::DrawItem> sorted_;
+  std::vector<Mgtt::Rendering::IndexRange> ranges_;
+  // First range of the draw pushed next
+  uint32_t pendingRange_{0};
+
+  std::vector<size_t> firstPrimitives_;
+  std::vector<uint32_t> materialIds_;
+  std::vector<uint32_t> textureSetIds_;
+  uint32_t materialCount_{0};
+  uint32_t textureSetCount_{0};
+};
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,190 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <result.h>
+#include <scene.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Versioned on-disk cache of fully converted scenes.
+ *
+ * An entry holds everything an importer produces on the CPU: the flat node
+ * array, mesh vertex and index arrays, material parameters and the
+ * decoded texture pixels. Entries are keyed by the absolute source path
+ * and invalidated when the modification time or size of the source file
+ * or of any external file it was imported from changes, or when
+ * kFormatVersion is bumped. Reading an entry maps the
+ * file and copies the arrays out in bulk; no glTF/USD parsing and no image
+ * decoding take place. Once the entries of the directory exceed the size
+ * limit, the least recently loaded or saved ones are evicted.
+ */
+class SceneCache {
+ public:
+  /**
+   * @brief Bump whenever the serialized layout changes.
+   */
+  static constexpr uint32_t kFormatVersion = 8;
+
+  /**
+   * @brief Default cap on the total size of the entries in the directory.
+   */
+  static constexpr uint64_t kDefaultSizeLimit = uint64_t{2} << 30;
+
+  SceneCache();
+  ~SceneCache() noexcept;
+
+  SceneCache(const SceneCache&) = delete;
+  SceneCache& operator=(const SceneCache&) = delete;
+  SceneCache(SceneCache&&) noexcept;
+  SceneCache& operator=(SceneCache&&) noexcept;
+
+  /**
+   * @brief Set the directory holding the cache entries.
+   *
+   * An empty directory disables the cache. The directory is created on the
+   * first Save().
+   *
+   * @param directory Cache directory.
+   */
+  void SetDirectory(std::string_view directory);
+
+  [[nodiscard]] const std::string& GetDirectory() const noexcept;
+
+  /**
+   * @brief Whether a cache directory is set.
+   */
+  [[nodiscard]] bool IsEnabled() const noexcept;
+
+  /**
+   * @brief Set the import options baked into entries written by Save().
+   *
+   * Load() misses entries written with different options, so changing an
+   * import option does not serve scenes processed the other way.
+   *
+   * @param options Opaque description of the options, see
+   * ISceneImporter::GetImportOptions().
+   */
+  void SetImportOptions(std::string_view options);
+
+  [[nodiscard]] const std::string& GetImportOptions() const noexcept;
+
+  /**
+   * @brief Cap the total size of the entries in the directory.
+   *
+   * Every write evicts the least recently used entries until the rest fit,
+   * never the entry just written.
+   *
+   * @param bytes Size limit, 0 for no limit.
+   */
+  void SetSizeLimit(uint64_t bytes) noexcept;
+
+  [[nodiscard]] uint64_t GetSizeLimit() const noexcept;
+
+  /**
+   * @brief Path of the cache entry for a source file.
+   *
+   * @param sourcePath Path to the .gltf/.glb/.usd* source.
+   */
+  [[nodiscard]] std::string EntryPath(std::string_view sourcePath) const;
+
+  /**
+   * @brief Populate the scene from the cache entry of a source file.
+   *
+   * The shader of the scene is left untouched. On failure the scene is not
+   * modified. A hit marks the entry as most recently used. Entries queued by
+   * SaveAsync() are only seen after Flush().
+   *
+   * @param scene      Scene to populate.
+   * @param sourcePath Path to the source the entry was created from.
+   * @return Ok on a cache hit, Err on a miss, a stale or a corrupt entry.
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> Load(
+      Mgtt::Rendering::Scene& scene, std::string_view sourcePath) const;
+
+  /**
+   * @brief Write the CPU-side data of a freshly imported scene.
+   *
+   * Must be called before SceneUploader::Upload(), which releases the
+   * texture pixels.
+   *
+   * @param scene        Scene to serialize.
+   * @param sourcePath   Path to the source the scene was imported from.
+   * @param dependencies External files the source pulled in, such as
+   *                     buffers, images or layers. Load() misses once any of
+   *                     them changes, appears or disappears.
+   * @return Ok on success, Err with a descriptive message on failure.
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> Save(
+      const Mgtt::Rendering::Scene& scene, std::string_view sourcePath,
+      const std::vector<std::string>& dependencies = {}) const;
+
+  /**
+   * @brief Serialize a freshly imported scene and write it on a background
+   * thread.
+   *
+   * Only the in-memory encoding runs on the calling thread, so the scene
+   * may be uploaded as soon as this returns. Builds for Emscripten without
+   * pthreads and a moved-from cache write synchronously.
+   *
+   * @param scene        Scene to serialize.
+   * @param sourcePath   Path to the source the scene was imported from.
+   * @param dependencies External files the source pulled in, see Save().
+   * @return Ok once queued, Err if the scene cannot be encoded. Write
+   * failures are reported by Flush().
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> SaveAsync(
+      const Mgtt::Rendering::Scene& scene, std::string_view sourcePath,
+      const std::vector<std::string>& dependencies = {}) const;
+
+  /**
+   * @brief Wait until every entry queued by SaveAsync() is written.
+   *
+   * @return Ok, or Err with the first write failure since the last Flush().
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> Flush() const;
+
+ private:
+  struct WriteQueue;
+
+  /**
+   * @brief Serialize a scene into the bytes of its cache entry.
+   */
+  [[nodiscard]] Mgtt::Common::Result<std::string> Encode(
+      const Mgtt::Rendering::Scene& scene, std::string_view sourcePath,
+      const std::vector<std::string>& dependencies) const;
+
+  std::string directory_;
+  std::string importOptions_;
+  uint64_t sizeLimit_{kDefaultSizeLimit};
+  std::unique_ptr<WriteQueue> writeQueue_;
+};
+
+}  // namespace Mgtt::Rendering
@@ -31,9 +31,27 @@
 #include <scene.h>
 #include <stb_image.h>
 #include <texture.h>
+#include <vertex-packing.h>
+
+#include <chrono>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace Mgtt::Rendering {
 
+/**
+ * @brief Limit for one SceneUploader::UploadStep() call.
+ *
+ * A zero field does not limit. Each call uploads at least one pending item,
+ * so an item larger than the budget still makes progress.
+ */
+struct UploadBudget {
+  size_t bytes{0};
+  std::chrono::microseconds time{0};
+};
+
 /**
  * @brief Uploads a CPU-side parsed scene to the GPU.
  *
@@ -54,13 +72,106 @@ class SceneUploader {
   /**
    * @brief Upload all textures and meshes in the scene to the GPU.
    *
+   * Also rebuilds Scene::instanceBatches: one batch per distinct mesh,
+   * holding the world matrices of all nodes that reference it.
+   *
    * @param scene Scene whose textureMap and nodes will be uploaded.
    * @return Ok on success, Err with a descriptive message on failure.
    */
   [[nodiscard]] Mgtt::Common::Result<void> Upload(
       Mgtt::Rendering::Scene& scene);
 
+  /**
+   * @brief Start an incremental upload of the scene.
+   *
+   * Rebuilds Scene::instanceBatches and queues every texture and batch. Each
+   * batch is queued right behind the textures its materials use, so it
+   * becomes drawable as soon as its own data is resident. Batches whose
+   * mesh vao is still 0 are not uploaded yet. Replaces any pending queue.
+   *
+   * @param scene Scene whose textureMap and nodes will be uploaded.
+   */
+  void BeginUpload(Mgtt::Rendering::Scene& scene);
+
+  /**
+   * @brief Upload queued items until the budget is used up.
+   *
+   * @param scene  The scene passed to BeginUpload(). It may have been moved.
+   * @param budget Bytes and time this call may spend.
+   * @return Ok(true) once the queue is empty, Ok(false) while items remain,
+   * Err if a mesh could not be uploaded. The queue is dropped on Err.
+   */
+  [[nodiscard]] Mgtt::Common::Result<bool> UploadStep(
+      Mgtt::Rendering::Scene& scene, const UploadBudget& budget);
+
+  /**
+   * @brief Suballocate all meshes of a scene from shared buffers.
+   *
+   * When enabled, BeginUpload() allocates Scene::sharedGeometry: one VAO with
+   * scene-wide vertex, index and instance buffers. Each mesh is then written
+   * into its range at baseVertex and baseIndex, so the whole scene needs a
+   * handful of GL objects instead of five per mesh, and draws go through
+   * glDrawElementsInstancedBaseVertex. On WebGL the indices are rebased at
+   * upload instead, since base-vertex draws are not available there. Each
+   * mesh keeps its own Mesh::indexType within the shared index buffer.
+   *
+   * @param enabled True to use shared buffers for subsequent uploads.
+   */
+  void SetSharedBuffers(bool enabled) noexcept;
+
+  /**
+   * @brief Whether meshes are suballocated from shared buffers.
+   */
+  [[nodiscard]] bool IsSharedBuffers() const noexcept;
+
+  /**
+   * @brief Upload vertices in the interleaved 20-byte PackedVertex layout
+   * instead of four float buffers (48 bytes per vertex).
+   *
+   * Packed meshes need a shader that restores positions from the
+   * positionOffset and positionScale uniforms, see pbr-packed.vert.
+   *
+   * @param enabled True to pack vertices of subsequent uploads.
+   */
+  void SetPackedVertices(bool enabled) noexcept;
+
+  /**
+   * @brief Whether vertices are uploaded in the packed layout.
+   */
+  [[nodiscard]] bool IsPackedVertices() const noexcept;
+
+  /**
+   * @brief Refresh the instance matrices of all uploaded batches from the
+   * current node world matrices.
+   *
+   * Call after Scene::transforms.Update() reported changes. Instance counts
+   * must be unchanged since BeginUpload(), only the matrices are rewritten.
+   *
+   * @param scene Fully uploaded scene with a built transform hierarchy.
+   */
+  void UpdateInstanceMatrices(Mgtt::Rendering::Scene& scene);
+
+  /**
+   * @brief Whether items queued by BeginUpload() remain.
+   */
+  [[nodiscard]] bool IsUploading() const noexcept;
+
+  /**
+   * @brief Bytes still queued for upload.
+   */
+  [[nodiscard]] size_t GetPendingBytes() const noexcept;
+
  private:
+  /**
+   * @brief One queued upload: a textureMap entry, or an instance batch if
+   * textureKey is empty.
+   */
+  struct UploadTask {
+    std::string textureKey;
+    size_t batchIndex{0};
+    size_t bytes{0};
+  };
+
   /**
    * @brief Allocate a GL texture from already-loaded CPU image data.
    *
@@ -79,18 +190,64 @@ class SceneUploader {
       std::shared_ptr<Mgtt::Rendering::Mesh>& mesh, uint32_t shaderId);
 
   /**
-   * @brief Recursively upload meshes for a node and its children.
+   * @brief Point the vertex attributes at interleaved PackedVertex data in
+   * the bound GL_ARRAY_BUFFER.
    *
-   * @param node    Root of the subtree to upload.
-   * @param shaderId Compiled shader program id.
-   * @return Ok on success, Err if any mesh upload fails.
+   * @param shaderId Compiled shader program whose attribute locations are used.
    */
-  [[nodiscard]] Mgtt::Common::Result<void> UploadNode(
-      const std::shared_ptr<Mgtt::Rendering::Node>& node, uint32_t shaderId);
+  void SetPackedAttribPointers(uint32_t shaderId);
+
+  /**
+   * @brief Create Scene::sharedGeometry sized for all instance batches and
+   * assign every mesh and batch its range.
+   *
+   * @param scene Scene whose instanceBatches have been collected.
+   */
+  void AllocateSharedGeometry(Mgtt::Rendering::Scene& scene);
+
+  /**
+   * @brief Write the mesh and instance data of a batch into its ranges of
+   * Scene::sharedGeometry.
+   *
+   * @param scene Scene owning the shared geometry.
+   * @param batch Batch whose ranges were assigned by AllocateSharedGeometry.
+   * @return Ok on success, Err if the mesh is in an invalid state.
+   */
+  [[nodiscard]] Mgtt::Common::Result<void> UploadSharedMesh(
+      Mgtt::Rendering::Scene& scene, Mgtt::Rendering::InstanceBatch& batch);
+
+  /**
+   * @brief Upload the instance matrices of a batch and attach them to the
+   * mesh VAO as the per-instance attribute inInstanceMatrix.
+   *
+   * @param batch    Batch whose mesh has already been uploaded.
+   * @param shaderId Compiled shader program whose attribute locations are used.
+   */
+  void UploadInstanceBuffer(Mgtt::Rendering::InstanceBatch& batch,
+                            uint32_t shaderId);
+
+  /**
+   * @brief Append the world matrices of every node with a mesh, one per glTF
+   * GPU instance if it has any, to the batch of that mesh. Nodes are walked
+   * depth-first without recursion and batches are created in that order.
+   *
+   * @param scene        Scene whose nodes are collected.
+   * @param batches      Batches of the scene.
+   * @param batchIndices Index into batches for each mesh seen so far.
+   */
+  void CollectInstances(
+      const Mgtt::Rendering::Scene& scene,
+      std::vector<Mgtt::Rendering::InstanceBatch>& batches,
+      std::unordered_map<const Mgtt::Rendering::Mesh*, size_t>& batchIndices);
 
   void PatchMaterialIds(
-      const std::shared_ptr<Mgtt::Rendering::Node>& node,
+      Mgtt::Rendering::Mesh& mesh,
       const std::map<std::string, Mgtt::Rendering::Texture>& textureMap);
+
+  std::deque<UploadTask> pendingTasks_;
+  size_t pendingBytes_{0};
+  bool sharedBuffers_{false};
+  bool packedVertices_{false};
 };
 
 }  // namespace Mgtt::Rendering
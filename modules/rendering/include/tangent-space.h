@@ -0,0 +1,70 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mesh.h>
+#include <result.h>
+#include <scene.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Generate the normals and tangents a mesh is missing.
+ *
+ * Normals of zero length are replaced by the area-weighted sum of the
+ * adjacent face normals, so shared vertices get smooth normals and
+ * unshared ones the flat face normal. Tangents with w = 0 are derived from
+ * the texture coordinates, orthogonalized against the normal and given the
+ * bitangent sign in w. This follows the MikkTSpace convention that shaders
+ * rebuild the bitangent as cross(normal, tangent.xyz) * tangent.w from the
+ * interpolated, unnormalized vectors. Without usable texture coordinates a
+ * tangent is any unit vector perpendicular to the normal.
+ *
+ * Primitives with disjoint vertex ranges are processed in parallel and the
+ * face and vertex passes run four at a time with SSE2 where available.
+ * Non-indexed primitives are skipped.
+ *
+ * @param mesh        Mesh to complete in place.
+ * @param threadCount Worker threads, 0 or 1 runs on the calling thread.
+ * @return Number of vertices that received a normal or tangent, Err if an
+ * index is out of range or an attribute array does not match the vertex
+ * count.
+ */
+[[nodiscard]] Mgtt::Common::Result<size_t> GenerateTangentSpace(
+    Mgtt::Rendering::Mesh& mesh, uint32_t threadCount = 1);
+
+/**
+ * @brief Run GenerateTangentSpace() on every distinct mesh of a scene,
+ * sharing one pool of workers across all their primitives.
+ *
+ * @param scene       Scene whose meshes are completed in place.
+ * @param threadCount Worker threads, 0 or 1 runs on the calling thread.
+ * @return Number of vertices that received a normal or tangent.
+ */
+[[nodiscard]] Mgtt::Common::Result<size_t> GenerateTangentSpace(
+    Mgtt::Rendering::Scene& scene, uint32_t threadCount = 1);
+
+}  // namespace Mgtt::Rendering
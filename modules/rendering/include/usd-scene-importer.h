@@ -23,6 +23,7 @@
 #pragma once
 
 #include <iscene-importer.h>
+#include <scene-cache.h>
 
 #include <string>
 #include <string_view>
@@ -54,7 +55,27 @@ class UsdSceneImporter : public ISceneImporter {
 
   void Clear(Mgtt::Rendering::Scene& scene) noexcept override;
 
+  /**
+   * @brief Enable the binary scene cache.
+   *
+   * See GltfSceneImporter::SetCacheDirectory(). An empty directory disables
+   * the cache.
+   *
+   * @param directory Directory holding cache entries.
+   * @param sizeLimit Total size of the entries above which the least
+   *                  recently used are evicted, 0 for no limit.
+   */
+  void SetCacheDirectory(
+      std::string_view directory,
+      uint64_t sizeLimit = Mgtt::Rendering::SceneCache::kDefaultSizeLimit);
+
  private:
+  /**
+   * @brief Drop everything a failed or cancelled Load() produced, keeping the
+   * scene's shader.
+   */
+  void DiscardScene(Mgtt::Rendering::Scene& scene) noexcept;
+
   [[nodiscard]] Mgtt::Common::Result<void> LoadTextures(
       Mgtt::Rendering::Scene& scene,
       const tinyusdz::tydra::RenderScene& renderScene);
@@ -65,6 +86,8 @@ class UsdSceneImporter : public ISceneImporter {
   [[nodiscard]] Mgtt::Common::Result<void> LoadMeshes(
       Mgtt::Rendering::Scene& scene,
       const tinyusdz::tydra::RenderScene& renderScene);
+
+  Mgtt::Rendering::SceneCache sceneCache_;
 };
 
 }  // namespace Mgtt::Rendering
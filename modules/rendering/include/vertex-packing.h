@@ -0,0 +1,90 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mesh.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Interleaved 20-byte vertex used by packed uploads.
+ *
+ * Positions are normalized int16 relative to the mesh bounds and restored
+ * by the shader with the offset and scale from PackVertices(). Normals and
+ * tangents use GL_INT_2_10_10_10_REV, the tangent's bitangent sign in the
+ * 2-bit w, and texture coordinates are half floats.
+ */
+struct PackedVertex {
+  int16_t position[4];
+  uint32_t normal;
+  uint16_t textureCoordinates[2];
+  uint32_t tangent;
+};
+static_assert(sizeof(PackedVertex) == 20, "PackedVertex must be 20 bytes");
+
+/**
+ * @brief Convert a float to IEEE 754 half precision, rounding to nearest
+ * even. Values beyond the half range become infinity.
+ *
+ * @param value Value to convert.
+ * @return Bit pattern of the half float.
+ */
+[[nodiscard]] uint16_t FloatToHalf(float value);
+
+/**
+ * @brief Pack a unit vector into a signed normalized 2_10_10_10 value with
+ * w = 0.
+ *
+ * @param normal Vector with components in [-1, 1].
+ * @return Value for a GL_INT_2_10_10_10_REV attribute.
+ */
+[[nodiscard]] uint32_t PackNormal(const glm::vec3& normal);
+
+/**
+ * @brief Pack a tangent into a signed normalized 2_10_10_10 value.
+ *
+ * @param tangent Unit xyz and a bitangent sign in w; w = 0 stays 0.
+ * @return Value for a GL_INT_2_10_10_10_REV attribute.
+ */
+[[nodiscard]] uint32_t PackTangent(const glm::vec4& tangent);
+
+/**
+ * @brief Quantize the vertex attributes of a mesh into packed vertices.
+ *
+ * Missing normals, texture coordinates or tangents are packed as zero.
+ *
+ * @param mesh           Mesh whose CPU-side attributes are packed.
+ * @param positionOffset Receives the offset that restores positions.
+ * @param positionScale  Receives the scale that restores positions.
+ * @return One packed vertex per vertex position.
+ */
+[[nodiscard]] std::vector<PackedVertex> PackVertices(
+    const Mgtt::Rendering::Mesh& mesh, glm::vec3& positionOffset,
+    glm::vec3& positionScale);
+
+}  // namespace Mgtt::Rendering
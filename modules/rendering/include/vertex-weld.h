@@ -0,0 +1,52 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mesh.h>
+#include <result.h>
+
+#include <cstddef>
+
+namespace Mgtt::Rendering {
+
+/**
+ * @brief Merge duplicated vertices of a mesh and rebuild its indices.
+ *
+ * Two vertices are merged when every position, normal, texture coordinate
+ * and skin weight component differs by at most epsilon and their joint
+ * indices are equal. Candidates are looked up in a spatial hash of the
+ * positions, so the pass runs in linear time. Surviving vertices keep
+ * their relative order and MeshPrimitive::vertexCount is updated.
+ *
+ * Meshes with a non-indexed primitive are left untouched, since such a
+ * primitive addresses its vertices directly.
+ *
+ * @param mesh    Mesh to weld in place.
+ * @param epsilon Per-component tolerance, 0 merges exact duplicates only.
+ * @return Number of vertices removed, Err if an index is out of range or an
+ * attribute array does not match the vertex count.
+ */
+[[nodiscard]] Mgtt::Common::Result<size_t> WeldVertices(
+    Mgtt::Rendering::Mesh& mesh, float epsilon = 0.0f);
+
+}  // namespace Mgtt::Rendering
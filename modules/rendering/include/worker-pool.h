@@ -0,0 +1,159 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+namespace detail {
+
+/**
+ * @brief Call fn(idx) for the next unclaimed idx below count until none is
+ * left. Every worker of a loop runs this against the same counter.
+ */
+template <typename Fn>
+void DrainItems(std::atomic<size_t>& nextItem, size_t count, const Fn& fn) {
+  for (size_t idx = nextItem.fetch_add(1); idx < count;
+       idx = nextItem.fetch_add(1)) {
+    fn(idx);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Call fn(idx) for every idx below count, spread over up to
+ * threadCount workers that pull the next index until all are done.
+ *
+ * The calling thread is one of the workers; the others are started for this
+ * call and joined before it returns. Meant for one-off work such as a scene
+ * load, see WorkerPool for loops that run every frame. Builds for
+ * Emscripten without pthreads run the loop on the calling thread.
+ *
+ * @param count       Number of items.
+ * @param threadCount Maximum number of workers, 0 or 1 for the calling
+ *                    thread only.
+ * @param fn          Callable taking the item index, safe to run
+ *                    concurrently for distinct indices.
+ */
+template <typename Fn>
+void ParallelFor(size_t count, uint32_t threadCount, const Fn& fn) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  const size_t kWorkerCount = 1;
+#else
+  const size_t kWorkerCount = std::min<size_t>(threadCount, count);
+#endif
+  std::atomic<size_t> nextItem{0};
+  if (kWorkerCount <= 1) {
+    detail::DrainItems(nextItem, count, fn);
+    return;
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(kWorkerCount - 1);
+  for (size_t worker = 1; worker < kWorkerCount; ++worker) {
+    workers.emplace_back(
+        [&]() { detail::DrainItems(nextItem, count, fn); });
+  }
+  detail::DrainItems(nextItem, count, fn);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+/**
+ * @brief Persistent workers for parallel loops that run every frame.
+ *
+ * The threads are started by SetThreadCount() and sleep between loops, so
+ * a loop costs a wake-up instead of a thread start and join per worker.
+ * Loops must be issued from one thread at a time.
+ */
+class WorkerPool {
+ public:
+  WorkerPool() = default;
+  ~WorkerPool() noexcept;
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+  WorkerPool(WorkerPool&&) = delete;
+  WorkerPool& operator=(WorkerPool&&) = delete;
+
+  /**
+   * @brief Set the number of workers including the calling thread.
+   *
+   * Restarts the pool threads. Builds for Emscripten without pthreads keep
+   * running on the calling thread.
+   *
+   * @param threadCount Number of workers, 0 or 1 for the calling thread only.
+   */
+  void SetThreadCount(uint32_t threadCount);
+
+  [[nodiscard]] uint32_t GetThreadCount() const noexcept;
+
+  /**
+   * @brief Call fn(idx) for every idx below count on the calling thread and
+   * the pool threads, returning once all calls are done.
+   *
+   * @param count Number of items.
+   * @param fn    Callable taking the item index, safe to run concurrently
+   *              for distinct indices.
+   */
+  template <typename Fn>
+  void ParallelFor(size_t count, const Fn& fn) {
+    Run(count,
+        [](const void* context, size_t idx) {
+          (*static_cast<const Fn*>(context))(idx);
+        },
+        &fn);
+  }
+
+ private:
+  using ItemFn = void (*)(const void* context, size_t idx);
+
+  void Run(size_t count, ItemFn fn, const void* context);
+  void WorkerLoop(uint64_t seenGeneration);
+  void Stop() noexcept;
+
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  // Loop published to the pool threads, guarded by mutex_
+  ItemFn itemFn_{nullptr};
+  const void* context_{nullptr};
+  size_t count_{0};
+  uint64_t generation_{0};
+  size_t busyThreads_{0};
+  bool stop_{false};
+  std::atomic<size_t> nextItem_{0};
+};
+
+}  // namespace Mgtt::Rendering
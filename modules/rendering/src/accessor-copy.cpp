@@ -0,0 +1,214 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <accessor-copy.h>
+
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define MGTT_ACCESSOR_COPY_AVX2
+#define MGTT_ACCESSOR_COPY_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MGTT_ACCESSOR_COPY_SSE2
+#endif
+
+namespace Mgtt::Rendering {
+
+namespace {
+
+void CopyFloatTuples(const unsigned char* src, size_t count, size_t byteStride,
+                     size_t components, float* dst) {
+  const size_t kTupleBytes = components * sizeof(float);
+  if (count == 0) {
+    return;
+  }
+  if (byteStride == kTupleBytes) {
+    std::memcpy(dst, src, count * kTupleBytes);
+    return;
+  }
+
+  size_t idx = 0;
+#ifdef MGTT_ACCESSOR_COPY_SSE2
+  // A 16-byte load stays inside the source element when the stride covers
+  // it. The store spills into the next destination element, which is
+  // overwritten by the following iteration; the last element is copied by
+  // the scalar tail so nothing is written past dst.
+  if (byteStride >= sizeof(__m128)) {
+    for (; idx + 1 < count; ++idx) {
+      const __m128 kTuple =
+          _mm_loadu_ps(reinterpret_cast<const float*>(src + idx * byteStride));
+      _mm_storeu_ps(dst + idx * components, kTuple);
+    }
+  }
+#endif
+  for (; idx < count; ++idx) {
+    std::memcpy(dst + idx * components, src + idx * byteStride, kTupleBytes);
+  }
+}
+
+void WidenIndices(const uint8_t* src, size_t count, uint32_t baseVertex,
+                  uint32_t* dst) {
+  size_t idx = 0;
+#if defined(MGTT_ACCESSOR_COPY_AVX2)
+  const __m256i kBase = _mm256_set1_epi32(static_cast<int>(baseVertex));
+  for (; idx + 8 <= count; idx += 8) {
+    const __m128i kBytes =
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + idx));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(dst + idx),
+        _mm256_add_epi32(_mm256_cvtepu8_epi32(kBytes), kBase));
+  }
+#elif defined(MGTT_ACCESSOR_COPY_SSE2)
+  const __m128i kBase = _mm_set1_epi32(static_cast<int>(baseVertex));
+  const __m128i kZero = _mm_setzero_si128();
+  for (; idx + 16 <= count; idx += 16) {
+    const __m128i kBytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + idx));
+    const __m128i kLow = _mm_unpacklo_epi8(kBytes, kZero);
+    const __m128i kHigh = _mm_unpackhi_epi8(kBytes, kZero);
+    auto* out = reinterpret_cast<__m128i*>(dst + idx);
+    _mm_storeu_si128(out,
+                     _mm_add_epi32(_mm_unpacklo_epi16(kLow, kZero), kBase));
+    _mm_storeu_si128(out + 1,
+                     _mm_add_epi32(_mm_unpackhi_epi16(kLow, kZero), kBase));
+    _mm_storeu_si128(out + 2,
+                     _mm_add_epi32(_mm_unpacklo_epi16(kHigh, kZero), kBase));
+    _mm_storeu_si128(out + 3,
+                     _mm_add_epi32(_mm_unpackhi_epi16(kHigh, kZero), kBase));
+  }
+#endif
+  for (; idx < count; ++idx) {
+    dst[idx] = src[idx] + baseVertex;
+  }
+}
+
+void WidenIndices(const uint16_t* src, size_t count, uint32_t baseVertex,
+                  uint32_t* dst) {
+  size_t idx = 0;
+#if defined(MGTT_ACCESSOR_COPY_AVX2)
+  const __m256i kBase = _mm256_set1_epi32(static_cast<int>(baseVertex));
+  for (; idx + 8 <= count; idx += 8) {
+    const __m128i kShorts =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + idx));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(dst + idx),
+        _mm256_add_epi32(_mm256_cvtepu16_epi32(kShorts), kBase));
+  }
+#elif defined(MGTT_ACCESSOR_COPY_SSE2)
+  const __m128i kBase = _mm_set1_epi32(static_cast<int>(baseVertex));
+  const __m128i kZero = _mm_setzero_si128();
+  for (; idx + 8 <= count; idx += 8) {
+    const __m128i kShorts =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + idx));
+    auto* out = reinterpret_cast<__m128i*>(dst + idx);
+    _mm_storeu_si128(out,
+                     _mm_add_epi32(_mm_unpacklo_epi16(kShorts, kZero), kBase));
+    _mm_storeu_si128(out + 1,
+                     _mm_add_epi32(_mm_unpackhi_epi16(kShorts, kZero), kBase));
+  }
+#endif
+  for (; idx < count; ++idx) {
+    dst[idx] = src[idx] + baseVertex;
+  }
+}
+
+void WidenIndices(const uint32_t* src, size_t count, uint32_t baseVertex,
+                  uint32_t* dst) {
+  if (baseVertex == 0) {
+    std::memcpy(dst, src, count * sizeof(uint32_t));
+    return;
+  }
+  size_t idx = 0;
+#if defined(MGTT_ACCESSOR_COPY_AVX2)
+  const __m256i kBase = _mm256_set1_epi32(static_cast<int>(baseVertex));
+  for (; idx + 8 <= count; idx += 8) {
+    const __m256i kInts =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + idx));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + idx),
+                        _mm256_add_epi32(kInts, kBase));
+  }
+#elif defined(MGTT_ACCESSOR_COPY_SSE2)
+  const __m128i kBase = _mm_set1_epi32(static_cast<int>(baseVertex));
+  for (; idx + 4 <= count; idx += 4) {
+    const __m128i kInts =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + idx));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + idx),
+                     _mm_add_epi32(kInts, kBase));
+  }
+#endif
+  for (; idx < count; ++idx) {
+    dst[idx] = src[idx] + baseVertex;
+  }
+}
+
+}  // namespace
+
+void CopyAccessor(const unsigned char* src, size_t count, size_t byteStride,
+                  glm::vec3* dst) {
+  static_assert(sizeof(glm::vec3) == 3 * sizeof(float),
+                "glm::vec3 must be tightly packed");
+  CopyFloatTuples(src, count, byteStride, 3, &dst->x);
+}
+
+void CopyAccessor(const unsigned char* src, size_t count, size_t byteStride,
+                  glm::vec2* dst) {
+  static_assert(sizeof(glm::vec2) == 2 * sizeof(float),
+                "glm::vec2 must be tightly packed");
+  CopyFloatTuples(src, count, byteStride, 2, &dst->x);
+}
+
+void CopyAccessor(const unsigned char* src, size_t count, size_t byteStride,
+                  glm::vec4* dst) {
+  static_assert(sizeof(glm::vec4) == 4 * sizeof(float),
+                "glm::vec4 must be tightly packed");
+  CopyFloatTuples(src, count, byteStride, 4, &dst->x);
+}
+
+void NormalizeVectors(glm::vec3* data, size_t count) {
+  for (size_t idx = 0; idx < count; ++idx) {
+    data[idx] = glm::normalize(data[idx]);
+  }
+}
+
+void CopyIndices(const unsigned char* src, size_t count, size_t componentSize,
+                 uint32_t baseVertex, uint32_t* dst) {
+  switch (componentSize) {
+    case sizeof(uint8_t):
+      WidenIndices(src, count, baseVertex, dst);
+      break;
+    case sizeof(uint16_t):
+      WidenIndices(reinterpret_cast<const uint16_t*>(src), count, baseVertex,
+                   dst);
+      break;
+    case sizeof(uint32_t):
+      WidenIndices(reinterpret_cast<const uint32_t*>(src), count, baseVertex,
+                   dst);
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,125 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <async-scene-loader.h>
+#include <stb_image.h>
+
+#include <utility>
+
+namespace Mgtt::Rendering {
+
+AsyncSceneLoader::~AsyncSceneLoader() noexcept {
+  Cancel();
+  Join();
+  DiscardPendingScene();
+}
+
+Mgtt::Common::Result<void> AsyncSceneLoader::Start(
+    Mgtt::Rendering::ISceneImporter& importer, std::string_view path,
+    Mgtt::Rendering::OpenGlShader&& shader) {
+  if (shader.GetProgramId() == 0) {
+    return Mgtt::Common::Result<void>::Err("Shader program does not exist");
+  }
+
+  Cancel();
+  Join();
+  DiscardPendingScene();
+  pendingError_.clear();
+
+  pendingScene_.shader = std::move(shader);
+  path_ = std::string(path);
+  progress_.fraction.store(0.0f);
+  progress_.cancelRequested.store(false);
+  finished_.store(false);
+  loading_ = true;
+
+  auto load = [this, &importer]() {
+    importer.SetLoadProgress(&progress_);
+    auto result = importer.Load(pendingScene_, path_);
+    importer.SetLoadProgress(nullptr);
+    if (result.err()) {
+      pendingError_ = result.error();
+    }
+    finished_.store(true, std::memory_order_release);
+  };
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  load();
+#else
+  worker_ = std::thread(load);
+#endif
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+void AsyncSceneLoader::Cancel() noexcept {
+  progress_.cancelRequested.store(true);
+}
+
+Mgtt::Common::Result<bool> AsyncSceneLoader::Poll(
+    Mgtt::Rendering::Scene& scene) {
+  if (!IsFinished()) {
+    return Mgtt::Common::Result<bool>::Ok(false);
+  }
+  Join();
+  loading_ = false;
+
+  if (!pendingError_.empty()) {
+    DiscardPendingScene();
+    return Mgtt::Common::Result<bool>::Err(std::move(pendingError_));
+  }
+  scene = std::move(pendingScene_);
+  return Mgtt::Common::Result<bool>::Ok(true);
+}
+
+bool AsyncSceneLoader::IsLoading() const noexcept { return loading_; }
+
+bool AsyncSceneLoader::IsFinished() const noexcept {
+  return loading_ && finished_.load(std::memory_order_acquire);
+}
+
+float AsyncSceneLoader::GetProgress() const noexcept {
+  return progress_.fraction.load(std::memory_order_relaxed);
+}
+
+const std::string& AsyncSceneLoader::GetPath() const noexcept {
+  return path_;
+}
+
+void AsyncSceneLoader::DiscardPendingScene() noexcept {
+  // Pixels are only released by SceneUploader::Upload(), which never ran
+  for (auto& [key, texture] : pendingScene_.textureMap) {
+    if (texture.data != nullptr) {
+      stbi_image_free(texture.data);
+      texture.data = nullptr;
+    }
+  }
+  // Runs on the GL thread, so the shader can be deleted here
+  pendingScene_.Clear();
+}
+
+void AsyncSceneLoader::Join() noexcept {
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+}  // namespace Mgtt::Rendering
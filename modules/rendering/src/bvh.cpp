@@ -0,0 +1,460 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <bvh.h>
+#include <worker-pool.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <string>
+#include <utility>
+
+namespace Mgtt::Rendering {
+
+namespace {
+
+// Below this many items a subtree is not worth a thread of its own
+constexpr uint32_t kParallelMinItems = 4096;
+
+struct Bin {
+  glm::vec3 min{FLT_MAX};
+  glm::vec3 max{-FLT_MAX};
+  uint32_t count{0};
+};
+
+float HalfArea(const glm::vec3& min, const glm::vec3& max) {
+  const glm::vec3 kExtent = max - min;
+  return kExtent.x * kExtent.y + kExtent.y * kExtent.z +
+         kExtent.z * kExtent.x;
+}
+
+bool IsValid(const Mgtt::Rendering::AABB& aabb) {
+  return aabb.min.x <= aabb.max.x && aabb.min.y <= aabb.max.y &&
+         aabb.min.z <= aabb.max.z;
+}
+
+/**
+ * @brief Distance at which a ray enters a box, if within [0, maxDistance].
+ */
+std::optional<float> IntersectRay(const glm::vec3& min, const glm::vec3& max,
+                                  const glm::vec3& origin,
+                                  const glm::vec3& inverseDirection,
+                                  float maxDistance) {
+  float entry = 0.0f;
+  float exit = maxDistance;
+  for (int axis = 0; axis < 3; ++axis) {
+    float near = (min[axis] - origin[axis]) * inverseDirection[axis];
+    float far = (max[axis] - origin[axis]) * inverseDirection[axis];
+    if (near > far) {
+      std::swap(near, far);
+    }
+    // Written so that NaN from 0 * inf leaves the interval unchanged
+    entry = near > entry ? near : entry;
+    exit = far < exit ? far : exit;
+    if (entry > exit) {
+      return std::nullopt;
+    }
+  }
+  return entry;
+}
+
+}  // namespace
+
+std::vector<Mgtt::Rendering::BvhItem> CollectBvhItems(
+    const std::vector<Mgtt::Rendering::InstanceBatch>& batches) {
+  std::vector<Mgtt::Rendering::BvhItem> items;
+  for (size_t batch = 0; batch < batches.size(); ++batch) {
+    const auto& mesh = batches[batch].mesh;
+    if (mesh == nullptr) {
+      continue;
+    }
+    for (size_t prim = 0; prim < mesh->meshPrimitives.size(); ++prim) {
+      const auto& aabb = mesh->meshPrimitives[prim].aabb;
+      // Primitives without bounds cannot be placed in the hierarchy
+      if (!IsValid(aabb)) {
+        continue;
+      }
+      const auto& matrices = batches[batch].instanceMatrices;
+      for (size_t instance = 0; instance < matrices.size(); ++instance) {
+        auto& item = items.emplace_back();
+        item.bounds = aabb;
+        item.bounds.CalculateBoundingBox(matrices[instance]);
+        item.batch = static_cast<uint32_t>(batch);
+        item.primitive = static_cast<uint32_t>(prim);
+        item.instance = static_cast<uint32_t>(instance);
+      }
+    }
+  }
+  return items;
+}
+
+void Bvh::Build(std::vector<Mgtt::Rendering::BvhItem> items,
+                uint32_t threadCount) {
+  Clear();
+  items_ = std::move(items);
+  const auto kCount = static_cast<uint32_t>(items_.size());
+  if (kCount == 0) {
+    return;
+  }
+  centroids_.reserve(kCount);
+  for (const auto& item : items_) {
+    centroids_.push_back((item.bounds.min + item.bounds.max) * 0.5f);
+  }
+  order_.resize(kCount);
+  std::iota(order_.begin(), order_.end(), 0u);
+  nodes_.reserve(2 * static_cast<size_t>(kCount) / kMaxLeafItems + 1);
+  nodes_.emplace_back();
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  const size_t kWorkerCount = 1;
+#else
+  const size_t kWorkerCount = threadCount;
+#endif
+  if (kWorkerCount <= 1 || kCount < 2 * kParallelMinItems) {
+    BuildSubtree(nodes_, 0, 0, kCount);
+    return;
+  }
+
+  // Split the largest subtree until every worker has several to pick from
+  struct Job {
+    uint32_t node;
+    uint32_t begin;
+    uint32_t end;
+  };
+  std::vector<Job> jobs = {{0, 0, kCount}};
+  while (!jobs.empty() && jobs.size() < kWorkerCount * 4) {
+    const auto kLargest =
+        std::max_element(jobs.begin(), jobs.end(), [](const Job& lhs,
+                                                       const Job& rhs) {
+          return lhs.end - lhs.begin < rhs.end - rhs.begin;
+        });
+    if (kLargest->end - kLargest->begin < 2 * kParallelMinItems) {
+      break;
+    }
+    const Job kJob = *kLargest;
+    jobs.erase(kLargest);
+    const auto kMid = SplitNode(nodes_, kJob.node, kJob.begin, kJob.end);
+    if (!kMid.has_value()) {
+      continue;
+    }
+    const uint32_t kLeft = nodes_[kJob.node].first;
+    jobs.push_back({kLeft, kJob.begin, *kMid});
+    jobs.push_back({kLeft + 1, *kMid, kJob.end});
+  }
+
+  // Subtrees cover disjoint ranges of order_ and fill their own node arrays
+  std::vector<std::vector<Mgtt::Rendering::BvhNode>> subtrees(jobs.size());
+  ParallelFor(jobs.size(), threadCount, [&](size_t idx) {
+    subtrees[idx].emplace_back();
+    BuildSubtree(subtrees[idx], 0, jobs[idx].begin, jobs[idx].end);
+  });
+
+  // The subtree root replaces its placeholder, the rest is appended
+  for (size_t idx = 0; idx < jobs.size(); ++idx) {
+    const auto& subtree = subtrees[idx];
+    const auto kBase = static_cast<uint32_t>(nodes_.size());
+    auto relocate = [kBase](Mgtt::Rendering::BvhNode node) {
+      if (node.count == 0) {
+        node.first = kBase + node.first - 1;
+      }
+      return node;
+    };
+    nodes_[jobs[idx].node] = relocate(subtree[0]);
+    for (size_t local = 1; local < subtree.size(); ++local) {
+      nodes_.push_back(relocate(subtree[local]));
+    }
+  }
+}
+
+void Bvh::Clear() noexcept {
+  items_.clear();
+  centroids_.clear();
+  order_.clear();
+  nodes_.clear();
+}
+
+Mgtt::Common::Result<void> Bvh::Refit(
+    const std::vector<Mgtt::Rendering::BvhItem>& items) {
+  if (items.size() != items_.size()) {
+    return Mgtt::Common::Result<void>::Err(
+        "BVH refit with " + std::to_string(items.size()) +
+        " items, built with " + std::to_string(items_.size()));
+  }
+  for (size_t idx = 0; idx < items.size(); ++idx) {
+    items_[idx].bounds = items[idx].bounds;
+  }
+
+  // Children follow their parents, so a reverse pass sees them first
+  for (size_t idx = nodes_.size(); idx-- > 0;) {
+    auto& node = nodes_[idx];
+    glm::vec3 min(FLT_MAX);
+    glm::vec3 max(-FLT_MAX);
+    if (node.count > 0) {
+      for (uint32_t pos = node.first; pos < node.first + node.count; ++pos) {
+        const auto& bounds = items_[order_[pos]].bounds;
+        min = glm::min(min, bounds.min);
+        max = glm::max(max, bounds.max);
+      }
+    } else {
+      min = glm::min(nodes_[node.first].min, nodes_[node.first + 1].min);
+      max = glm::max(nodes_[node.first].max, nodes_[node.first + 1].max);
+    }
+    node.min = min;
+    node.max = max;
+  }
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+void Bvh::QueryFrustum(const Mgtt::Rendering::FrustumPlanes& planes,
+                       std::vector<uint32_t>& items) const {
+  items.clear();
+  if (nodes_.empty()) {
+    return;
+  }
+  // Planes a node lies fully inside of are not tested for its children
+  constexpr uint8_t kAllPlanes = 0x3F;
+  std::vector<std::pair<uint32_t, uint8_t>> stack = {{0, kAllPlanes}};
+  while (!stack.empty()) {
+    const auto [kIndex, kMask] = stack.back();
+    stack.pop_back();
+    const auto& node = nodes_[kIndex];
+    uint8_t mask = kMask;
+    bool outside = false;
+    for (size_t plane = 0; plane < planes.size() && !outside; ++plane) {
+      if ((mask & (1u << plane)) == 0) {
+        continue;
+      }
+      const glm::vec3 kNormal(planes[plane]);
+      const glm::vec3 kFar(kNormal.x >= 0.0f ? node.max.x : node.min.x,
+                           kNormal.y >= 0.0f ? node.max.y : node.min.y,
+                           kNormal.z >= 0.0f ? node.max.z : node.min.z);
+      const glm::vec3 kNear(kNormal.x >= 0.0f ? node.min.x : node.max.x,
+                            kNormal.y >= 0.0f ? node.min.y : node.max.y,
+                            kNormal.z >= 0.0f ? node.min.z : node.max.z);
+      if (glm::dot(kNormal, kFar) + planes[plane].w < 0.0f) {
+        outside = true;
+      } else if (glm::dot(kNormal, kNear) + planes[plane].w >= 0.0f) {
+        mask = static_cast<uint8_t>(mask & ~(1u << plane));
+      }
+    }
+    if (outside) {
+      continue;
+    }
+    if (node.count > 0) {
+      items.insert(items.end(), order_.begin() + node.first,
+                   order_.begin() + node.first + node.count);
+    } else {
+      stack.emplace_back(node.first + 1, mask);
+      stack.emplace_back(node.first, mask);
+    }
+  }
+}
+
+std::optional<Mgtt::Rendering::BvhHit> Bvh::Raycast(const glm::vec3& origin,
+                                                    const glm::vec3& direction,
+                                                    float maxDistance) const {
+  if (nodes_.empty()) {
+    return std::nullopt;
+  }
+  const glm::vec3 kInverse(1.0f / direction.x, 1.0f / direction.y,
+                           1.0f / direction.z);
+  std::optional<Mgtt::Rendering::BvhHit> hit;
+  float closest = maxDistance;
+
+  auto rootEntry =
+      IntersectRay(nodes_[0].min, nodes_[0].max, origin, kInverse, closest);
+  if (!rootEntry.has_value()) {
+    return std::nullopt;
+  }
+  std::vector<std::pair<uint32_t, float>> stack = {{0, *rootEntry}};
+  while (!stack.empty()) {
+    const auto [kIndex, kEntry] = stack.back();
+    stack.pop_back();
+    if (kEntry > closest) {
+      continue;
+    }
+    const auto& node = nodes_[kIndex];
+    if (node.count > 0) {
+      for (uint32_t pos = node.first; pos < node.first + node.count; ++pos) {
+        const auto& bounds = items_[order_[pos]].bounds;
+        const auto kDistance =
+            IntersectRay(bounds.min, bounds.max, origin, kInverse, closest);
+        if (kDistance.has_value() &&
+            (!hit.has_value() || *kDistance < closest)) {
+          closest = *kDistance;
+          hit = Mgtt::Rendering::BvhHit{order_[pos], closest};
+        }
+      }
+      continue;
+    }
+    // The nearer child is pushed last and visited first
+    const auto& left = nodes_[node.first];
+    const auto& right = nodes_[node.first + 1];
+    auto leftEntry = IntersectRay(left.min, left.max, origin, kInverse,
+                                  closest);
+    auto rightEntry = IntersectRay(right.min, right.max, origin, kInverse,
+                                   closest);
+    if (leftEntry.has_value() && rightEntry.has_value() &&
+        *leftEntry < *rightEntry) {
+      stack.emplace_back(node.first + 1, *rightEntry);
+      stack.emplace_back(node.first, *leftEntry);
+      continue;
+    }
+    if (leftEntry.has_value()) {
+      stack.emplace_back(node.first, *leftEntry);
+    }
+    if (rightEntry.has_value()) {
+      stack.emplace_back(node.first + 1, *rightEntry);
+    }
+  }
+  return hit;
+}
+
+std::optional<uint32_t> Bvh::SplitNode(
+    std::vector<Mgtt::Rendering::BvhNode>& nodes, uint32_t node,
+    uint32_t begin, uint32_t end) {
+  Mgtt::Rendering::BvhNode bounded;
+  glm::vec3 centroidMin(FLT_MAX);
+  glm::vec3 centroidMax(-FLT_MAX);
+  for (uint32_t pos = begin; pos < end; ++pos) {
+    const auto& bounds = items_[order_[pos]].bounds;
+    bounded.min = glm::min(bounded.min, bounds.min);
+    bounded.max = glm::max(bounded.max, bounds.max);
+    centroidMin = glm::min(centroidMin, centroids_[order_[pos]]);
+    centroidMax = glm::max(centroidMax, centroids_[order_[pos]]);
+  }
+  bounded.first = begin;
+  bounded.count = end - begin;
+  nodes[node] = bounded;
+  const uint32_t kCount = end - begin;
+  if (kCount <= 1) {
+    return std::nullopt;
+  }
+
+  // Binned SAH: cost of a split is sum(count * area) of both sides
+  int bestAxis = -1;
+  uint32_t bestBin = 0;
+  float bestCost = FLT_MAX;
+  for (int axis = 0; axis < 3; ++axis) {
+    const float kExtent = centroidMax[axis] - centroidMin[axis];
+    if (!(kExtent > 0.0f)) {
+      continue;
+    }
+    const float kScale = static_cast<float>(kBinCount) / kExtent;
+    std::array<Bin, kBinCount> bins{};
+    for (uint32_t pos = begin; pos < end; ++pos) {
+      const auto kBin = std::min<uint32_t>(
+          kBinCount - 1,
+          static_cast<uint32_t>(
+              (centroids_[order_[pos]][axis] - centroidMin[axis]) * kScale));
+      const auto& bounds = items_[order_[pos]].bounds;
+      bins[kBin].min = glm::min(bins[kBin].min, bounds.min);
+      bins[kBin].max = glm::max(bins[kBin].max, bounds.max);
+      ++bins[kBin].count;
+    }
+
+    std::array<float, kBinCount> leftCosts{};
+    Bin left;
+    for (uint32_t bin = 0; bin + 1 < kBinCount; ++bin) {
+      left.min = glm::min(left.min, bins[bin].min);
+      left.max = glm::max(left.max, bins[bin].max);
+      left.count += bins[bin].count;
+      leftCosts[bin] = left.count > 0 ? static_cast<float>(left.count) *
+                                            HalfArea(left.min, left.max)
+                                      : 0.0f;
+    }
+    Bin right;
+    for (uint32_t bin = kBinCount - 1; bin > 0; --bin) {
+      right.min = glm::min(right.min, bins[bin].min);
+      right.max = glm::max(right.max, bins[bin].max);
+      right.count += bins[bin].count;
+      if (right.count == 0 || right.count == kCount) {
+        continue;
+      }
+      const float kCost = leftCosts[bin - 1] +
+                          static_cast<float>(right.count) *
+                              HalfArea(right.min, right.max);
+      if (kCost < bestCost) {
+        bestCost = kCost;
+        bestAxis = axis;
+        bestBin = bin;
+      }
+    }
+  }
+
+  const float kLeafCost =
+      static_cast<float>(kCount) * HalfArea(bounded.min, bounded.max);
+  if (kCount <= kMaxLeafItems && (bestAxis < 0 || bestCost >= kLeafCost)) {
+    return std::nullopt;
+  }
+
+  // Identical centroids keep the middle of the range as split
+  uint32_t mid = begin + kCount / 2;
+  if (bestAxis >= 0) {
+    const float kScale = static_cast<float>(kBinCount) /
+                         (centroidMax[bestAxis] - centroidMin[bestAxis]);
+    const auto kSplit = std::partition(
+        order_.begin() + begin, order_.begin() + end, [&](uint32_t item) {
+          const auto kBin = std::min<uint32_t>(
+              kBinCount - 1,
+              static_cast<uint32_t>(
+                  (centroids_[item][bestAxis] - centroidMin[bestAxis]) *
+                  kScale));
+          return kBin < bestBin;
+        });
+    mid = static_cast<uint32_t>(kSplit - order_.begin());
+    if (mid == begin || mid == end) {
+      mid = begin + kCount / 2;
+    }
+  }
+
+  const auto kLeft = static_cast<uint32_t>(nodes.size());
+  nodes.emplace_back();
+  nodes.emplace_back();
+  nodes[node].first = kLeft;
+  nodes[node].count = 0;
+  return mid;
+}
+
+void Bvh::BuildSubtree(std::vector<Mgtt::Rendering::BvhNode>& nodes,
+                       uint32_t root, uint32_t begin, uint32_t end) {
+  struct Range {
+    uint32_t node;
+    uint32_t begin;
+    uint32_t end;
+  };
+  std::vector<Range> stack = {{root, begin, end}};
+  while (!stack.empty()) {
+    const Range kRange = stack.back();
+    stack.pop_back();
+    const auto kMid = SplitNode(nodes, kRange.node, kRange.begin, kRange.end);
+    if (!kMid.has_value()) {
+      continue;
+    }
+    const uint32_t kLeft = nodes[kRange.node].first;
+    stack.push_back({kLeft + 1, *kMid, kRange.end});
+    stack.push_back({kLeft, kRange.begin, *kMid});
+  }
+}
+
+}  // namespace Mgtt::Rendering
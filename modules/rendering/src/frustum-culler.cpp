@@ -0,0 +1,198 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <frustum-culler.h>
+
+#include <cfloat>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MGTT_FRUSTUM_CULLER_SSE2
+#endif
+
+namespace Mgtt::Rendering {
+
+void FrustumCuller::Build(
+    const std::vector<Mgtt::Rendering::InstanceBatch>& batches) {
+  Clear();
+  firstDraws_.reserve(batches.size() + 1);
+  for (const auto& batch : batches) {
+    firstDraws_.push_back(visible_.size());
+    if (batch.mesh == nullptr) {
+      continue;
+    }
+    for (const auto& prim : batch.mesh->meshPrimitives) {
+      Mgtt::Rendering::AABB bounds;
+      const bool kValid = prim.aabb.min.x <= prim.aabb.max.x &&
+                          prim.aabb.min.y <= prim.aabb.max.y &&
+                          prim.aabb.min.z <= prim.aabb.max.z;
+      if (!kValid) {
+        // Primitives without bounds are never culled
+        bounds.min = glm::vec3(-FLT_MAX);
+        bounds.max = glm::vec3(FLT_MAX);
+      }
+      for (const auto& instanceMatrix : batch.instanceMatrices) {
+        if (!kValid) {
+          break;
+        }
+        Mgtt::Rendering::AABB instanceBounds = prim.aabb;
+        instanceBounds.CalculateBoundingBox(instanceMatrix);
+        bounds.min = glm::min(bounds.min, instanceBounds.min);
+        bounds.max = glm::max(bounds.max, instanceBounds.max);
+      }
+      minX_.push_back(bounds.min.x);
+      minY_.push_back(bounds.min.y);
+      minZ_.push_back(bounds.min.z);
+      maxX_.push_back(bounds.max.x);
+      maxY_.push_back(bounds.max.y);
+      maxZ_.push_back(bounds.max.z);
+      visible_.push_back(1);
+    }
+  }
+  firstDraws_.push_back(visible_.size());
+  batchVisible_.assign(batches.size(), 1);
+  stats_ = {static_cast<uint32_t>(visible_.size()), 0};
+}
+
+void FrustumCuller::Clear() noexcept {
+  minX_.clear();
+  minY_.clear();
+  minZ_.clear();
+  maxX_.clear();
+  maxY_.clear();
+  maxZ_.clear();
+  visible_.clear();
+  firstDraws_.clear();
+  batchVisible_.clear();
+  bvhItems_.clear();
+  stats_ = {};
+}
+
+Mgtt::Rendering::CullStats FrustumCuller::Cull(
+    const Mgtt::Rendering::FrustumPlanes& planes) {
+  const size_t kCount = visible_.size();
+  visible_.assign(kCount, 1);
+
+  // A box is outside a plane if its corner furthest along the plane normal
+  // is. That corner takes max on axes with a positive normal component and
+  // min otherwise, which is the same choice for every box.
+  for (const auto& plane : planes) {
+    const float* kXs = plane.x >= 0.0f ? maxX_.data() : minX_.data();
+    const float* kYs = plane.y >= 0.0f ? maxY_.data() : minY_.data();
+    const float* kZs = plane.z >= 0.0f ? maxZ_.data() : minZ_.data();
+    size_t draw = 0;
+#ifdef MGTT_FRUSTUM_CULLER_SSE2
+    const __m128 kA = _mm_set1_ps(plane.x);
+    const __m128 kB = _mm_set1_ps(plane.y);
+    const __m128 kC = _mm_set1_ps(plane.z);
+    const __m128 kD = _mm_set1_ps(plane.w);
+    const __m128 kZero = _mm_setzero_ps();
+    for (; draw + 4 <= kCount; draw += 4) {
+      const __m128 kDistance = _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(kA, _mm_loadu_ps(kXs + draw)),
+                     _mm_mul_ps(kB, _mm_loadu_ps(kYs + draw))),
+          _mm_add_ps(_mm_mul_ps(kC, _mm_loadu_ps(kZs + draw)), kD));
+      const int kOutside = _mm_movemask_ps(_mm_cmplt_ps(kDistance, kZero));
+      for (int lane = 0; lane < 4; ++lane) {
+        if ((kOutside & (1 << lane)) != 0) {
+          visible_[draw + static_cast<size_t>(lane)] = 0;
+        }
+      }
+    }
+#endif
+    for (; draw < kCount; ++draw) {
+      if (plane.x * kXs[draw] + plane.y * kYs[draw] +
+              (plane.z * kZs[draw] + plane.w) <
+          0.0f) {
+        visible_[draw] = 0;
+      }
+    }
+  }
+
+  CountVisible();
+  return stats_;
+}
+
+Mgtt::Rendering::CullStats FrustumCuller::Cull(
+    const Mgtt::Rendering::FrustumPlanes& planes,
+    const Mgtt::Rendering::Bvh& bvh) {
+  const size_t kCount = visible_.size();
+  // Unbounded draws are not in the hierarchy
+  for (size_t draw = 0; draw < kCount; ++draw) {
+    visible_[draw] = minX_[draw] == -FLT_MAX ? 1 : 0;
+  }
+  bvh.QueryFrustum(planes, bvhItems_);
+  for (const uint32_t kItem : bvhItems_) {
+    const auto& item = bvh.GetItem(kItem);
+    if (item.batch + size_t{1} >= firstDraws_.size()) {
+      continue;
+    }
+    const size_t kDraw = firstDraws_[item.batch] + item.primitive;
+    if (kDraw < firstDraws_[item.batch + 1]) {
+      visible_[kDraw] = 1;
+    }
+  }
+  CountVisible();
+  return stats_;
+}
+
+Mgtt::Rendering::CullStats FrustumCuller::CullOccluded(
+    const Mgtt::Rendering::OcclusionCuller& occlusion) {
+  // Draws hidden from here on are occluded, not outside the frustum
+  const uint32_t kFrustumCulled = stats_.culled;
+  for (size_t draw = 0; draw < visible_.size(); ++draw) {
+    if (visible_[draw] == 0 || minX_[draw] == -FLT_MAX) {
+      continue;
+    }
+    if (!occlusion.IsVisible(GetBounds(draw))) {
+      visible_[draw] = 0;
+    }
+  }
+  CountVisible();
+  stats_.occluded = stats_.culled - kFrustumCulled;
+  stats_.culled = kFrustumCulled;
+  return stats_;
+}
+
+Mgtt::Rendering::AABB FrustumCuller::GetBounds(size_t draw) const {
+  Mgtt::Rendering::AABB bounds;
+  bounds.min = glm::vec3(minX_[draw], minY_[draw], minZ_[draw]);
+  bounds.max = glm::vec3(maxX_[draw], maxY_[draw], maxZ_[draw]);
+  return bounds;
+}
+
+void FrustumCuller::CountVisible() {
+  stats_ = {};
+  for (size_t batch = 0; batch < batchVisible_.size(); ++batch) {
+    uint32_t batchVisible = 0;
+    for (size_t draw = firstDraws_[batch]; draw < firstDraws_[batch + 1];
+         ++draw) {
+      batchVisible += visible_[draw];
+    }
+    batchVisible_[batch] = batchVisible > 0 ? 1 : 0;
+    stats_.visible += batchVisible;
+  }
+  stats_.culled = static_cast<uint32_t>(visible_.size()) - stats_.visible;
+}
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,309 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <glb-json.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace {
+
+constexpr size_t kInvalid = std::string_view::npos;
+
+// Stand-ins tinygltf parses without the BIN chunk, one byte each
+constexpr std::string_view kPlaceholderBuffer =
+    R"({"byteLength":1,"uri":"data:application/octet-stream;base64,AA=="})";
+constexpr std::string_view kPlaceholderView = R"({"buffer":0,"byteLength":1})";
+
+/**
+ * @brief A JSON value as [begin, end) offsets into the document, empty if
+ * the value is absent.
+ */
+struct Span {
+  size_t begin{0};
+  size_t end{0};
+};
+
+/**
+ * @brief Replacement of the document bytes [begin, end) by text.
+ */
+struct Edit {
+  size_t begin{0};
+  size_t end{0};
+  std::string text;
+};
+
+size_t SkipWhitespace(std::string_view json, size_t pos) {
+  while (pos < json.size() && (json[pos] == ' ' || json[pos] == '\t' ||
+                               json[pos] == '\n' || json[pos] == '\r')) {
+    ++pos;
+  }
+  return pos;
+}
+
+/**
+ * @brief Offset past the closing quote of the string opening at pos.
+ */
+size_t SkipString(std::string_view json, size_t pos) {
+  for (++pos; pos < json.size(); ++pos) {
+    if (json[pos] == '\\') {
+      ++pos;
+    } else if (json[pos] == '"') {
+      return pos + 1;
+    }
+  }
+  return kInvalid;
+}
+
+/**
+ * @brief Offset past the value starting at pos, kInvalid if it is cut off.
+ */
+size_t SkipValue(std::string_view json, size_t pos) {
+  if (pos >= json.size()) {
+    return kInvalid;
+  }
+  if (json[pos] == '"') {
+    return SkipString(json, pos);
+  }
+  if (json[pos] == '{' || json[pos] == '[') {
+    size_t depth = 0;
+    while (pos < json.size()) {
+      const char kChar = json[pos];
+      if (kChar == '"') {
+        pos = SkipString(json, pos);
+        if (pos == kInvalid) {
+          return kInvalid;
+        }
+        continue;
+      }
+      if (kChar == '{' || kChar == '[') {
+        ++depth;
+      } else if ((kChar == '}' || kChar == ']') && --depth == 0) {
+        return pos + 1;
+      }
+      ++pos;
+    }
+    return kInvalid;
+  }
+  // Number, true, false or null
+  const size_t kEnd = json.find_first_of(",}] \t\n\r", pos);
+  if (kEnd == pos) {
+    return kInvalid;
+  }
+  return kEnd == std::string_view::npos ? json.size() : kEnd;
+}
+
+bool IsContainer(std::string_view json, Span span, char open) {
+  return span.end > span.begin && json[span.begin] == open;
+}
+
+/**
+ * @brief Call fn(key, value) for every member of an object or fn("", value)
+ * for every element of an array.
+ *
+ * @return False if the container is malformed.
+ */
+template <typename Fn>
+bool ForEachChild(std::string_view json, Span container, Fn&& fn) {
+  const bool kObject = json[container.begin] == '{';
+  const char kClose = kObject ? '}' : ']';
+  size_t pos = SkipWhitespace(json, container.begin + 1);
+  if (pos < container.end && json[pos] == kClose) {
+    return pos + 1 == container.end;
+  }
+  while (pos < container.end) {
+    std::string_view key;
+    if (kObject) {
+      if (json[pos] != '"') {
+        return false;
+      }
+      const size_t kKeyEnd = SkipString(json, pos);
+      if (kKeyEnd == kInvalid) {
+        return false;
+      }
+      key = json.substr(pos + 1, kKeyEnd - pos - 2);
+      pos = SkipWhitespace(json, kKeyEnd);
+      if (pos >= container.end || json[pos] != ':') {
+        return false;
+      }
+      pos = SkipWhitespace(json, pos + 1);
+    }
+    const size_t kValueEnd = SkipValue(json, pos);
+    if (kValueEnd == kInvalid || kValueEnd > container.end) {
+      return false;
+    }
+    fn(key, Span{pos, kValueEnd});
+    pos = SkipWhitespace(json, kValueEnd);
+    if (pos >= container.end) {
+      return false;
+    }
+    if (json[pos] == kClose) {
+      return pos + 1 == container.end;
+    }
+    if (json[pos] != ',') {
+      return false;
+    }
+    pos = SkipWhitespace(json, pos + 1);
+  }
+  return false;
+}
+
+/**
+ * @brief Value of a non-negative integer literal, -1 for anything else.
+ */
+int ParseIndex(std::string_view literal) {
+  if (literal.empty() || literal.size() > 9) {
+    return -1;
+  }
+  int value = 0;
+  for (const char kDigit : literal) {
+    if (kDigit < '0' || kDigit > '9') {
+      return -1;
+    }
+    value = value * 10 + (kDigit - '0');
+  }
+  return value;
+}
+
+}  // namespace
+
+Mgtt::Common::Result<Mgtt::Rendering::DetachedGlbJson>
+Mgtt::Rendering::DetachGlbBinChunk(std::string_view json) {
+  using DetachResult = Mgtt::Common::Result<Mgtt::Rendering::DetachedGlbJson>;
+  const auto kMalformed = [] {
+    return DetachResult::Err("Malformed glTF JSON chunk");
+  };
+
+  const size_t kRootBegin = SkipWhitespace(json, 0);
+  if (kRootBegin >= json.size() || json[kRootBegin] != '{') {
+    return kMalformed();
+  }
+  const Span kRoot{kRootBegin, SkipValue(json, kRootBegin)};
+  if (kRoot.end == kInvalid) {
+    return kMalformed();
+  }
+  Span buffers;
+  Span bufferViews;
+  Span images;
+  if (!ForEachChild(json, kRoot, [&](std::string_view key, Span value) {
+        if (key == "buffers") {
+          buffers = value;
+        } else if (key == "bufferViews") {
+          bufferViews = value;
+        } else if (key == "images") {
+          images = value;
+        }
+      })) {
+    return kMalformed();
+  }
+
+  Mgtt::Rendering::DetachedGlbJson detached;
+  Span firstBuffer;
+  bool hasUri = false;
+  if (IsContainer(json, buffers, '[') &&
+      !ForEachChild(json, buffers, [&](std::string_view, Span value) {
+        if (firstBuffer.end == 0) {
+          firstBuffer = value;
+        }
+      })) {
+    return kMalformed();
+  }
+  if (IsContainer(json, firstBuffer, '{') &&
+      !ForEachChild(json, firstBuffer, [&](std::string_view key, Span) {
+        hasUri = hasUri || key == "uri";
+      })) {
+    return kMalformed();
+  }
+  // Only a buffer without URI is stored in the BIN chunk
+  if (!IsContainer(json, firstBuffer, '{') || hasUri) {
+    detached.json = std::string(json);
+    return DetachResult::Ok(std::move(detached));
+  }
+
+  std::vector<Edit> edits;
+  edits.push_back(
+      {firstBuffer.begin, firstBuffer.end, std::string(kPlaceholderBuffer)});
+
+  int viewCount = 0;
+  if (IsContainer(json, bufferViews, '[') &&
+      !ForEachChild(json, bufferViews,
+                    [&](std::string_view, Span) { ++viewCount; })) {
+    return kMalformed();
+  }
+
+  // Embedded images are pointed at the placeholder view, appended last
+  bool imagesValid = true;
+  bool hasImageView = false;
+  auto detachImage = [&](std::string_view key, Span value) {
+    if (key != "bufferView") {
+      return;
+    }
+    const int kView =
+        ParseIndex(json.substr(value.begin, value.end - value.begin));
+    if (kView >= 0) {
+      detached.imageBufferViews.back() = kView;
+      edits.push_back({value.begin, value.end, std::to_string(viewCount)});
+      hasImageView = true;
+    }
+  };
+  if (IsContainer(json, images, '[') &&
+      !ForEachChild(json, images, [&](std::string_view, Span image) {
+        detached.imageBufferViews.push_back(-1);
+        if (IsContainer(json, image, '{')) {
+          imagesValid =
+              ForEachChild(json, image, detachImage) && imagesValid;
+        }
+      })) {
+    return kMalformed();
+  }
+  if (!imagesValid) {
+    return kMalformed();
+  }
+
+  if (hasImageView) {
+    if (!IsContainer(json, bufferViews, '[')) {
+      return DetachResult::Err("glTF images reference missing bufferViews");
+    }
+    // Inserted in front of the closing bracket
+    const size_t kClose = bufferViews.end - 1;
+    std::string view = viewCount > 0 ? "," : "";
+    view += kPlaceholderView;
+    edits.push_back({kClose, kClose, std::move(view)});
+    detached.placeholderView = viewCount;
+  }
+
+  std::sort(edits.begin(), edits.end(), [](const Edit& lhs, const Edit& rhs) {
+    return lhs.begin < rhs.begin;
+  });
+  detached.json.reserve(json.size() + kPlaceholderBuffer.size() +
+                        kPlaceholderView.size() + 16 * edits.size());
+  size_t pos = 0;
+  for (const Edit& edit : edits) {
+    detached.json.append(json.substr(pos, edit.begin - pos));
+    detached.json += edit.text;
+    pos = edit.end;
+  }
+  detached.json.append(json.substr(pos));
+  detached.detached = true;
+  return DetachResult::Ok(std::move(detached));
+}
@@ -20,10 +20,102 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <accessor-copy.h>
+#include <glb-json.h>
 #include <gltf-scene-importer.h>
+#include <worker-pool.h>
 
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t kGlbMagic = 0x46546C67;      // "glTF"
+constexpr uint32_t kGlbChunkJson = 0x4E4F534A;  // "JSON"
+constexpr uint32_t kGlbChunkBin = 0x004E4942;   // "BIN\0"
+constexpr size_t kGlbHeaderSize = 12;
+constexpr size_t kGlbChunkHeaderSize = 8;
+
+/**
+ * @brief tinygltf image loader that keeps the encoded bytes for the importer.
+ *
+ * tinygltf has already read external files and base64-decoded data URIs at
+ * this point. Their encoded bytes are stored in Image::image so that
+ * LoadTextures decodes every image exactly once, in parallel and without
+ * going back to disk. bufferView images are decoded later straight from
+ * their buffer, so they are not copied here.
+ */
+bool CaptureEncodedImage(tinygltf::Image* image, const int /*imageIdx*/,
+                         std::string* /*err*/, std::string* /*warn*/,
+                         int /*reqWidth*/, int /*reqHeight*/,
+                         const unsigned char* bytes, int size,
+                         void* /*userData*/) {
+  if (image->bufferView < 0 && bytes != nullptr && size > 0) {
+    image->image.assign(bytes, bytes + size);
+  }
+  return true;
+}
+
+/**
+ * @brief Decode the %XX escapes of a relative glTF URI into a file path.
+ */
+std::string DecodeUri(const std::string& uri) {
+  auto hexValue = [](char digit) {
+    if (digit >= '0' && digit <= '9') {
+      return digit - '0';
+    }
+    if (digit >= 'a' && digit <= 'f') {
+      return digit - 'a' + 10;
+    }
+    if (digit >= 'A' && digit <= 'F') {
+      return digit - 'A' + 10;
+    }
+    return -1;
+  };
+  std::string path;
+  path.reserve(uri.size());
+  for (size_t idx = 0; idx < uri.size(); ++idx) {
+    if (uri[idx] == '%' && idx + 2 < uri.size() &&
+        hexValue(uri[idx + 1]) >= 0 && hexValue(uri[idx + 2]) >= 0) {
+      path += static_cast<char>(hexValue(uri[idx + 1]) * 16 +
+                                hexValue(uri[idx + 2]));
+      idx += 2;
+    } else {
+      path += uri[idx];
+    }
+  }
+  return path;
+}
+
+/**
+ * @brief Buffer and image files a glTF document references, which the
+ * scene cache stamps along with the document.
+ */
+std::vector<std::string> ExternalFiles(const tinygltf::Model& model,
+                                       const std::string& folderPath) {
+  std::vector<std::string> files;
+  auto addUri = [&](const std::string& uri) {
+    if (!uri.empty() && uri.rfind("data:", 0) != 0) {
+      files.push_back(folderPath + DecodeUri(uri));
+    }
+  };
+  for (const auto& buffer : model.buffers) {
+    addUri(buffer.uri);
+  }
+  for (const auto& image : model.images) {
+    addUri(image.uri);
+  }
+  return files;
+}
+
+}  // namespace
 
 /**
  * @note Inspired by the Vulkan glTF PBR example:
@@ -49,61 +141,246 @@ Mgtt::Common::Result<void> Mgtt::Rendering::GltfSceneImporter::Load(
                                            kPathStr);
   }
 
+  auto cancelled = [&]() {
+    DiscardScene(mgttScene);
+    return Mgtt::Common::Result<void>::Err("Load cancelled: " + kPathStr);
+  };
+
+  sceneCache_.SetImportOptions(GetImportOptions());
+  // Entries of earlier loads may still be in flight
+  if (auto result = sceneCache_.Flush(); result.err()) {
+    std::cerr << "Scene cache not written: " << result.error() << '\n';
+  }
+  if (sceneCache_.IsEnabled() && sceneCache_.Load(mgttScene, kPathStr).ok()) {
+    std::cout << "Scene cache hit: " << kPathStr << '\n';
+    mgttScene.transforms.Build(mgttScene.nodes, mgttScene.rootNodes);
+    return ReportProgress(1.0f) ? Mgtt::Common::Result<void>::Ok()
+                                : cancelled();
+  }
+
   const bool kBinary = hasSuffix(".glb") || hasSuffix(".GLB");
 
-  std::string err;
-  std::string warn;
   tinygltf::Model gltfModel;
-  tinygltf::TinyGLTF gltfContext;
+  // Unmapped when Load returns, after the scene no longer reads it
+  Mgtt::Rendering::MappedFile mappedGlb;
+  LoadContext context;
 
-  const bool kFileLoaded =
-      kBinary
-          ? gltfContext.LoadBinaryFromFile(&gltfModel, &err, &warn, kPathStr)
-          : gltfContext.LoadASCIIFromFile(&gltfModel, &err, &warn, kPathStr);
+  if (kBinary && memoryMappedGlb_) {
+    if (auto result = ParseMappedGlb(gltfModel, mappedGlb, kPathStr, context);
+        result.err()) {
+      DiscardScene(mgttScene);
+      return result;
+    }
+  } else {
+    std::string err;
+    std::string warn;
+    tinygltf::TinyGLTF gltfContext;
+    gltfContext.SetImageLoader(CaptureEncodedImage, nullptr);
 
-  if (!kFileLoaded) {
-    Clear(mgttScene);
-    return Mgtt::Common::Result<void>::Err(
-        "Failed to load glTF file: " + kPathStr +
-        (err.empty() ? "" : " — " + err));
+    const bool kFileLoaded =
+        kBinary
+            ? gltfContext.LoadBinaryFromFile(&gltfModel, &err, &warn, kPathStr)
+            : gltfContext.LoadASCIIFromFile(&gltfModel, &err, &warn,
+                                            kPathStr);
+
+    if (!kFileLoaded) {
+      DiscardScene(mgttScene);
+      return Mgtt::Common::Result<void>::Err(
+          "Failed to load glTF file: " + kPathStr +
+          (err.empty() ? "" : " — " + err));
+    }
+  }
+
+  if (!ReportProgress(0.2f)) {
+    return cancelled();
+  }
+
+  auto buildResult = BuildScene(mgttScene, gltfModel, context);
+  if (buildResult.err()) {
+    DiscardScene(mgttScene);
+    return buildResult;
+  }
+
+  mgttScene.transforms.Build(mgttScene.nodes, mgttScene.rootNodes);
+  CalculateSceneDimensions(mgttScene);
+
+  mgttScene.aabb.center = (mgttScene.aabb.min + mgttScene.aabb.max) * 0.5f;
+
+  const glm::vec3 kTmpScale = mgttScene.aabb.max - mgttScene.aabb.min;
+  mgttScene.aabb.scale =
+      (kTmpScale.x <= 0.0f || kTmpScale.y <= 0.0f || kTmpScale.z <= 0.0f)
+          ? 1.0f
+          : glm::max(kTmpScale.x, glm::max(kTmpScale.y, kTmpScale.z));
+
+  std::cout << "Scale equals " << mgttScene.aabb.scale << '\n';
+
+  if (auto result = ProcessMeshes(mgttScene); result.err()) {
+    DiscardScene(mgttScene);
+    return result;
+  }
+
+  if (!ReportProgress(1.0f)) {
+    return cancelled();
+  }
+  if (sceneCache_.IsEnabled()) {
+    if (auto result = sceneCache_.SaveAsync(
+            mgttScene, kPathStr,
+            ExternalFiles(gltfModel, ExtractFolderPath(kPathStr)));
+        result.err()) {
+      std::cerr << "Scene cache not written: " << result.error() << '\n';
+    }
   }
+  return Mgtt::Common::Result<void>::Ok();
+}
 
-  if (auto result = LoadTextures(mgttScene, gltfModel); result.err()) {
-    Clear(mgttScene);
+Mgtt::Common::Result<void> Mgtt::Rendering::GltfSceneImporter::BuildScene(
+    Mgtt::Rendering::Scene& mgttScene, tinygltf::Model& gltfModel,
+    LoadContext& context) {
+  if (auto result = LoadTextures(mgttScene, gltfModel, context);
+      result.err()) {
     return result;
   }
   LoadMaterials(mgttScene, gltfModel);
+  context.meshes.assign(gltfModel.meshes.size(), nullptr);
+  if (!ReportProgress(0.75f)) {
+    return Mgtt::Common::Result<void>::Err("Load cancelled: " +
+                                           mgttScene.path);
+  }
 
   const tinygltf::Scene& scene =
       gltfModel
           .scenes[gltfModel.defaultScene > -1 ? gltfModel.defaultScene : 0];
 
+  // Depth-first with an explicit stack, so deep hierarchies cannot overflow
+  // the call stack. Children are pushed in reverse to keep the glTF order.
+  std::vector<uint8_t> visited(gltfModel.nodes.size(), 0);
+  std::vector<std::pair<int, uint32_t>> stack;
   // NOLINTNEXTLINE(modernize-loop-convert) — idx used as both array index and
   for (size_t idx = 0; idx < scene.nodes.size(); ++idx) {
-    const tinygltf::Node& node = gltfModel.nodes[scene.nodes[idx]];
-    if (auto result =
-            LoadNode(nullptr, mgttScene, node,
-                     static_cast<uint32_t>(scene.nodes[idx]), gltfModel);
-        result.err()) {
-      Clear(mgttScene);
-      return result;
+    stack.emplace_back(scene.nodes[idx], Mgtt::Rendering::Node::kNoParent);
+    while (!stack.empty()) {
+      const auto [kGltfIndex, kParent] = stack.back();
+      stack.pop_back();
+      if (kGltfIndex < 0 ||
+          static_cast<size_t>(kGltfIndex) >= gltfModel.nodes.size() ||
+          visited[static_cast<size_t>(kGltfIndex)] != 0) {
+        return Mgtt::Common::Result<void>::Err(
+            "Invalid node hierarchy, node " + std::to_string(kGltfIndex) +
+            " is out of range or referenced twice: " + mgttScene.path);
+      }
+      visited[static_cast<size_t>(kGltfIndex)] = 1;
+
+      const tinygltf::Node& node =
+          gltfModel.nodes[static_cast<size_t>(kGltfIndex)];
+      auto result =
+          LoadNode(kParent, mgttScene, node, static_cast<uint32_t>(kGltfIndex),
+                   gltfModel, context);
+      if (result.err()) {
+        return Mgtt::Common::Result<void>::Err(result.error());
+      }
+      for (auto iter = node.children.rbegin(); iter != node.children.rend();
+           ++iter) {
+        stack.emplace_back(*iter, result.value());
+      }
+    }
+    if (!ReportProgress(0.75f + 0.2f * static_cast<float>(idx + 1) /
+                                    static_cast<float>(scene.nodes.size()))) {
+      return Mgtt::Common::Result<void>::Err("Load cancelled: " +
+                                             mgttScene.path);
     }
   }
 
-  for (const auto& node : mgttScene.nodes) {
-    UpdateNodeMeshMatrices(node);
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+Mgtt::Common::Result<void> Mgtt::Rendering::GltfSceneImporter::ParseMappedGlb(
+    tinygltf::Model& gltfModel, Mgtt::Rendering::MappedFile& mappedGlb,
+    const std::string& path, LoadContext& context) {
+  if (auto result = mappedGlb.Open(path); result.err()) {
+    return result;
   }
-  CalculateSceneDimensions(mgttScene);
 
-  mgttScene.aabb.center = (mgttScene.aabb.min + mgttScene.aabb.max) * 0.5f;
+  const unsigned char* kData = mappedGlb.Data();
+  const size_t kSize = mappedGlb.Size();
+  auto readU32 = [&](size_t offset) {
+    uint32_t value = 0;
+    std::memcpy(&value, kData + offset, sizeof(value));
+    return value;
+  };
 
-  const glm::vec3 kTmpScale = mgttScene.aabb.max - mgttScene.aabb.min;
-  mgttScene.aabb.scale =
-      (kTmpScale.x <= 0.0f || kTmpScale.y <= 0.0f || kTmpScale.z <= 0.0f)
-          ? 1.0f
-          : glm::max(kTmpScale.x, glm::max(kTmpScale.y, kTmpScale.z));
+  if (kSize < kGlbHeaderSize + kGlbChunkHeaderSize ||
+      readU32(0) != kGlbMagic || readU32(4) != 2) {
+    return Mgtt::Common::Result<void>::Err("Invalid GLB header: " + path);
+  }
+  if (kSize > std::numeric_limits<unsigned int>::max()) {
+    return Mgtt::Common::Result<void>::Err("GLB file exceeds 4 GiB: " + path);
+  }
 
-  std::cout << "Scale equals " << mgttScene.aabb.scale << '\n';
+  // The JSON chunk comes first, the optional BIN chunk right after it
+  const size_t kJsonLength = readU32(kGlbHeaderSize);
+  const size_t kBinHeader = kGlbHeaderSize + kGlbChunkHeaderSize + kJsonLength;
+  if (readU32(kGlbHeaderSize + 4) != kGlbChunkJson || kBinHeader > kSize) {
+    return Mgtt::Common::Result<void>::Err("Invalid GLB JSON chunk: " + path);
+  }
+  const unsigned char* binChunk = nullptr;
+  size_t binChunkSize = 0;
+  if (kBinHeader + kGlbChunkHeaderSize <= kSize &&
+      readU32(kBinHeader + 4) == kGlbChunkBin) {
+    const size_t kBinLength = readU32(kBinHeader);
+    if (kBinHeader + kGlbChunkHeaderSize + kBinLength <= kSize) {
+      binChunk = kData + kBinHeader + kGlbChunkHeaderSize;
+      binChunkSize = kBinLength;
+    }
+  }
+
+  // tinygltf would copy the BIN chunk into the first buffer, so it only gets
+  // the JSON chunk with that buffer and embedded images redirected
+  auto detachResult = Mgtt::Rendering::DetachGlbBinChunk(std::string_view(
+      reinterpret_cast<const char*>(kData + kGlbHeaderSize +
+                                    kGlbChunkHeaderSize),
+      kJsonLength));
+  if (detachResult.err()) {
+    return Mgtt::Common::Result<void>::Err(detachResult.error() + ": " + path);
+  }
+  const auto& detached = detachResult.value();
+  if (detached.detached && binChunk == nullptr) {
+    return Mgtt::Common::Result<void>::Err("GLB has no BIN chunk: " + path);
+  }
+
+  std::string err;
+  std::string warn;
+  tinygltf::TinyGLTF gltfContext;
+  gltfContext.SetImageLoader(CaptureEncodedImage, nullptr);
+
+  if (!gltfContext.LoadASCIIFromString(
+          &gltfModel, &err, &warn, detached.json.c_str(),
+          static_cast<unsigned int>(detached.json.size()),
+          ExtractFolderPath(path))) {
+    return Mgtt::Common::Result<void>::Err(
+        "Failed to load glTF file: " + path +
+        (err.empty() ? "" : " — " + err));
+  }
+  if (!detached.detached) {
+    return Mgtt::Common::Result<void>::Ok();
+  }
+
+  // Undo the redirection, the BIN chunk is read through the context
+  if (gltfModel.buffers.empty() ||
+      gltfModel.images.size() != detached.imageBufferViews.size()) {
+    return Mgtt::Common::Result<void>::Err(
+        "Unexpected glTF document after parsing: " + path);
+  }
+  std::vector<unsigned char>().swap(gltfModel.buffers[0].data);
+  gltfModel.buffers[0].uri.clear();
+  for (size_t idx = 0; idx < gltfModel.images.size(); ++idx) {
+    gltfModel.images[idx].bufferView = detached.imageBufferViews[idx];
+  }
+  if (detached.placeholderView >= 0) {
+    gltfModel.bufferViews.resize(
+        static_cast<size_t>(detached.placeholderView));
+  }
+  context.binChunk = binChunk;
+  context.binChunkSize = binChunkSize;
   return Mgtt::Common::Result<void>::Ok();
 }
 
@@ -119,6 +396,17 @@ std::string Mgtt::Rendering::GltfSceneImporter::ExtractFolderPath(
   return kSep != std::string::npos ? kPathStr.substr(0, kSep + 1) : "";
 }
 
+void Mgtt::Rendering::GltfSceneImporter::DiscardScene(
+    Mgtt::Rendering::Scene& scene) noexcept {
+  // Load makes no GL calls, so the caller's shader survives a failed load
+  Mgtt::Rendering::OpenGlShader shader = std::move(scene.shader);
+  for (auto& [key, texture] : scene.textureMap) {
+    FreeTextureData(texture);
+  }
+  Clear(scene);
+  scene.shader = std::move(shader);
+}
+
 void Mgtt::Rendering::GltfSceneImporter::FreeTextureData(
     Mgtt::Rendering::Texture& texture) {
   if (texture.data != nullptr) {
@@ -127,29 +415,351 @@ void Mgtt::Rendering::GltfSceneImporter::FreeTextureData(
   }
 }
 
-Mgtt::Common::Result<void> Mgtt::Rendering::GltfSceneImporter::LoadTextures(
-    Mgtt::Rendering::Scene& scene, tinygltf::Model& gltfModel) {
-  const auto kFolderPath = ExtractFolderPath(scene.path);
+void Mgtt::Rendering::GltfSceneImporter::SetTextureDecodeThreadCount(
+    uint32_t threadCount) noexcept {
+  textureDecodeThreadCount_ = threadCount;
+}
 
-  for (tinygltf::Texture& tex : gltfModel.textures) {
-    tinygltf::Image& image = gltfModel.images[tex.source];
+uint32_t Mgtt::Rendering::GltfSceneImporter::GetTextureDecodeThreadCount()
+    const noexcept {
+  return textureDecodeThreadCount_;
+}
 
-    Mgtt::Rendering::Texture texture;
-    texture.name = image.name;
-    texture.path = kFolderPath + image.uri;
-    texture.width = image.width;
-    texture.height = image.height;
-    texture.nrComponents = image.component;
+void Mgtt::Rendering::GltfSceneImporter::SetMemoryMappedGlb(
+    bool enabled) noexcept {
+  memoryMappedGlb_ = enabled;
+}
+
+bool Mgtt::Rendering::GltfSceneImporter::IsMemoryMappedGlb() const noexcept {
+  return memoryMappedGlb_;
+}
+
+void Mgtt::Rendering::GltfSceneImporter::SetCacheDirectory(
+    std::string_view directory, uint64_t sizeLimit) {
+  sceneCache_.SetDirectory(directory);
+  sceneCache_.SetSizeLimit(sizeLimit);
+}
+
+const unsigned char* Mgtt::Rendering::GltfSceneImporter::BufferData(
+    const tinygltf::Model& model, const LoadContext& context,
+    int bufferIndex) {
+  if (context.binChunk != nullptr && bufferIndex == 0) {
+    return context.binChunk;
+  }
+  return model.buffers[static_cast<size_t>(bufferIndex)].data.data();
+}
+
+size_t Mgtt::Rendering::GltfSceneImporter::BufferSize(
+    const tinygltf::Model& model, const LoadContext& context,
+    int bufferIndex) {
+  if (context.binChunk != nullptr && bufferIndex == 0) {
+    return context.binChunkSize;
+  }
+  return model.buffers[static_cast<size_t>(bufferIndex)].data.size();
+}
+
+const unsigned char* Mgtt::Rendering::GltfSceneImporter::AccessorData(
+    const tinygltf::Model& model, const LoadContext& context,
+    const tinygltf::Accessor& accessor) {
+  const auto& view = model.bufferViews[accessor.bufferView];
+  return BufferData(model, context, view.buffer) + accessor.byteOffset +
+         view.byteOffset;
+}
+
+size_t Mgtt::Rendering::GltfSceneImporter::AccessorStride(
+    const tinygltf::Model& model, const tinygltf::Accessor& accessor,
+    size_t packedSize) {
+  const int32_t kStride =
+      accessor.ByteStride(model.bufferViews[accessor.bufferView]);
+  return kStride > 0 ? static_cast<size_t>(kStride) : packedSize;
+}
+
+Mgtt::Common::Result<void>
+Mgtt::Rendering::GltfSceneImporter::CheckAccessorBounds(
+    const tinygltf::Model& model, const LoadContext& context,
+    const tinygltf::Accessor& accessor, size_t elementSize, bool packed) {
+  if (accessor.bufferView < 0 ||
+      static_cast<size_t>(accessor.bufferView) >= model.bufferViews.size()) {
+    return Mgtt::Common::Result<void>::Err("Invalid bufferView index");
+  }
+  const auto& view =
+      model.bufferViews[static_cast<size_t>(accessor.bufferView)];
+  if (view.buffer < 0 ||
+      static_cast<size_t>(view.buffer) >= model.buffers.size()) {
+    return Mgtt::Common::Result<void>::Err("Invalid buffer index");
+  }
+  const size_t kStride =
+      packed ? elementSize : AccessorStride(model, accessor, elementSize);
+  // The last element must end inside the buffer
+  const size_t kByteOffset = view.byteOffset + accessor.byteOffset;
+  const size_t kBufferSize = BufferSize(model, context, view.buffer);
+  if (accessor.count > 0 &&
+      (kByteOffset > kBufferSize ||
+       (accessor.count - 1) > (kBufferSize - kByteOffset) / kStride ||
+       kByteOffset + (accessor.count - 1) * kStride + elementSize >
+           kBufferSize)) {
+    return Mgtt::Common::Result<void>::Err("Accessor exceeds its buffer");
+  }
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+Mgtt::Common::Result<void>
+Mgtt::Rendering::GltfSceneImporter::ReadFloatAccessor(
+    const tinygltf::Model& model, const LoadContext& context,
+    int accessorIndex, int components, std::vector<float>& values) {
+  if (accessorIndex < 0 ||
+      static_cast<size_t>(accessorIndex) >= model.accessors.size()) {
+    return Mgtt::Common::Result<void>::Err("Invalid accessor index");
+  }
+  const auto& acc = model.accessors[static_cast<size_t>(accessorIndex)];
+  if (acc.bufferView < 0 ||
+      tinygltf::GetNumComponentsInType(static_cast<uint32_t>(acc.type)) !=
+          components) {
+    return Mgtt::Common::Result<void>::Err(
+        "Unexpected accessor type for instance attribute");
+  }
+
+  // Normalized integers map to [-1, 1] or [0, 1] as defined by glTF
+  size_t componentSize = 0;
+  float (*toFloat)(const unsigned char*) = nullptr;
+  switch (static_cast<GLTFParameterType>(acc.componentType)) {
+    case GLTFParameterType::FLOAT:
+      componentSize = sizeof(float);
+      toFloat = [](const unsigned char* src) {
+        float value = 0.0f;
+        std::memcpy(&value, src, sizeof(value));
+        return value;
+      };
+      break;
+    case GLTFParameterType::BYTE:
+      componentSize = sizeof(int8_t);
+      toFloat = [](const unsigned char* src) {
+        int8_t value = 0;
+        std::memcpy(&value, src, sizeof(value));
+        return std::max(static_cast<float>(value) / 127.0f, -1.0f);
+      };
+      break;
+    case GLTFParameterType::UNSIGNED_BYTE:
+      componentSize = sizeof(uint8_t);
+      toFloat = [](const unsigned char* src) {
+        return static_cast<float>(*src) / 255.0f;
+      };
+      break;
+    case GLTFParameterType::SHORT:
+      componentSize = sizeof(int16_t);
+      toFloat = [](const unsigned char* src) {
+        int16_t value = 0;
+        std::memcpy(&value, src, sizeof(value));
+        return std::max(static_cast<float>(value) / 32767.0f, -1.0f);
+      };
+      break;
+    case GLTFParameterType::UNSIGNED_SHORT:
+      componentSize = sizeof(uint16_t);
+      toFloat = [](const unsigned char* src) {
+        uint16_t value = 0;
+        std::memcpy(&value, src, sizeof(value));
+        return static_cast<float>(value) / 65535.0f;
+      };
+      break;
+    default:
+      return Mgtt::Common::Result<void>::Err(
+          "Unsupported component type for instance attribute");
+  }
+  if (componentSize != sizeof(float) && !acc.normalized) {
+    return Mgtt::Common::Result<void>::Err(
+        "Integer instance attributes must be normalized");
+  }
+
+  const size_t kComponents = static_cast<size_t>(components);
+  const size_t kElementSize = componentSize * kComponents;
+  if (auto result = CheckAccessorBounds(model, context, acc, kElementSize);
+      result.err()) {
+    return result;
+  }
+  const size_t kStride = AccessorStride(model, acc, kElementSize);
+  const unsigned char* src = AccessorData(model, context, acc);
+  values.resize(acc.count * kComponents);
+  for (size_t idx = 0; idx < acc.count; ++idx) {
+    for (size_t comp = 0; comp < kComponents; ++comp) {
+      values[idx * kComponents + comp] =
+          toFloat(src + idx * kStride + comp * componentSize);
+    }
+  }
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+Mgtt::Common::Result<void>
+Mgtt::Rendering::GltfSceneImporter::LoadInstanceMatrices(
+    const tinygltf::Node& node, const tinygltf::Model& model,
+    const LoadContext& context, std::vector<glm::mat4>& instanceMatrices) {
+  const auto kExtension = node.extensions.find("EXT_mesh_gpu_instancing");
+  if (kExtension == node.extensions.end() ||
+      !kExtension->second.Has("attributes")) {
+    return Mgtt::Common::Result<void>::Ok();
+  }
+  const tinygltf::Value& attributes = kExtension->second.Get("attributes");
+
+  std::vector<float> translations;
+  std::vector<float> rotations;
+  std::vector<float> scales;
+  const std::pair<const char*, std::pair<int, std::vector<float>*>> kInputs[] =
+      {{"TRANSLATION", {3, &translations}},
+       {"ROTATION", {4, &rotations}},
+       {"SCALE", {3, &scales}}};
+
+  // All present attributes must agree on the instance count
+  size_t instanceCount = 0;
+  bool hasInstances = false;
+  for (const auto& [name, input] : kInputs) {
+    if (!attributes.Has(name)) {
+      continue;
+    }
+    const auto& [components, values] = input;
+    if (auto result = ReadFloatAccessor(model, context,
+                                        attributes.Get(name).GetNumberAsInt(),
+                                        components, *values);
+        result.err()) {
+      return Mgtt::Common::Result<void>::Err(
+          std::string("EXT_mesh_gpu_instancing ") + name + ": " +
+          result.error());
+    }
+    const size_t kCount = values->size() / static_cast<size_t>(components);
+    if (hasInstances && kCount != instanceCount) {
+      return Mgtt::Common::Result<void>::Err(
+          "EXT_mesh_gpu_instancing attributes differ in instance count");
+    }
+    instanceCount = kCount;
+    hasInstances = true;
+  }
+
+  instanceMatrices.resize(instanceCount);
+  for (size_t idx = 0; idx < instanceCount; ++idx) {
+    const glm::vec3 kTranslation =
+        translations.empty() ? glm::vec3(0.0f)
+                             : glm::make_vec3(&translations[idx * 3]);
+    // glTF stores quaternions as x, y, z, w
+    const glm::quat kRotation =
+        rotations.empty()
+            ? glm::quat(1.0f, 0.0f, 0.0f, 0.0f)
+            : glm::quat(rotations[idx * 4 + 3], rotations[idx * 4],
+                        rotations[idx * 4 + 1], rotations[idx * 4 + 2]);
+    const glm::vec3 kScale =
+        scales.empty() ? glm::vec3(1.0f) : glm::make_vec3(&scales[idx * 3]);
+    instanceMatrices[idx] = glm::translate(glm::mat4(1.0f), kTranslation) *
+                            glm::toMat4(kRotation) *
+                            glm::scale(glm::mat4(1.0f), kScale);
+  }
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+std::string Mgtt::Rendering::GltfSceneImporter::TextureKey(
+    const tinygltf::Model& model, int imageIndex) {
+  const auto& image = model.images[static_cast<size_t>(imageIndex)];
+  return image.uri.empty() ? "#image" + std::to_string(imageIndex)
+                           : image.uri;
+}
+
+void Mgtt::Rendering::GltfSceneImporter::DecodeTexture(
+    Mgtt::Rendering::Texture& texture, const std::string& folderPath,
+    const tinygltf::Model& model, const LoadContext& context,
+    int imageIndex) const {
+  const tinygltf::Image& image = model.images[static_cast<size_t>(imageIndex)];
+  texture.name = image.name;
+  texture.path = folderPath + TextureKey(model, imageIndex);
+  texture.width = image.width;
+  texture.height = image.height;
+  texture.nrComponents = image.component;
+
+  if (image.bufferView > -1) {
+    // Embedded image, decoded straight from the (possibly mapped) buffer
+    const auto& view = model.bufferViews[static_cast<size_t>(image.bufferView)];
+    if (view.byteOffset + view.byteLength >
+            BufferSize(model, context, view.buffer) ||
+        view.byteLength > static_cast<size_t>(INT_MAX)) {
+      return;
+    }
+    texture.data = stbi_load_from_memory(
+        BufferData(model, context, view.buffer) + view.byteOffset,
+        static_cast<int>(view.byteLength), &texture.width, &texture.height,
+        &texture.nrComponents, 0);
+    return;
+  }
+
+  if (!image.image.empty()) {
+    // Encoded bytes of an external file or data URI, see CaptureEncodedImage
+    if (image.image.size() > static_cast<size_t>(INT_MAX)) {
+      return;
+    }
+    texture.data = stbi_load_from_memory(
+        image.image.data(), static_cast<int>(image.image.size()),
+        &texture.width, &texture.height, &texture.nrComponents, 0);
+    return;
+  }
+
+  if (!image.uri.empty()) {
     texture.data = stbi_load(texture.path.c_str(), &texture.width,
                              &texture.height, &texture.nrComponents, 0);
+  }
+}
 
+Mgtt::Common::Result<void> Mgtt::Rendering::GltfSceneImporter::LoadTextures(
+    Mgtt::Rendering::Scene& scene, tinygltf::Model& gltfModel,
+    const LoadContext& context) {
+  const auto kFolderPath = ExtractFolderPath(scene.path);
+
+  // Decode every referenced image once, in glTF texture order
+  std::vector<int> sources;
+  sources.reserve(gltfModel.textures.size());
+  for (const tinygltf::Texture& tex : gltfModel.textures) {
+    if (tex.source > -1 &&
+        std::find(sources.begin(), sources.end(), tex.source) ==
+            sources.end()) {
+      sources.push_back(tex.source);
+    }
+  }
+
+  std::vector<Mgtt::Rendering::Texture> textures(sources.size());
+  std::atomic<size_t> decodedCount{0};
+  auto decodeAt = [&](size_t slot) {
+    if (IsLoadCancelled()) {
+      return;
+    }
+    DecodeTexture(textures[slot], kFolderPath, gltfModel, context,
+                  sources[slot]);
+    // Each slot owns a distinct image, so this is safe across workers
+    std::vector<unsigned char>().swap(
+        gltfModel.images[static_cast<size_t>(sources[slot])].image);
+    // Decoding dominates a cold load, so it spans most of the progress range
+    static_cast<void>(ReportProgress(
+        0.2f + 0.5f * static_cast<float>(decodedCount.fetch_add(1) + 1) /
+                   static_cast<float>(textures.size())));
+  };
+
+  // Workers pull the next undecoded slot until all images are done
+  ParallelFor(textures.size(), textureDecodeThreadCount_, decodeAt);
+
+  if (IsLoadCancelled()) {
+    for (auto& decoded : textures) {
+      FreeTextureData(decoded);
+    }
+    return Mgtt::Common::Result<void>::Err("Load cancelled: " + scene.path);
+  }
+
+  for (auto& texture : textures) {
     if (texture.data == nullptr) {
+      const std::string kFailedPath = texture.path;
+      for (auto& decoded : textures) {
+        FreeTextureData(decoded);
+      }
       return Mgtt::Common::Result<void>::Err("Failed to load texture: " +
-                                             texture.path);
+                                             kFailedPath);
     }
+  }
 
-    // GPU upload is deferred to SceneUploader::Upload()
-    scene.textureMap[image.uri] = std::move(texture);
+  // GPU upload is deferred to SceneUploader::Upload()
+  for (size_t slot = 0; slot < textures.size(); ++slot) {
+    scene.textureMap[TextureKey(gltfModel, sources[slot])] =
+        std::move(textures[slot]);
   }
 
   std::cout << "All textures loaded to RAM for scene " << scene.path << '\n';
@@ -159,11 +769,11 @@ Mgtt::Common::Result<void> Mgtt::Rendering::GltfSceneImporter::LoadTextures(
 void Mgtt::Rendering::GltfSceneImporter::LoadMaterials(
     Mgtt::Rendering::Scene& scene, tinygltf::Model& gltfModel) {
   auto lookupTex = [&](int texIndex) -> Mgtt::Rendering::Texture {
-    if (texIndex < 0) {
+    if (texIndex < 0 || gltfModel.textures[texIndex].source < 0) {
       return Texture{};
     }
-    const auto& uri = gltfModel.images[gltfModel.textures[texIndex].source].uri;
-    auto iter = scene.textureMap.find(uri);
+    auto iter = scene.textureMap.find(
+        TextureKey(gltfModel, gltfModel.textures[texIndex].source));
     return iter != scene.textureMap.end() ? iter->second : Texture{};
   };
 
@@ -206,216 +816,251 @@ void Mgtt::Rendering::GltfSceneImporter::LoadMaterials(
   std::cout << "Materials allocated from scene " << scene.path << '\n';
 }
 
-Mgtt::Common::Result<void> Mgtt::Rendering::GltfSceneImporter::LoadNode(
-    const std::shared_ptr<Mgtt::Rendering::Node>& parent,
-    Mgtt::Rendering::Scene& scene, const tinygltf::Node& node,
-    uint32_t nodeIndex, const tinygltf::Model& model) {
-  auto newNode = std::make_shared<Mgtt::Rendering::Node>();
-  newNode->index = nodeIndex;
-  newNode->parent = parent;
-  newNode->name = node.name;
-  newNode->pos = node.translation.size() == 3
-                     ? glm::vec3(glm::make_vec3(node.translation.data()))
-                     : glm::vec3(0.0f);
-  newNode->rot = node.rotation.size() == 4
-                     ? glm::quat(glm::make_quat(node.rotation.data()))
-                     : glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
-  newNode->scale = node.scale.size() == 3
-                       ? glm::vec3(glm::make_vec3(node.scale.data()))
-                       : glm::vec3(1.0f);
+Mgtt::Common::Result<uint32_t> Mgtt::Rendering::GltfSceneImporter::LoadNode(
+    uint32_t parent, Mgtt::Rendering::Scene& scene, const tinygltf::Node& node,
+    uint32_t nodeIndex, const tinygltf::Model& model, LoadContext& context) {
+  const uint32_t kNewIndex = scene.AddNode(parent);
+  // LoadMesh() does not add nodes, so the reference stays valid
+  auto& newNode = scene.nodes[kNewIndex];
+  newNode.index = nodeIndex;
+  newNode.name = node.name;
+  newNode.pos = node.translation.size() == 3
+                    ? glm::vec3(glm::make_vec3(node.translation.data()))
+                    : glm::vec3(0.0f);
+  newNode.rot = node.rotation.size() == 4
+                    ? glm::quat(glm::make_quat(node.rotation.data()))
+                    : glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+  newNode.scale = node.scale.size() == 3
+                      ? glm::vec3(glm::make_vec3(node.scale.data()))
+                      : glm::vec3(1.0f);
   if (node.matrix.size() == 16) {
-    newNode->matrix = glm::make_mat4x4(node.matrix.data());
+    newNode.matrix = glm::make_mat4x4(node.matrix.data());
   }
 
-  for (int childIdx : node.children) {
-    if (auto result = LoadNode(newNode, scene, model.nodes[childIdx],
-                               static_cast<uint32_t>(childIdx), model);
+  if (node.mesh > -1) {
+    // Nodes referencing the same glTF mesh share one Mesh
+    auto& cachedMesh = context.meshes[static_cast<size_t>(node.mesh)];
+    if (cachedMesh == nullptr) {
+      auto meshResult =
+          LoadMesh(scene, model.meshes[node.mesh], model, context);
+      if (meshResult.err()) {
+        return Mgtt::Common::Result<uint32_t>::Err(meshResult.error());
+      }
+      cachedMesh = std::move(meshResult.value());
+    }
+    newNode.mesh = cachedMesh;
+
+    if (auto result = LoadInstanceMatrices(node, model, context,
+                                           newNode.instanceMatrices);
         result.err()) {
-      return result;
+      return Mgtt::Common::Result<uint32_t>::Err(result.error());
     }
   }
 
-  if (node.mesh > -1) {
-    const tinygltf::Mesh& gltfMesh = model.meshes[node.mesh];
-    auto newMesh = std::make_shared<Mgtt::Rendering::Mesh>();
-
-    for (const tinygltf::Primitive& primitive : gltfMesh.primitives) {
-      const uint32_t kIndexStart =
-          static_cast<uint32_t>(newMesh->indices.size());
-      const uint32_t kVertexStart =
-          static_cast<uint32_t>(newMesh->vertexPositionAttribs.size());
-      uint32_t indexCount = 0;
-      uint32_t vertexCount = 0;
-
-      glm::vec3 posMin(FLT_MAX);
-      glm::vec3 posMax(-FLT_MAX);
-
-      const auto& posAccessor =
-          model.accessors[primitive.attributes.at("POSITION")];
-      const auto& posView = model.bufferViews[posAccessor.bufferView];
-      const auto* bufferPos = reinterpret_cast<const float*>(
-          model.buffers[posView.buffer].data.data() + posAccessor.byteOffset +
-          posView.byteOffset);
-      const int32_t kPosByteStride =
-          (posAccessor.ByteStride(posView) != 0)
-              ? posAccessor.ByteStride(posView) /
-                    static_cast<int32_t>(sizeof(float))
-              : tinygltf::GetNumComponentsInType(TINYGLTF_TYPE_VEC3);
-      posMin = glm::make_vec3(posAccessor.minValues.data());
-      posMax = glm::make_vec3(posAccessor.maxValues.data());
-      vertexCount = static_cast<uint32_t>(posAccessor.count);
-
-      const float* bufferNormals = nullptr;
-      int32_t normByteStride = 0;
-      if (auto iter = primitive.attributes.find("NORMAL");
-          iter != primitive.attributes.end()) {
-        const auto& acc = model.accessors[iter->second];
-        const auto& view = model.bufferViews[acc.bufferView];
-        bufferNormals = reinterpret_cast<const float*>(
-            model.buffers[view.buffer].data.data() + acc.byteOffset +
-            view.byteOffset);
-        normByteStride =
-            (acc.ByteStride(view) != 0)
-                ? acc.ByteStride(view) / static_cast<int32_t>(sizeof(float))
-                : tinygltf::GetNumComponentsInType(TINYGLTF_TYPE_VEC3);
-      }
+  if (parent == Mgtt::Rendering::Node::kNoParent) {
+    std::cout << "Allocated node " << newNode.name << " with index "
+              << nodeIndex << '\n';
+  }
+  return Mgtt::Common::Result<uint32_t>::Ok(kNewIndex);
+}
 
-      const float* bufferUV = nullptr;
-      int32_t uvByteStride = 0;
-      if (auto iter = primitive.attributes.find("TEXCOORD_0");
-          iter != primitive.attributes.end()) {
-        const auto& acc = model.accessors[iter->second];
-        const auto& view = model.bufferViews[acc.bufferView];
-        bufferUV = reinterpret_cast<const float*>(
-            model.buffers[view.buffer].data.data() + acc.byteOffset +
-            view.byteOffset);
-        uvByteStride =
-            (acc.ByteStride(view) != 0)
-                ? acc.ByteStride(view) / static_cast<int32_t>(sizeof(float))
-                : tinygltf::GetNumComponentsInType(TINYGLTF_TYPE_VEC2);
-      }
+Mgtt::Common::Result<std::shared_ptr<Mgtt::Rendering::Mesh>>
+Mgtt::Rendering::GltfSceneImporter::LoadMesh(
+    Mgtt::Rendering::Scene& scene, const tinygltf::Mesh& gltfMesh,
+    const tinygltf::Model& model, const LoadContext& context) {
+  using MeshResult =
+      Mgtt::Common::Result<std::shared_ptr<Mgtt::Rendering::Mesh>>;
+  auto newMesh = std::make_shared<Mgtt::Rendering::Mesh>();
+  newMesh->name = gltfMesh.name;
+
+  auto accessorData = [&](const tinygltf::Accessor& acc) {
+    return AccessorData(model, context, acc);
+  };
+  auto accessorStride = [&](const tinygltf::Accessor& acc,
+                            size_t packedSize) {
+    return AccessorStride(model, acc, packedSize);
+  };
+  // Copies read the (possibly mapped) buffer without further checks
+  auto checkBounds = [&](const char* name, const tinygltf::Accessor& acc,
+                         size_t elementSize, bool packed) {
+    auto result =
+        CheckAccessorBounds(model, context, acc, elementSize, packed);
+    return result.ok() ? result
+                       : Mgtt::Common::Result<void>::Err(
+                             std::string(name) + ": " + result.error());
+  };
 
-      for (size_t vtx = 0; vtx < posAccessor.count; ++vtx) {
-        newMesh->vertexPositionAttribs.push_back(
-            glm::make_vec3(&bufferPos[vtx * kPosByteStride]));
-        newMesh->vertexNormalAttribs.push_back(
-            (bufferNormals != nullptr)
-                ? glm::normalize(
-                      glm::make_vec3(&bufferNormals[vtx * normByteStride]))
-                : glm::vec3(0.0f));
-        newMesh->vertexTextureAttribs.push_back(
-            (bufferUV != nullptr)
-                ? glm::make_vec2(&bufferUV[vtx * uvByteStride])
-                : glm::vec2(0.0f));
+  // Size the vertex and index arrays once for all primitives
+  size_t totalVertices = 0;
+  size_t totalIndices = 0;
+  for (const tinygltf::Primitive& primitive : gltfMesh.primitives) {
+    // Checked up front so that a bogus count cannot size the arrays
+    const auto& posAccessor =
+        model.accessors[primitive.attributes.at("POSITION")];
+    if (auto result =
+            checkBounds("POSITION", posAccessor, sizeof(glm::vec3), false);
+        result.err()) {
+      return MeshResult::Err(result.error());
+    }
+    totalVertices += posAccessor.count;
+    if (primitive.indices > -1) {
+      totalIndices += model.accessors[primitive.indices].count;
+    }
+  }
+  newMesh->vertexPositionAttribs.resize(totalVertices);
+  newMesh->vertexNormalAttribs.resize(totalVertices, glm::vec3(0.0f));
+  newMesh->vertexTextureAttribs.resize(totalVertices, glm::vec2(0.0f));
+  // w = 0 marks tangents left for GenerateTangentSpace()
+  newMesh->vertexTangentAttribs.resize(totalVertices, glm::vec4(0.0f));
+  newMesh->indices.resize(totalIndices);
+
+  uint32_t nextIndex = 0;
+  uint32_t nextVertex = 0;
+  for (const tinygltf::Primitive& primitive : gltfMesh.primitives) {
+    const uint32_t kIndexStart = nextIndex;
+    const uint32_t kVertexStart = nextVertex;
+    uint32_t indexCount = 0;
+
+    const auto& posAccessor =
+        model.accessors[primitive.attributes.at("POSITION")];
+    const glm::vec3 kPosMin = glm::make_vec3(posAccessor.minValues.data());
+    const glm::vec3 kPosMax = glm::make_vec3(posAccessor.maxValues.data());
+    const uint32_t kVertexCount = static_cast<uint32_t>(posAccessor.count);
+
+    CopyAccessor(accessorData(posAccessor), posAccessor.count,
+                 accessorStride(posAccessor, sizeof(glm::vec3)),
+                 newMesh->vertexPositionAttribs.data() + kVertexStart);
+
+    if (auto iter = primitive.attributes.find("NORMAL");
+        iter != primitive.attributes.end()) {
+      const auto& acc = model.accessors[iter->second];
+      if (acc.count != posAccessor.count) {
+        return MeshResult::Err(
+            "NORMAL accessor count does not match POSITION count");
+      }
+      if (auto result = checkBounds("NORMAL", acc, sizeof(glm::vec3), false);
+          result.err()) {
+        return MeshResult::Err(result.error());
       }
+      CopyAccessor(accessorData(acc), acc.count,
+                   accessorStride(acc, sizeof(glm::vec3)),
+                   newMesh->vertexNormalAttribs.data() + kVertexStart);
+      NormalizeVectors(newMesh->vertexNormalAttribs.data() + kVertexStart,
+                       acc.count);
+    }
 
-      const bool kHasIndices = primitive.indices > -1;
-      if (kHasIndices) {
-        const auto& acc = model.accessors[primitive.indices];
-        const auto& bufView = model.bufferViews[acc.bufferView];
-        indexCount = static_cast<uint32_t>(acc.count);
-        const void* dataPtr = model.buffers[bufView.buffer].data.data() +
-                              acc.byteOffset + bufView.byteOffset;
-
-        switch (static_cast<GLTFParameterType>(acc.componentType)) {
-          case GLTFParameterType::UNSIGNED_INT: {
-            const auto* buf = static_cast<const uint32_t*>(dataPtr);
-            for (size_t idx = 0; idx < acc.count; ++idx) {
-              newMesh->indices.push_back(buf[idx] + kVertexStart);
-            }
-            break;
-          }
-          case GLTFParameterType::UNSIGNED_SHORT: {
-            const auto* buf = static_cast<const uint16_t*>(dataPtr);
-            for (size_t idx = 0; idx < acc.count; ++idx) {
-              newMesh->indices.push_back(buf[idx] + kVertexStart);
-            }
-            break;
-          }
-          case GLTFParameterType::UNSIGNED_BYTE: {
-            const auto* buf = static_cast<const uint8_t*>(dataPtr);
-            for (size_t idx = 0; idx < acc.count; ++idx) {
-              newMesh->indices.push_back(buf[idx] + kVertexStart);
-            }
-            break;
-          }
-          default:
-            return Mgtt::Common::Result<void>::Err(
-                "Unsupported index component type in primitive");
-        }
+    if (auto iter = primitive.attributes.find("TEXCOORD_0");
+        iter != primitive.attributes.end()) {
+      const auto& acc = model.accessors[iter->second];
+      if (acc.count != posAccessor.count) {
+        return MeshResult::Err(
+            "TEXCOORD_0 accessor count does not match POSITION count");
+      }
+      if (auto result =
+              checkBounds("TEXCOORD_0", acc, sizeof(glm::vec2), false);
+          result.err()) {
+        return MeshResult::Err(result.error());
       }
+      CopyAccessor(accessorData(acc), acc.count,
+                   accessorStride(acc, sizeof(glm::vec2)),
+                   newMesh->vertexTextureAttribs.data() + kVertexStart);
+    }
 
-      Mgtt::Rendering::MeshPrimitive prim;
-      prim.firstIndex = kIndexStart;
-      prim.indexCount = indexCount;
-      prim.vertexCount = vertexCount;
-      prim.hasIndices = kHasIndices;
-      prim.name = node.name;
-      prim.aabb.min = posMin;
-      prim.aabb.max = posMax;
-      if (primitive.material > -1) {
-        prim.pbrMaterial = std::move(scene.materials[primitive.material]);
+    if (auto iter = primitive.attributes.find("TANGENT");
+        iter != primitive.attributes.end()) {
+      const auto& acc = model.accessors[iter->second];
+      if (acc.count != posAccessor.count) {
+        return MeshResult::Err(
+            "TANGENT accessor count does not match POSITION count");
+      }
+      if (auto result = checkBounds("TANGENT", acc, sizeof(glm::vec4), false);
+          result.err()) {
+        return MeshResult::Err(result.error());
       }
-      newMesh->meshPrimitives.push_back(std::move(prim));
+      CopyAccessor(accessorData(acc), acc.count,
+                   accessorStride(acc, sizeof(glm::vec4)),
+                   newMesh->vertexTangentAttribs.data() + kVertexStart);
     }
 
-    for (const auto& meshPrim : newMesh->meshPrimitives) {
-      newMesh->aabb.min = glm::min(newMesh->aabb.min, meshPrim.aabb.min);
-      newMesh->aabb.max = glm::max(newMesh->aabb.max, meshPrim.aabb.max);
+    const bool kHasIndices = primitive.indices > -1;
+    if (kHasIndices) {
+      const auto& acc = model.accessors[primitive.indices];
+      indexCount = static_cast<uint32_t>(acc.count);
+
+      size_t componentSize = 0;
+      switch (static_cast<GLTFParameterType>(acc.componentType)) {
+        case GLTFParameterType::UNSIGNED_INT:
+          componentSize = sizeof(uint32_t);
+          break;
+        case GLTFParameterType::UNSIGNED_SHORT:
+          componentSize = sizeof(uint16_t);
+          break;
+        case GLTFParameterType::UNSIGNED_BYTE:
+          componentSize = sizeof(uint8_t);
+          break;
+        default:
+          return MeshResult::Err(
+              "Unsupported index component type in primitive");
+      }
+      if (auto result = checkBounds("Indices", acc, componentSize, true);
+          result.err()) {
+        return MeshResult::Err(result.error());
+      }
+      CopyIndices(accessorData(acc), acc.count, componentSize,
+                  kVertexStart, newMesh->indices.data() + kIndexStart);
     }
+    nextIndex += indexCount;
+    nextVertex += kVertexCount;
 
-    // GPU upload deferred to SceneUploader::Upload()
-    newNode->mesh = std::move(newMesh);
+    Mgtt::Rendering::MeshPrimitive prim;
+    prim.firstIndex = kIndexStart;
+    prim.indexCount = indexCount;
+    prim.vertexCount = kVertexCount;
+    prim.hasIndices = kHasIndices;
+    prim.name = gltfMesh.name;
+    prim.aabb.min = kPosMin;
+    prim.aabb.max = kPosMax;
+    if (primitive.material > -1) {
+      prim.pbrMaterial = std::move(scene.materials[primitive.material]);
+    }
+    newMesh->meshPrimitives.push_back(std::move(prim));
   }
 
-  if (parent != nullptr) {
-    parent->children.push_back(std::move(newNode));
-  } else {
-    std::cout << "Allocated node " << newNode->name << " with index "
-              << nodeIndex << '\n';
-    scene.nodes.push_back(std::move(newNode));
+  for (const auto& meshPrim : newMesh->meshPrimitives) {
+    newMesh->aabb.min = glm::min(newMesh->aabb.min, meshPrim.aabb.min);
+    newMesh->aabb.max = glm::max(newMesh->aabb.max, meshPrim.aabb.max);
   }
-  return Mgtt::Common::Result<void>::Ok();
-}
 
-void Mgtt::Rendering::GltfSceneImporter::UpdateNodeMeshMatrices(
-    const std::shared_ptr<Mgtt::Rendering::Node>& node) {
-  if (node->mesh != nullptr) {
-    node->InitialTransform();
-  }
-  for (const auto& child : node->children) {
-    UpdateNodeMeshMatrices(child);
-  }
+  // GPU upload deferred to SceneUploader::Upload()
+  return MeshResult::Ok(std::move(newMesh));
 }
 
 void Mgtt::Rendering::GltfSceneImporter::CalculateSceneDimensions(
     Mgtt::Rendering::Scene& scene) {
-  for (const auto& node : scene.nodes) {
+  // World matrices come from Scene::transforms, so one linear pass suffices
+  for (auto& node : scene.nodes) {
+    if (node.mesh == nullptr) {
+      continue;
+    }
     CalculateSceneNodesAABBs(node);
-  }
-  for (const auto& node : scene.nodes) {
-    CalculateSceneAABB(scene, node);
-  }
-}
-
-void Mgtt::Rendering::GltfSceneImporter::CalculateSceneAABB(
-    Mgtt::Rendering::Scene& scene,
-    const std::shared_ptr<Mgtt::Rendering::Node>& node) {
-  if (node->mesh != nullptr) {
-    scene.aabb.min = glm::min(scene.aabb.min, node->mesh->aabb.min);
-    scene.aabb.max = glm::max(scene.aabb.max, node->mesh->aabb.max);
-  }
-  for (const auto& child : node->children) {
-    CalculateSceneAABB(scene, child);
+    scene.aabb.min = glm::min(scene.aabb.min, node.aabb.min);
+    scene.aabb.max = glm::max(scene.aabb.max, node.aabb.max);
   }
 }
 
 void Mgtt::Rendering::GltfSceneImporter::CalculateSceneNodesAABBs(
-    const std::shared_ptr<Mgtt::Rendering::Node>& node) {
-  if (node->mesh != nullptr) {
-    node->mesh->aabb.CalculateBoundingBox(node->GetGlobalMatrix());
+    Mgtt::Rendering::Node& node) {
+  if (node.instanceMatrices.empty()) {
+    node.aabb = node.mesh->aabb;
+    node.aabb.CalculateBoundingBox(node.worldMatrix);
+    return;
   }
-  for (const auto& child : node->children) {
-    CalculateSceneNodesAABBs(child);
+  // Instanced nodes are bounded by the union of all instances
+  node.aabb = Mgtt::Rendering::AABB();
+  for (const auto& instanceMatrix : node.instanceMatrices) {
+    Mgtt::Rendering::AABB instanceAabb = node.mesh->aabb;
+    instanceAabb.CalculateBoundingBox(node.worldMatrix * instanceMatrix);
+    node.aabb.min = glm::min(node.aabb.min, instanceAabb.min);
+    node.aabb.max = glm::max(node.aabb.max, instanceAabb.max);
   }
 }
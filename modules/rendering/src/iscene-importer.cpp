@@ -0,0 +1,143 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iscene-importer.h>
+#include <mesh-optimizer.h>
+#include <mesh-simplifier.h>
+#include <meshlet-builder.h>
+#include <tangent-space.h>
+#include <vertex-weld.h>
+
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <unordered_set>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+namespace {
+
+/**
+ * @brief Distinct meshes referenced by the nodes of a scene.
+ */
+std::vector<Mgtt::Rendering::Mesh*> CollectMeshes(
+    const Mgtt::Rendering::Scene& scene) {
+  std::vector<Mgtt::Rendering::Mesh*> meshes;
+  std::unordered_set<const Mgtt::Rendering::Mesh*> visited;
+  for (const auto& node : scene.nodes) {
+    if (node.mesh != nullptr && visited.insert(node.mesh.get()).second) {
+      meshes.push_back(node.mesh.get());
+    }
+  }
+  return meshes;
+}
+
+}  // namespace
+
+std::string ISceneImporter::GetImportOptions() const {
+  std::ostringstream options;
+  if (tangentGeneration_) {
+    options << "tangents;";
+  }
+  if (vertexWelding_) {
+    // Hex floats are exact, so any epsilon change misses the cache
+    options << "weld=" << std::hexfloat << vertexWeldEpsilon_ << ';';
+  }
+  if (meshOptimization_) {
+    options << "optimize;";
+  }
+  if (meshletGeneration_) {
+    options << "meshlets;";
+  }
+  if (lodGeneration_) {
+    options << "lod;";
+  }
+  return options.str();
+}
+
+Mgtt::Common::Result<void> ISceneImporter::ProcessMeshes(
+    Mgtt::Rendering::Scene& scene) const {
+  // Welding comes first so normals are averaged across the faces of
+  // duplicated vertices. Generation alone still merges exact duplicates.
+  if (vertexWelding_ || tangentGeneration_) {
+    const float kEpsilon = vertexWelding_ ? vertexWeldEpsilon_ : 0.0f;
+    size_t removed = 0;
+    for (auto* mesh : CollectMeshes(scene)) {
+      auto result = Mgtt::Rendering::WeldVertices(*mesh, kEpsilon);
+      if (result.err()) {
+        return Mgtt::Common::Result<void>::Err(result.error());
+      }
+      removed += result.value();
+    }
+    std::cout << "Vertex welding removed " << removed << " vertices\n";
+  }
+
+  if (tangentGeneration_) {
+    auto result =
+        Mgtt::Rendering::GenerateTangentSpace(scene, tangentThreadCount_);
+    if (result.err()) {
+      return Mgtt::Common::Result<void>::Err(result.error());
+    }
+    std::cout << "Tangent generation completed " << result.value()
+              << " vertices\n";
+  }
+
+  if (meshOptimization_) {
+    auto result = Mgtt::Rendering::OptimizeMeshes(scene);
+    if (result.err()) {
+      return Mgtt::Common::Result<void>::Err(result.error());
+    }
+    const auto& report = result.value();
+    std::cout << "Mesh optimization: ACMR " << report.before.acmr << " -> "
+              << report.after.acmr << ", ATVR " << report.before.atvr
+              << " -> " << report.after.atvr << '\n';
+  }
+
+  if (meshletGeneration_) {
+    size_t meshlets = 0;
+    for (auto* mesh : CollectMeshes(scene)) {
+      auto result = Mgtt::Rendering::BuildMeshlets(*mesh);
+      if (result.err()) {
+        return Mgtt::Common::Result<void>::Err(result.error());
+      }
+      meshlets += result.value();
+    }
+    std::cout << "Meshlet generation built " << meshlets << " meshlets\n";
+  }
+
+  if (lodGeneration_) {
+    size_t levels = 0;
+    for (auto* mesh : CollectMeshes(scene)) {
+      if (auto result = Mgtt::Rendering::GenerateLods(*mesh); result.err()) {
+        return result;
+      }
+      for (const auto& prim : mesh->meshPrimitives) {
+        levels += prim.lods.size();
+      }
+    }
+    std::cout << "LOD generation built " << levels << " levels\n";
+  }
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,166 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <mapped-file.h>
+
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mgtt::Rendering {
+
+MappedFile::~MappedFile() noexcept { Close(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0))
+#ifdef _WIN32
+      ,
+      file_(std::exchange(other.file_, nullptr)),
+      mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    Close();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+    file_ = std::exchange(other.file_, nullptr);
+    mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+  }
+  return *this;
+}
+
+Mgtt::Common::Result<void> MappedFile::Open(std::string_view path) {
+  Close();
+  const std::string kPathStr(path);
+
+#ifdef _WIN32
+  HANDLE file = CreateFileA(kPathStr.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return Mgtt::Common::Result<void>::Err("Failed to open file: " +
+                                           kPathStr);
+  }
+
+  LARGE_INTEGER fileSize{};
+  if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+    CloseHandle(file);
+    return Mgtt::Common::Result<void>::Err("Empty or unreadable file: " +
+                                           kPathStr);
+  }
+
+  HANDLE mapping =
+      CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr) {
+    CloseHandle(file);
+    return Mgtt::Common::Result<void>::Err("Failed to map file: " + kPathStr);
+  }
+
+  const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (view == nullptr) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return Mgtt::Common::Result<void>::Err("Failed to map file: " + kPathStr);
+  }
+
+  file_ = file;
+  mapping_ = mapping;
+  data_ = static_cast<const unsigned char*>(view);
+  size_ = static_cast<size_t>(fileSize.QuadPart);
+#else
+  const int kFd = open(kPathStr.c_str(), O_RDONLY);
+  if (kFd < 0) {
+    return Mgtt::Common::Result<void>::Err("Failed to open file: " +
+                                           kPathStr);
+  }
+
+  struct stat fileStat {};
+  if (fstat(kFd, &fileStat) != 0 || fileStat.st_size <= 0) {
+    close(kFd);
+    return Mgtt::Common::Result<void>::Err("Empty or unreadable file: " +
+                                           kPathStr);
+  }
+
+  const size_t kSize = static_cast<size_t>(fileStat.st_size);
+  void* view = mmap(nullptr, kSize, PROT_READ, MAP_PRIVATE, kFd, 0);
+  // The mapping keeps its own reference to the file
+  close(kFd);
+  if (view == MAP_FAILED) {
+    return Mgtt::Common::Result<void>::Err("Failed to map file: " + kPathStr);
+  }
+#ifdef MADV_SEQUENTIAL
+  madvise(view, kSize, MADV_SEQUENTIAL);
+#endif
+
+  data_ = static_cast<const unsigned char*>(view);
+  size_ = kSize;
+#endif
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+void MappedFile::Close() noexcept {
+#ifdef _WIN32
+  if (data_ != nullptr) {
+    UnmapViewOfFile(data_);
+  }
+  if (mapping_ != nullptr) {
+    CloseHandle(mapping_);
+    mapping_ = nullptr;
+  }
+  if (file_ != nullptr) {
+    CloseHandle(file_);
+    file_ = nullptr;
+  }
+#else
+  if (data_ != nullptr) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    munmap(const_cast<unsigned char*>(data_), size_);
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0;
+}
+
+const unsigned char* MappedFile::Data() const noexcept { return data_; }
+
+size_t MappedFile::Size() const noexcept { return size_; }
+
+bool MappedFile::IsOpen() const noexcept { return data_ != nullptr; }
+
+}  // namespace Mgtt::Rendering
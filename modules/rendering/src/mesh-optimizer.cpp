@@ -0,0 +1,427 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <mesh-optimizer.h>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <unordered_set>
+
+namespace Mgtt::Rendering {
+
+namespace {
+
+/**
+ * @brief FIFO cache simulated with per-vertex timestamps: a vertex is
+ * cached while fewer than cacheSize misses happened since it was loaded.
+ */
+class FifoCache {
+ public:
+  FifoCache(size_t vertexCount, uint32_t cacheSize)
+      : cacheTime_(vertexCount, 0),
+        cacheSize_(cacheSize),
+        timestamp_(cacheSize + 1) {}
+
+  /**
+   * @brief Reference a vertex.
+   *
+   * @return True on a miss.
+   */
+  bool Touch(uint32_t vertex) {
+    if (timestamp_ - cacheTime_[vertex] > cacheSize_) {
+      cacheTime_[vertex] = timestamp_++;
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Number of misses since the vertex was loaded.
+   */
+  [[nodiscard]] uint32_t Age(uint32_t vertex) const {
+    return timestamp_ - cacheTime_[vertex];
+  }
+
+  /**
+   * @brief Evict every vertex.
+   */
+  void Flush() { timestamp_ += cacheSize_ + 1; }
+
+ private:
+  std::vector<uint32_t> cacheTime_;
+  uint32_t cacheSize_;
+  uint32_t timestamp_;
+};
+
+Mgtt::Rendering::VertexCacheStats FinishStats(
+    Mgtt::Rendering::VertexCacheStats stats) {
+  stats.acmr = stats.triangleCount > 0
+                   ? static_cast<float>(stats.transformedCount) /
+                         static_cast<float>(stats.triangleCount)
+                   : 0.0f;
+  stats.atvr = stats.vertexCount > 0
+                   ? static_cast<float>(stats.transformedCount) /
+                         static_cast<float>(stats.vertexCount)
+                   : 0.0f;
+  return stats;
+}
+
+void AddStats(Mgtt::Rendering::VertexCacheStats& sum,
+              const Mgtt::Rendering::VertexCacheStats& stats) {
+  sum.triangleCount += stats.triangleCount;
+  sum.vertexCount += stats.vertexCount;
+  sum.transformedCount += stats.transformedCount;
+  sum = FinishStats(sum);
+}
+
+template <typename T>
+void RemapAttribs(std::vector<T>& attribs, const std::vector<uint32_t>& remap) {
+  if (attribs.size() != remap.size()) {
+    return;
+  }
+  std::vector<T> reordered(attribs.size());
+  for (size_t idx = 0; idx < remap.size(); ++idx) {
+    reordered[remap[idx]] = attribs[idx];
+  }
+  attribs = std::move(reordered);
+}
+
+}  // namespace
+
+Mgtt::Rendering::VertexCacheStats AnalyzeVertexCache(const uint32_t* indices,
+                                                     size_t indexCount,
+                                                     size_t vertexCount,
+                                                     uint32_t cacheSize) {
+  Mgtt::Rendering::VertexCacheStats stats;
+  const size_t kCornerCount = indexCount / 3 * 3;
+  FifoCache cache(vertexCount, cacheSize);
+  std::vector<bool> referenced(vertexCount, false);
+  for (size_t idx = 0; idx < kCornerCount; ++idx) {
+    const uint32_t kVertex = indices[idx];
+    if (cache.Touch(kVertex)) {
+      ++stats.transformedCount;
+    }
+    if (!referenced[kVertex]) {
+      referenced[kVertex] = true;
+      ++stats.vertexCount;
+    }
+  }
+  stats.triangleCount = kCornerCount / 3;
+  return FinishStats(stats);
+}
+
+std::vector<uint32_t> OptimizeVertexCache(const uint32_t* indices,
+                                          size_t indexCount,
+                                          size_t vertexCount,
+                                          uint32_t cacheSize) {
+  const size_t kTriangleCount = indexCount / 3;
+  std::vector<uint32_t> result;
+  result.reserve(kTriangleCount * 3);
+  if (kTriangleCount == 0) {
+    return result;
+  }
+
+  // Vertex to triangle adjacency in compressed rows
+  std::vector<uint32_t> liveTriangles(vertexCount, 0);
+  for (size_t idx = 0; idx < kTriangleCount * 3; ++idx) {
+    ++liveTriangles[indices[idx]];
+  }
+  std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+  std::partial_sum(liveTriangles.begin(), liveTriangles.end(),
+                   adjacencyOffsets.begin() + 1);
+  std::vector<uint32_t> adjacency(kTriangleCount * 3);
+  {
+    std::vector<uint32_t> fill(adjacencyOffsets.begin(),
+                               adjacencyOffsets.end() - 1);
+    for (size_t idx = 0; idx < kTriangleCount * 3; ++idx) {
+      adjacency[fill[indices[idx]]++] = static_cast<uint32_t>(idx / 3);
+    }
+  }
+
+  FifoCache cache(vertexCount, cacheSize);
+  std::vector<bool> emitted(kTriangleCount, false);
+  std::vector<uint32_t> deadEnds;
+  std::vector<uint32_t> candidates;
+  size_t cursor = 0;
+  int64_t fanning = indices[0];
+
+  while (fanning >= 0) {
+    const auto kFanning = static_cast<uint32_t>(fanning);
+    candidates.clear();
+    for (uint32_t adj = adjacencyOffsets[kFanning];
+         adj < adjacencyOffsets[kFanning + 1]; ++adj) {
+      const uint32_t kTriangle = adjacency[adj];
+      if (emitted[kTriangle]) {
+        continue;
+      }
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const uint32_t kVertex = indices[kTriangle * 3 + corner];
+        result.push_back(kVertex);
+        deadEnds.push_back(kVertex);
+        candidates.push_back(kVertex);
+        --liveTriangles[kVertex];
+        cache.Touch(kVertex);
+      }
+      emitted[kTriangle] = true;
+    }
+
+    // Prefer the oldest candidate whose remaining fan still fits the cache
+    fanning = -1;
+    int64_t bestPriority = -1;
+    for (const uint32_t kVertex : candidates) {
+      if (liveTriangles[kVertex] == 0) {
+        continue;
+      }
+      int64_t priority = 0;
+      if (cache.Age(kVertex) + 2 * liveTriangles[kVertex] <= cacheSize) {
+        priority = cache.Age(kVertex);
+      }
+      if (priority > bestPriority) {
+        bestPriority = priority;
+        fanning = kVertex;
+      }
+    }
+
+    // Dead end: back up to a recently used vertex, then scan input order
+    while (fanning < 0 && !deadEnds.empty()) {
+      const uint32_t kVertex = deadEnds.back();
+      deadEnds.pop_back();
+      if (liveTriangles[kVertex] > 0) {
+        fanning = kVertex;
+      }
+    }
+    for (; fanning < 0 && cursor < vertexCount; ++cursor) {
+      if (liveTriangles[cursor] > 0) {
+        fanning = static_cast<int64_t>(cursor);
+      }
+    }
+  }
+  return result;
+}
+
+std::vector<uint32_t> OptimizeOverdraw(const uint32_t* indices,
+                                       size_t indexCount,
+                                       const std::vector<glm::vec3>& positions,
+                                       const glm::vec3& center,
+                                       uint32_t cacheSize, float threshold) {
+  const size_t kTriangleCount = indexCount / 3;
+  if (kTriangleCount == 0) {
+    return {};
+  }
+
+  // Hard boundaries: triangles whose three vertices all miss the cache
+  FifoCache cache(positions.size(), cacheSize);
+  std::vector<uint32_t> misses(kTriangleCount, 0);
+  std::vector<size_t> hardStarts;
+  for (size_t tri = 0; tri < kTriangleCount; ++tri) {
+    for (size_t corner = 0; corner < 3; ++corner) {
+      misses[tri] += cache.Touch(indices[tri * 3 + corner]) ? 1u : 0u;
+    }
+    if (tri == 0 || misses[tri] == 3) {
+      hardStarts.push_back(tri);
+    }
+  }
+  hardStarts.push_back(kTriangleCount);
+
+  // Soft boundaries: cut a cluster once it is nearly as cache efficient,
+  // starting cold, as the hard cluster it belongs to
+  std::vector<size_t> clusterStarts;
+  for (size_t hard = 0; hard + 1 < hardStarts.size(); ++hard) {
+    const size_t kBegin = hardStarts[hard];
+    const size_t kEnd = hardStarts[hard + 1];
+    uint32_t hardMisses = 0;
+    for (size_t tri = kBegin; tri < kEnd; ++tri) {
+      hardMisses += misses[tri];
+    }
+    const float kHardAcmr =
+        static_cast<float>(hardMisses) / static_cast<float>(kEnd - kBegin);
+
+    cache.Flush();
+    size_t softBegin = kBegin;
+    uint32_t softMisses = 0;
+    clusterStarts.push_back(kBegin);
+    for (size_t tri = kBegin; tri < kEnd; ++tri) {
+      for (size_t corner = 0; corner < 3; ++corner) {
+        softMisses += cache.Touch(indices[tri * 3 + corner]) ? 1u : 0u;
+      }
+      const float kSoftAcmr = static_cast<float>(softMisses) /
+                              static_cast<float>(tri - softBegin + 1);
+      if (tri + 1 < kEnd && kSoftAcmr <= kHardAcmr * threshold) {
+        softBegin = tri + 1;
+        softMisses = 0;
+        cache.Flush();
+        clusterStarts.push_back(softBegin);
+      }
+    }
+  }
+  const size_t kClusterCount = clusterStarts.size();
+  clusterStarts.push_back(kTriangleCount);
+
+  // Clusters facing away from the center occlude the rest, draw them first
+  std::vector<float> sortKeys(kClusterCount, 0.0f);
+  for (size_t cluster = 0; cluster < kClusterCount; ++cluster) {
+    glm::vec3 centroid(0.0f);
+    glm::vec3 normal(0.0f);
+    float area = 0.0f;
+    for (size_t tri = clusterStarts[cluster]; tri < clusterStarts[cluster + 1];
+         ++tri) {
+      const glm::vec3& kP0 = positions[indices[tri * 3 + 0]];
+      const glm::vec3& kP1 = positions[indices[tri * 3 + 1]];
+      const glm::vec3& kP2 = positions[indices[tri * 3 + 2]];
+      const glm::vec3 kCross = glm::cross(kP1 - kP0, kP2 - kP0);
+      const float kArea = glm::length(kCross);
+      centroid += (kP0 + kP1 + kP2) * (kArea / 3.0f);
+      normal += kCross;
+      area += kArea;
+    }
+    const float kNormalLength = glm::length(normal);
+    if (area > 0.0f && kNormalLength > 0.0f) {
+      sortKeys[cluster] =
+          glm::dot(centroid / area - center, normal / kNormalLength);
+    }
+  }
+
+  std::vector<size_t> order(kClusterCount);
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return sortKeys[lhs] > sortKeys[rhs];
+  });
+
+  std::vector<uint32_t> result;
+  result.reserve(kTriangleCount * 3);
+  for (const size_t kCluster : order) {
+    result.insert(result.end(), indices + clusterStarts[kCluster] * 3,
+                  indices + clusterStarts[kCluster + 1] * 3);
+  }
+  return result;
+}
+
+void OptimizeVertexFetch(Mgtt::Rendering::Mesh& mesh) {
+  const size_t kVertexCount = mesh.vertexPositionAttribs.size();
+  constexpr uint32_t kUnassigned = ~0u;
+  std::vector<uint32_t> remap(kVertexCount, kUnassigned);
+  uint32_t next = 0;
+  for (const uint32_t kIdx : mesh.indices) {
+    if (remap[kIdx] == kUnassigned) {
+      remap[kIdx] = next++;
+    }
+  }
+  for (auto& slot : remap) {
+    if (slot == kUnassigned) {
+      slot = next++;
+    }
+  }
+
+  for (auto& index : mesh.indices) {
+    index = remap[index];
+  }
+  RemapAttribs(mesh.vertexPositionAttribs, remap);
+  RemapAttribs(mesh.vertexNormalAttribs, remap);
+  RemapAttribs(mesh.vertexTextureAttribs, remap);
+  RemapAttribs(mesh.vertexTangentAttribs, remap);
+  RemapAttribs(mesh.vertexJointAttribs, remap);
+  RemapAttribs(mesh.vertexWeightAttribs, remap);
+}
+
+Mgtt::Common::Result<Mgtt::Rendering::MeshOptimizationReport> OptimizeMesh(
+    Mgtt::Rendering::Mesh& mesh, float threshold) {
+  using Report = Mgtt::Rendering::MeshOptimizationReport;
+  const size_t kVertexCount = mesh.vertexPositionAttribs.size();
+  for (const uint32_t kIdx : mesh.indices) {
+    if (kIdx >= kVertexCount) {
+      return Mgtt::Common::Result<Report>::Err(
+          "Mesh index out of range in mesh " + mesh.name);
+    }
+  }
+
+  Report report;
+  for (auto& prim : mesh.meshPrimitives) {
+    if (prim.firstIndex + static_cast<size_t>(prim.indexCount) >
+        mesh.indices.size()) {
+      return Mgtt::Common::Result<Report>::Err(
+          "Mesh primitive index range out of bounds in mesh " + mesh.name);
+    }
+    uint32_t* const kRange = mesh.indices.data() + prim.firstIndex;
+    const size_t kRangeCount = prim.indexCount - prim.indexCount % 3;
+    AddStats(report.before,
+             AnalyzeVertexCache(kRange, kRangeCount, kVertexCount));
+    if (kRangeCount == 0) {
+      continue;
+    }
+
+    // Importers without primitive bounds leave the AABB inverted
+    glm::vec3 center(0.0f);
+    const auto& kAabb = prim.aabb;
+    if (kAabb.min.x <= kAabb.max.x && kAabb.min.y <= kAabb.max.y &&
+        kAabb.min.z <= kAabb.max.z) {
+      center = (kAabb.min + kAabb.max) * 0.5f;
+    } else {
+      glm::vec3 minPos = mesh.vertexPositionAttribs[kRange[0]];
+      glm::vec3 maxPos = minPos;
+      for (size_t idx = 0; idx < kRangeCount; ++idx) {
+        minPos = glm::min(minPos, mesh.vertexPositionAttribs[kRange[idx]]);
+        maxPos = glm::max(maxPos, mesh.vertexPositionAttribs[kRange[idx]]);
+      }
+      center = (minPos + maxPos) * 0.5f;
+    }
+
+    const auto kCacheOrder =
+        OptimizeVertexCache(kRange, kRangeCount, kVertexCount);
+    const auto kDrawOrder =
+        OptimizeOverdraw(kCacheOrder.data(), kCacheOrder.size(),
+                         mesh.vertexPositionAttribs, center, kVertexCacheSize,
+                         threshold);
+    std::copy(kDrawOrder.begin(), kDrawOrder.end(), kRange);
+  }
+
+  OptimizeVertexFetch(mesh);
+
+  for (const auto& prim : mesh.meshPrimitives) {
+    AddStats(report.after,
+             AnalyzeVertexCache(mesh.indices.data() + prim.firstIndex,
+                                prim.indexCount - prim.indexCount % 3,
+                                kVertexCount));
+  }
+  return Mgtt::Common::Result<Report>::Ok(report);
+}
+
+Mgtt::Common::Result<Mgtt::Rendering::MeshOptimizationReport> OptimizeMeshes(
+    Mgtt::Rendering::Scene& scene, float threshold) {
+  using Report = Mgtt::Rendering::MeshOptimizationReport;
+  Report report;
+  std::unordered_set<const Mgtt::Rendering::Mesh*> visited;
+  for (const auto& node : scene.nodes) {
+    if (node.mesh == nullptr || !visited.insert(node.mesh.get()).second) {
+      continue;
+    }
+    auto result = OptimizeMesh(*node.mesh, threshold);
+    if (result.err()) {
+      return result;
+    }
+    AddStats(report.before, result.value().before);
+    AddStats(report.after, result.value().after);
+  }
+  return Mgtt::Common::Result<Report>::Ok(report);
+}
+
+}  // namespace Mgtt::Rendering
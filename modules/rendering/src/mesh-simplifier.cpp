@@ -0,0 +1,567 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <mesh-optimizer.h>
+#include <mesh-simplifier.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace Mgtt::Rendering {
+
+namespace {
+
+constexpr uint32_t kNoVertex = ~0u;
+// Weight of border and seam edge quadrics relative to face quadrics
+constexpr double kEdgeWeight = 10.0;
+// Squared relative error charged per squared unit of attribute difference
+constexpr double kNormalWeight = 0.0025;
+constexpr double kTextureWeight = 0.0025;
+
+using Vec3d = std::array<double, 3>;
+
+Vec3d Sub(const Vec3d& lhs, const Vec3d& rhs) {
+  return {lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2]};
+}
+
+Vec3d Cross(const Vec3d& lhs, const Vec3d& rhs) {
+  return {lhs[1] * rhs[2] - lhs[2] * rhs[1], lhs[2] * rhs[0] - lhs[0] * rhs[2],
+          lhs[0] * rhs[1] - lhs[1] * rhs[0]};
+}
+
+double Dot(const Vec3d& lhs, const Vec3d& rhs) {
+  return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2];
+}
+
+/**
+ * @brief Weighted sum of squared distances to a set of planes, stored as
+ * the upper triangle of a symmetric 4x4 matrix.
+ */
+struct Quadric {
+  std::array<double, 10> coeffs{};
+  double weight{0.0};
+
+  static Quadric FromPlane(const Vec3d& normal, double offset,
+                           double weight) {
+    const double kX = normal[0];
+    const double kY = normal[1];
+    const double kZ = normal[2];
+    Quadric quadric;
+    quadric.coeffs = {kX * kX, kX * kY, kX * kZ, kX * offset,
+                      kY * kY, kY * kZ, kY * offset, kZ * kZ,
+                      kZ * offset, offset * offset};
+    for (double& coeff : quadric.coeffs) {
+      coeff *= weight;
+    }
+    quadric.weight = weight;
+    return quadric;
+  }
+
+  void Add(const Quadric& other) {
+    for (size_t idx = 0; idx < coeffs.size(); ++idx) {
+      coeffs[idx] += other.coeffs[idx];
+    }
+    weight += other.weight;
+  }
+
+  /**
+   * @brief Weighted mean squared distance of a point to the planes.
+   */
+  [[nodiscard]] double Error(const Vec3d& point) const {
+    if (weight <= 0.0) {
+      return 0.0;
+    }
+    const double kX = point[0];
+    const double kY = point[1];
+    const double kZ = point[2];
+    const double kSum =
+        coeffs[0] * kX * kX + 2.0 * coeffs[1] * kX * kY +
+        2.0 * coeffs[2] * kX * kZ + 2.0 * coeffs[3] * kX +
+        coeffs[4] * kY * kY + 2.0 * coeffs[5] * kY * kZ +
+        2.0 * coeffs[6] * kY + coeffs[7] * kZ * kZ + 2.0 * coeffs[8] * kZ +
+        coeffs[9];
+    return std::max(kSum, 0.0) / weight;
+  }
+};
+
+enum class VertexKind : uint8_t {
+  Manifold = 0,
+  // On an open border, collapses only along border edges
+  Border = 1,
+  // On a non-manifold edge, never collapses
+  Locked = 2,
+};
+
+uint64_t EdgeKey(uint32_t from, uint32_t to) {
+  return (static_cast<uint64_t>(from) << 32) | to;
+}
+
+struct PositionHash {
+  size_t operator()(const std::array<uint32_t, 3>& bits) const noexcept {
+    uint64_t hash = 14695981039346656037ull;
+    for (const uint32_t kBits : bits) {
+      hash = (hash ^ kBits) * 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+  }
+};
+
+/**
+ * @brief Compressed rows: the items of row i are
+ * items[offsets[i]..offsets[i + 1]).
+ */
+struct Rows {
+  std::vector<uint32_t> offsets;
+  std::vector<uint32_t> items;
+
+  void Build(size_t rowCount, const std::vector<uint32_t>& rowOfItem,
+             const std::vector<uint32_t>& itemValues) {
+    offsets.assign(rowCount + 1, 0);
+    for (const uint32_t kRow : rowOfItem) {
+      ++offsets[kRow + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    items.resize(rowOfItem.size());
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t idx = 0; idx < rowOfItem.size(); ++idx) {
+      items[fill[rowOfItem[idx]]++] = itemValues[idx];
+    }
+  }
+};
+
+}  // namespace
+
+std::vector<Mgtt::Rendering::SimplifiedLevel> SimplifyTriangles(
+    const Mgtt::Rendering::Mesh& mesh, const uint32_t* indices,
+    size_t indexCount, const std::vector<float>& ratios, float maxError) {
+  std::vector<Mgtt::Rendering::SimplifiedLevel> levels;
+  const size_t kTriangleCount = indexCount / 3;
+  if (kTriangleCount == 0 || ratios.empty()) {
+    return levels;
+  }
+
+  // Work on the referenced vertices only, renumbered from 0
+  std::unordered_map<uint32_t, uint32_t> localOf;
+  std::vector<uint32_t> globalOf;
+  std::vector<uint32_t> tris(kTriangleCount * 3);
+  for (size_t idx = 0; idx < tris.size(); ++idx) {
+    const auto [kIter, kInserted] = localOf.try_emplace(
+        indices[idx], static_cast<uint32_t>(globalOf.size()));
+    if (kInserted) {
+      globalOf.push_back(indices[idx]);
+    }
+    tris[idx] = kIter->second;
+  }
+  const size_t kVertexCount = globalOf.size();
+
+  // Positions scaled to the extent, so errors are relative
+  glm::vec3 minPos = mesh.vertexPositionAttribs[globalOf[0]];
+  glm::vec3 maxPos = minPos;
+  for (const uint32_t kGlobal : globalOf) {
+    minPos = glm::min(minPos, mesh.vertexPositionAttribs[kGlobal]);
+    maxPos = glm::max(maxPos, mesh.vertexPositionAttribs[kGlobal]);
+  }
+  const glm::vec3 kSize = maxPos - minPos;
+  const double kExtent = std::max({kSize.x, kSize.y, kSize.z});
+  if (!(kExtent > 0.0)) {
+    return levels;
+  }
+  std::vector<Vec3d> positions(kVertexCount);
+  for (size_t vertex = 0; vertex < kVertexCount; ++vertex) {
+    const glm::vec3 kRelative =
+        mesh.vertexPositionAttribs[globalOf[vertex]] - minPos;
+    positions[vertex] = {kRelative.x / kExtent, kRelative.y / kExtent,
+                         kRelative.z / kExtent};
+  }
+
+  // Vertices sharing a position form a group, named after its first vertex
+  std::vector<uint32_t> group(kVertexCount);
+  {
+    std::unordered_map<std::array<uint32_t, 3>, uint32_t, PositionHash>
+        groupOf;
+    groupOf.reserve(kVertexCount);
+    for (uint32_t vertex = 0; vertex < kVertexCount; ++vertex) {
+      std::array<uint32_t, 3> bits{};
+      const glm::vec3& kPos = mesh.vertexPositionAttribs[globalOf[vertex]];
+      for (int axis = 0; axis < 3; ++axis) {
+        const float kValue = kPos[axis] + 0.0f;
+        std::memcpy(&bits[axis], &kValue, sizeof(float));
+      }
+      group[vertex] = groupOf.try_emplace(bits, vertex).first->second;
+    }
+  }
+
+  // Classify groups by how many triangles use each of their edges
+  std::vector<VertexKind> kinds(kVertexCount, VertexKind::Manifold);
+  {
+    std::unordered_map<uint64_t, uint32_t> edgeUse;
+    for (size_t idx = 0; idx < tris.size(); ++idx) {
+      const uint32_t kA = group[tris[idx]];
+      const uint32_t kB = group[tris[idx - idx % 3 + (idx + 1) % 3]];
+      if (kA != kB) {
+        ++edgeUse[EdgeKey(std::min(kA, kB), std::max(kA, kB))];
+      }
+    }
+    for (const auto& [key, count] : edgeUse) {
+      const auto kA = static_cast<uint32_t>(key >> 32);
+      const auto kB = static_cast<uint32_t>(key & 0xFFFFFFFFu);
+      const VertexKind kKind =
+          count == 1 ? VertexKind::Border
+                     : (count > 2 ? VertexKind::Locked : VertexKind::Manifold);
+      kinds[kA] = std::max(kinds[kA], kKind);
+      kinds[kB] = std::max(kinds[kB], kKind);
+    }
+  }
+
+  // Face quadrics, plus edge quadrics that hold borders and seams in place
+  std::vector<Quadric> quadrics(kVertexCount);
+  {
+    std::unordered_set<uint64_t> attributeEdges;
+    attributeEdges.reserve(tris.size());
+    for (size_t idx = 0; idx < tris.size(); ++idx) {
+      attributeEdges.insert(
+          EdgeKey(tris[idx], tris[idx - idx % 3 + (idx + 1) % 3]));
+    }
+    for (size_t tri = 0; tri < kTriangleCount; ++tri) {
+      const uint32_t* kCorners = &tris[tri * 3];
+      const Vec3d kCross =
+          Cross(Sub(positions[kCorners[1]], positions[kCorners[0]]),
+                Sub(positions[kCorners[2]], positions[kCorners[0]]));
+      const double kLength = std::sqrt(Dot(kCross, kCross));
+      if (!(kLength > 0.0)) {
+        continue;
+      }
+      const Vec3d kNormal = {kCross[0] / kLength, kCross[1] / kLength,
+                             kCross[2] / kLength};
+      const Quadric kFace = Quadric::FromPlane(
+          kNormal, -Dot(kNormal, positions[kCorners[0]]), kLength * 0.5);
+      for (size_t corner = 0; corner < 3; ++corner) {
+        quadrics[group[kCorners[corner]]].Add(kFace);
+      }
+
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const uint32_t kA = kCorners[corner];
+        const uint32_t kB = kCorners[(corner + 1) % 3];
+        if (attributeEdges.count(EdgeKey(kB, kA)) > 0) {
+          continue;
+        }
+        const Vec3d kEdge = Sub(positions[kB], positions[kA]);
+        const Vec3d kPerp = Cross(kEdge, kNormal);
+        const double kPerpLength = std::sqrt(Dot(kPerp, kPerp));
+        if (!(kPerpLength > 0.0)) {
+          continue;
+        }
+        const Vec3d kPlane = {kPerp[0] / kPerpLength, kPerp[1] / kPerpLength,
+                              kPerp[2] / kPerpLength};
+        const Quadric kEdgeQuadric =
+            Quadric::FromPlane(kPlane, -Dot(kPlane, positions[kA]),
+                               Dot(kEdge, kEdge) * kEdgeWeight);
+        quadrics[group[kA]].Add(kEdgeQuadric);
+        quadrics[group[kB]].Add(kEdgeQuadric);
+      }
+    }
+  }
+
+  auto attributePenalty = [&](uint32_t from, uint32_t to) {
+    double penalty = 0.0;
+    const uint32_t kFrom = globalOf[from];
+    const uint32_t kTo = globalOf[to];
+    if (kFrom < mesh.vertexNormalAttribs.size() &&
+        kTo < mesh.vertexNormalAttribs.size()) {
+      const glm::vec3 kDelta =
+          mesh.vertexNormalAttribs[kFrom] - mesh.vertexNormalAttribs[kTo];
+      penalty += kNormalWeight * glm::dot(kDelta, kDelta);
+    }
+    if (kFrom < mesh.vertexTextureAttribs.size() &&
+        kTo < mesh.vertexTextureAttribs.size()) {
+      const glm::vec2 kDelta =
+          mesh.vertexTextureAttribs[kFrom] - mesh.vertexTextureAttribs[kTo];
+      penalty += kTextureWeight * glm::dot(kDelta, kDelta);
+    }
+    return penalty;
+  };
+
+  std::vector<size_t> targets;
+  for (const float kRatio : ratios) {
+    targets.push_back(static_cast<size_t>(
+        static_cast<double>(kTriangleCount) *
+        std::clamp(static_cast<double>(kRatio), 0.0, 1.0)));
+  }
+  const double kMaxErrorSq =
+      static_cast<double>(maxError) * static_cast<double>(maxError);
+  double errorSq = 0.0;
+
+  auto snapshot = [&]() {
+    Mgtt::Rendering::SimplifiedLevel out;
+    out.indices.reserve(tris.size());
+    for (const uint32_t kVertex : tris) {
+      out.indices.push_back(globalOf[kVertex]);
+    }
+    out.error = static_cast<float>(std::sqrt(errorSq) * kExtent);
+    levels.push_back(std::move(out));
+  };
+
+  struct Collapse {
+    // Geometric error plus the attribute penalty
+    double cost;
+    double error;
+    uint32_t from;
+    uint32_t to;
+  };
+  std::vector<Collapse> candidates;
+  std::vector<uint32_t> remap(kVertexCount);
+  std::vector<uint8_t> locked(kVertexCount);
+  std::vector<std::pair<uint32_t, uint32_t>> partners;
+  Rows trianglesOf;
+  Rows membersOf;
+  std::vector<uint32_t> rowScratch;
+  std::vector<uint32_t> valueScratch;
+
+  size_t level = 0;
+  while (level < targets.size()) {
+    const size_t kCurrent = tris.size() / 3;
+    if (kCurrent <= targets[level]) {
+      snapshot();
+      ++level;
+      continue;
+    }
+
+    // Adjacency of the current triangles
+    rowScratch.assign(tris.begin(), tris.end());
+    valueScratch.resize(tris.size());
+    for (size_t idx = 0; idx < tris.size(); ++idx) {
+      valueScratch[idx] = static_cast<uint32_t>(idx / 3);
+    }
+    trianglesOf.Build(kVertexCount, rowScratch, valueScratch);
+    rowScratch.clear();
+    valueScratch.clear();
+    for (uint32_t vertex = 0; vertex < kVertexCount; ++vertex) {
+      if (trianglesOf.offsets[vertex] != trianglesOf.offsets[vertex + 1]) {
+        rowScratch.push_back(group[vertex]);
+        valueScratch.push_back(vertex);
+      }
+    }
+    membersOf.Build(kVertexCount, rowScratch, valueScratch);
+
+    std::unordered_set<uint64_t> positionEdges;
+    positionEdges.reserve(tris.size());
+    for (size_t idx = 0; idx < tris.size(); ++idx) {
+      positionEdges.insert(EdgeKey(
+          group[tris[idx]], group[tris[idx - idx % 3 + (idx + 1) % 3]]));
+    }
+    auto isBorderEdge = [&](uint32_t lhs, uint32_t rhs) {
+      return positionEdges.count(EdgeKey(lhs, rhs)) == 0 ||
+             positionEdges.count(EdgeKey(rhs, lhs)) == 0;
+    };
+
+    candidates.clear();
+    for (size_t idx = 0; idx < tris.size(); ++idx) {
+      const uint32_t kVertexA = tris[idx];
+      const uint32_t kVertexB = tris[idx - idx % 3 + (idx + 1) % 3];
+      const uint32_t kA = group[kVertexA];
+      const uint32_t kB = group[kVertexB];
+      if (kA == kB) {
+        continue;
+      }
+      for (const auto& [kFrom, kTo, kFromVertex, kToVertex] :
+           {std::array<uint32_t, 4>{kA, kB, kVertexA, kVertexB},
+            std::array<uint32_t, 4>{kB, kA, kVertexB, kVertexA}}) {
+        if (kinds[kFrom] == VertexKind::Locked ||
+            (kinds[kFrom] == VertexKind::Border && !isBorderEdge(kFrom, kTo))) {
+          continue;
+        }
+        Quadric combined = quadrics[kFrom];
+        combined.Add(quadrics[kTo]);
+        const double kError = combined.Error(positions[kTo]);
+        candidates.push_back(
+            {kError + attributePenalty(kFromVertex, kToVertex), kError, kFrom,
+             kTo});
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Collapse& lhs, const Collapse& rhs) {
+                return lhs.cost < rhs.cost;
+              });
+
+    const size_t kBudget = kCurrent - targets[level];
+    size_t removed = 0;
+    size_t collapses = 0;
+    std::iota(remap.begin(), remap.end(), 0u);
+    std::fill(locked.begin(), locked.end(), 0);
+
+    for (const auto& collapse : candidates) {
+      if (collapse.cost > kMaxErrorSq || removed >= kBudget) {
+        break;
+      }
+      if (locked[collapse.from] || locked[collapse.to]) {
+        continue;
+      }
+
+      // Every vertex of the group needs a neighbour in the target group
+      // with its own attributes; otherwise the collapse would cross a seam
+      partners.clear();
+      bool valid = true;
+      for (uint32_t member = membersOf.offsets[collapse.from];
+           valid && member < membersOf.offsets[collapse.from + 1]; ++member) {
+        const uint32_t kVertex = membersOf.items[member];
+        uint32_t partner = kNoVertex;
+        for (uint32_t adj = trianglesOf.offsets[kVertex];
+             partner == kNoVertex && adj < trianglesOf.offsets[kVertex + 1];
+             ++adj) {
+          for (size_t corner = 0; corner < 3; ++corner) {
+            const uint32_t kOther = tris[trianglesOf.items[adj] * 3 + corner];
+            if (group[kOther] == collapse.to) {
+              partner = kOther;
+              break;
+            }
+          }
+        }
+        valid = partner != kNoVertex;
+        partners.emplace_back(kVertex, partner);
+      }
+
+      // Reject collapses that flip a surviving triangle
+      for (size_t pair = 0; valid && pair < partners.size(); ++pair) {
+        const uint32_t kVertex = partners[pair].first;
+        for (uint32_t adj = trianglesOf.offsets[kVertex];
+             valid && adj < trianglesOf.offsets[kVertex + 1]; ++adj) {
+          const uint32_t* kCorners = &tris[trianglesOf.items[adj] * 3];
+          if (group[kCorners[0]] == collapse.to ||
+              group[kCorners[1]] == collapse.to ||
+              group[kCorners[2]] == collapse.to) {
+            continue;
+          }
+          std::array<Vec3d, 3> moved;
+          for (size_t corner = 0; corner < 3; ++corner) {
+            moved[corner] = group[kCorners[corner]] == collapse.from
+                                ? positions[collapse.to]
+                                : positions[kCorners[corner]];
+          }
+          const Vec3d kBefore =
+              Cross(Sub(positions[kCorners[1]], positions[kCorners[0]]),
+                    Sub(positions[kCorners[2]], positions[kCorners[0]]));
+          const Vec3d kAfter =
+              Cross(Sub(moved[1], moved[0]), Sub(moved[2], moved[0]));
+          valid = Dot(kBefore, kAfter) > 0.0;
+        }
+      }
+      if (!valid) {
+        continue;
+      }
+
+      for (const auto& [kVertex, kPartner] : partners) {
+        remap[kVertex] = kPartner;
+        for (uint32_t adj = trianglesOf.offsets[kVertex];
+             adj < trianglesOf.offsets[kVertex + 1]; ++adj) {
+          for (size_t corner = 0; corner < 3; ++corner) {
+            locked[group[tris[trianglesOf.items[adj] * 3 + corner]]] = 1;
+          }
+        }
+      }
+      quadrics[collapse.to].Add(quadrics[collapse.from]);
+      errorSq = std::max(errorSq, collapse.error);
+      removed += kinds[collapse.from] == VertexKind::Border ? 1 : 2;
+      ++collapses;
+    }
+
+    if (collapses == 0) {
+      // Out of error budget: keep what was reached if it is any coarser
+      const size_t kPrevious =
+          levels.empty() ? kTriangleCount : levels.back().indices.size() / 3;
+      if (kCurrent < kPrevious) {
+        snapshot();
+      }
+      break;
+    }
+
+    size_t kept = 0;
+    for (size_t tri = 0; tri < kCurrent; ++tri) {
+      const uint32_t kA = remap[tris[tri * 3 + 0]];
+      const uint32_t kB = remap[tris[tri * 3 + 1]];
+      const uint32_t kC = remap[tris[tri * 3 + 2]];
+      if (group[kA] == group[kB] || group[kB] == group[kC] ||
+          group[kA] == group[kC]) {
+        continue;
+      }
+      tris[kept * 3 + 0] = kA;
+      tris[kept * 3 + 1] = kB;
+      tris[kept * 3 + 2] = kC;
+      ++kept;
+    }
+    tris.resize(kept * 3);
+  }
+  return levels;
+}
+
+Mgtt::Common::Result<void> GenerateLods(Mgtt::Rendering::Mesh& mesh,
+                                        const std::vector<float>& ratios,
+                                        float maxError) {
+  const size_t kVertexCount = mesh.vertexPositionAttribs.size();
+  for (const uint32_t kIdx : mesh.indices) {
+    if (kIdx >= kVertexCount) {
+      return Mgtt::Common::Result<void>::Err(
+          "Mesh index out of range in mesh " + mesh.name);
+    }
+  }
+
+  // A previous chain lives after the full-detail ranges
+  size_t baseEnd = 0;
+  for (auto& prim : mesh.meshPrimitives) {
+    baseEnd = std::max(baseEnd, prim.firstIndex + size_t{prim.indexCount});
+    prim.lods.clear();
+  }
+  if (baseEnd > mesh.indices.size()) {
+    return Mgtt::Common::Result<void>::Err(
+        "Mesh primitive index range out of bounds in mesh " + mesh.name);
+  }
+  mesh.indices.resize(baseEnd);
+
+  for (auto& prim : mesh.meshPrimitives) {
+    if (!prim.hasIndices) {
+      continue;
+    }
+    const auto kLevels = SimplifyTriangles(
+        mesh, mesh.indices.data() + prim.firstIndex,
+        prim.indexCount - prim.indexCount % 3, ratios, maxError);
+    for (const auto& level : kLevels) {
+      const auto kOrdered = Mgtt::Rendering::OptimizeVertexCache(
+          level.indices.data(), level.indices.size(), kVertexCount);
+      Mgtt::Rendering::MeshLod lod;
+      lod.firstIndex = static_cast<uint32_t>(mesh.indices.size());
+      lod.indexCount = static_cast<uint32_t>(kOrdered.size());
+      lod.error = level.error;
+      mesh.indices.insert(mesh.indices.end(), kOrdered.begin(),
+                          kOrdered.end());
+      prim.lods.push_back(lod);
+    }
+  }
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+}  // namespace Mgtt::Rendering
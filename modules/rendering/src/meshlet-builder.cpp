@@ -0,0 +1,204 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <meshlet-builder.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+namespace {
+
+constexpr uint32_t kNoMeshlet = ~0u;
+
+}  // namespace
+
+Mgtt::Common::Result<size_t> BuildMeshlets(Mgtt::Rendering::Mesh& mesh,
+                                           uint32_t maxVertices,
+                                           uint32_t maxTriangles) {
+  if (maxVertices < 3 || maxTriangles == 0) {
+    return Mgtt::Common::Result<size_t>::Err(
+        "Meshlet limits must allow at least one triangle");
+  }
+  const size_t kVertexCount = mesh.vertexPositionAttribs.size();
+  for (const auto& prim : mesh.meshPrimitives) {
+    if (!prim.hasIndices) {
+      continue;
+    }
+    if (size_t{prim.firstIndex} + prim.indexCount > mesh.indices.size()) {
+      return Mgtt::Common::Result<size_t>::Err(
+          "Mesh primitive index range out of bounds in mesh " + mesh.name);
+    }
+    for (uint32_t idx = 0; idx < prim.indexCount; ++idx) {
+      if (mesh.indices[prim.firstIndex + idx] >= kVertexCount) {
+        return Mgtt::Common::Result<size_t>::Err(
+            "Mesh index out of range in mesh " + mesh.name);
+      }
+    }
+  }
+
+  // Meshlet that last took each vertex, so no per-meshlet clearing
+  std::vector<uint32_t> owner(kVertexCount, kNoMeshlet);
+  uint32_t current = 0;
+  size_t built = 0;
+  for (auto& prim : mesh.meshPrimitives) {
+    prim.meshlets.clear();
+    if (!prim.hasIndices) {
+      continue;
+    }
+    const uint32_t kEnd =
+        prim.firstIndex + prim.indexCount - prim.indexCount % 3;
+    uint32_t first = prim.firstIndex;
+    uint32_t vertices = 0;
+    uint32_t triangles = 0;
+    auto close = [&](uint32_t end) {
+      if (end > first) {
+        prim.meshlets.push_back(ComputeMeshletBounds(mesh, first, end - first));
+      }
+      first = end;
+      vertices = 0;
+      triangles = 0;
+      ++current;
+    };
+
+    for (uint32_t tri = prim.firstIndex; tri < kEnd; tri += 3) {
+      const uint32_t kA = mesh.indices[tri + 0];
+      const uint32_t kB = mesh.indices[tri + 1];
+      const uint32_t kC = mesh.indices[tri + 2];
+      auto countNew = [&]() {
+        return static_cast<uint32_t>(owner[kA] != current) +
+               static_cast<uint32_t>(owner[kB] != current && kB != kA) +
+               static_cast<uint32_t>(owner[kC] != current && kC != kA &&
+                                     kC != kB);
+      };
+      if (triangles + 1 > maxTriangles ||
+          vertices + countNew() > maxVertices) {
+        close(tri);
+      }
+      vertices += countNew();
+      ++triangles;
+      owner[kA] = current;
+      owner[kB] = current;
+      owner[kC] = current;
+    }
+    close(kEnd);
+    built += prim.meshlets.size();
+  }
+  return Mgtt::Common::Result<size_t>::Ok(built);
+}
+
+Mgtt::Rendering::Meshlet ComputeMeshletBounds(
+    const Mgtt::Rendering::Mesh& mesh, uint32_t firstIndex,
+    uint32_t indexCount) {
+  Mgtt::Rendering::Meshlet meshlet;
+  meshlet.firstIndex = firstIndex;
+  meshlet.indexCount = indexCount;
+  if (indexCount == 0) {
+    return meshlet;
+  }
+
+  const auto& positions = mesh.vertexPositionAttribs;
+  glm::vec3 minPos = positions[mesh.indices[firstIndex]];
+  glm::vec3 maxPos = minPos;
+  for (uint32_t idx = firstIndex; idx < firstIndex + indexCount; ++idx) {
+    minPos = glm::min(minPos, positions[mesh.indices[idx]]);
+    maxPos = glm::max(maxPos, positions[mesh.indices[idx]]);
+  }
+  meshlet.center = (minPos + maxPos) * 0.5f;
+  float radiusSq = 0.0f;
+  for (uint32_t idx = firstIndex; idx < firstIndex + indexCount; ++idx) {
+    const glm::vec3 kOffset = positions[mesh.indices[idx]] - meshlet.center;
+    radiusSq = std::max(radiusSq, glm::dot(kOffset, kOffset));
+  }
+  meshlet.radius = std::sqrt(radiusSq);
+
+  // The cone axis averages the unit face normals; its half angle is set by
+  // the normal furthest from the axis
+  std::vector<glm::vec3> normals;
+  normals.reserve(indexCount / 3);
+  glm::vec3 axis(0.0f);
+  for (uint32_t tri = firstIndex; tri + 2 < firstIndex + indexCount;
+       tri += 3) {
+    const glm::vec3& kA = positions[mesh.indices[tri + 0]];
+    const glm::vec3 kNormal = glm::cross(positions[mesh.indices[tri + 1]] - kA,
+                                         positions[mesh.indices[tri + 2]] - kA);
+    const float kLength = glm::length(kNormal);
+    if (kLength > 0.0f) {
+      normals.push_back(kNormal / kLength);
+      axis += normals.back();
+    }
+  }
+  const float kAxisLength = glm::length(axis);
+  if (normals.empty() || !(kAxisLength > 0.0f)) {
+    return meshlet;
+  }
+  axis /= kAxisLength;
+  float minDot = 1.0f;
+  for (const auto& normal : normals) {
+    minDot = std::min(minDot, glm::dot(normal, axis));
+  }
+  if (minDot <= 0.0f) {
+    // Spans a hemisphere or more, some triangle always faces the viewer
+    return meshlet;
+  }
+  meshlet.coneAxis = axis;
+  meshlet.coneCutoff = std::sqrt(std::max(1.0f - minDot * minDot, 0.0f));
+  return meshlet;
+}
+
+Mgtt::Rendering::FrustumPlanes ExtractFrustumPlanes(const glm::mat4& clip) {
+  auto row = [&](int idx) {
+    return glm::vec4(clip[0][idx], clip[1][idx], clip[2][idx], clip[3][idx]);
+  };
+  Mgtt::Rendering::FrustumPlanes planes = {
+      row(3) + row(0), row(3) - row(0), row(3) + row(1),
+      row(3) - row(1), row(3) + row(2), row(3) - row(2)};
+  for (auto& plane : planes) {
+    const float kLength = glm::length(glm::vec3(plane));
+    if (kLength > 0.0f) {
+      plane /= kLength;
+    }
+  }
+  return planes;
+}
+
+bool IsMeshletVisible(const Mgtt::Rendering::Meshlet& meshlet,
+                      const Mgtt::Rendering::FrustumPlanes& planes,
+                      const glm::vec3& viewer, bool backface) {
+  for (const auto& plane : planes) {
+    if (glm::dot(glm::vec3(plane), meshlet.center) + plane.w <
+        -meshlet.radius) {
+      return false;
+    }
+  }
+  if (!backface) {
+    return true;
+  }
+  const glm::vec3 kToCenter = meshlet.center - viewer;
+  return glm::dot(kToCenter, meshlet.coneAxis) <
+         meshlet.coneCutoff * glm::length(kToCenter) + meshlet.radius;
+}
+
+}  // namespace Mgtt::Rendering
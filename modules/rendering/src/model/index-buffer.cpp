@@ -0,0 +1,85 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <index-buffer.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace Mgtt::Rendering {
+
+IndexType SelectIndexType(size_t vertexCount) noexcept {
+  constexpr size_t kMaxUInt16Vertices =
+      static_cast<size_t>(std::numeric_limits<uint16_t>::max()) + 1;
+  return vertexCount <= kMaxUInt16Vertices ? IndexType::UInt16
+                                           : IndexType::UInt32;
+}
+
+IndexType SelectIndexType(const std::vector<uint32_t>& indices,
+                          size_t vertexCount, uint32_t baseVertex) noexcept {
+  // An index past vertexCount must not wrap when narrowed
+  size_t addressed = vertexCount;
+  if (!indices.empty()) {
+    const uint32_t kMaxIdx = *std::max_element(indices.begin(), indices.end());
+    addressed = std::max(addressed, static_cast<size_t>(kMaxIdx) + 1);
+  }
+  return SelectIndexType(static_cast<size_t>(baseVertex) + addressed);
+}
+
+size_t GetIndexSize(IndexType type) noexcept {
+  return type == IndexType::UInt16 ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+GLenum GetIndexGlType(IndexType type) noexcept {
+  return type == IndexType::UInt16 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+}
+
+IndexBuffer::IndexBuffer(const std::vector<uint32_t>& indices,
+                         size_t vertexCount, uint32_t baseVertex)
+    : type(SelectIndexType(indices, vertexCount, baseVertex)) {
+  if (type == IndexType::UInt16) {
+    indices16.reserve(indices.size());
+    for (const uint32_t kIdx : indices) {
+      indices16.push_back(static_cast<uint16_t>(kIdx + baseVertex));
+    }
+  } else {
+    indices32.reserve(indices.size());
+    for (const uint32_t kIdx : indices) {
+      indices32.push_back(kIdx + baseVertex);
+    }
+  }
+}
+
+size_t IndexBuffer::GetCount() const noexcept {
+  return type == IndexType::UInt16 ? indices16.size() : indices32.size();
+}
+
+size_t IndexBuffer::GetByteSize() const noexcept {
+  return GetCount() * GetIndexSize(type);
+}
+
+const void* IndexBuffer::GetData() const noexcept {
+  return type == IndexType::UInt16 ? static_cast<const void*>(indices16.data())
+                                   : static_cast<const void*>(indices32.data());
+}
+
+}  // namespace Mgtt::Rendering
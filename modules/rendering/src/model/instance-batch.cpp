@@ -0,0 +1,56 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <instance-batch.h>
+
+namespace Mgtt::Rendering {
+
+InstanceBatch::~InstanceBatch() noexcept { Clear(); }
+
+InstanceBatch::InstanceBatch(InstanceBatch&& other) noexcept
+    : mesh(std::move(other.mesh)),
+      instanceMatrices(std::move(other.instanceMatrices)),
+      instanceVbo(std::exchange(other.instanceVbo, 0)),
+      firstInstance(std::exchange(other.firstInstance, 0)) {}
+
+InstanceBatch& InstanceBatch::operator=(InstanceBatch&& other) noexcept {
+  if (this != &other) {
+    Clear();
+    mesh = std::move(other.mesh);
+    instanceMatrices = std::move(other.instanceMatrices);
+    instanceVbo = std::exchange(other.instanceVbo, 0);
+    firstInstance = std::exchange(other.firstInstance, 0);
+  }
+  return *this;
+}
+
+void InstanceBatch::Clear() {
+  if (instanceVbo > 0) {
+    glDeleteBuffers(1, &instanceVbo);
+    instanceVbo = 0;
+  }
+  instanceMatrices.clear();
+  firstInstance = 0;
+  mesh.reset();
+}
+
+}  // namespace Mgtt::Rendering
@@ -32,6 +32,8 @@ void MeshPrimitive::Clear() {
   firstIndex = 0;
   indexCount = 0;
   vertexCount = 0;
+  lods.clear();
+  meshlets.clear();
 }
 
 }  // namespace Mgtt::Rendering
@@ -33,14 +33,22 @@ Mesh::Mesh(Mesh&& other) noexcept
       vertexPositionAttribs(std::move(other.vertexPositionAttribs)),
       vertexNormalAttribs(std::move(other.vertexNormalAttribs)),
       vertexTextureAttribs(std::move(other.vertexTextureAttribs)),
+      vertexTangentAttribs(std::move(other.vertexTangentAttribs)),
       vertexJointAttribs(std::move(other.vertexJointAttribs)),
       vertexWeightAttribs(std::move(other.vertexWeightAttribs)),
-      matrix(other.matrix),
       vao(std::exchange(other.vao, 0)),
       ebo(std::exchange(other.ebo, 0)),
       pos(std::exchange(other.pos, 0)),
       normal(std::exchange(other.normal, 0)),
       tex(std::exchange(other.tex, 0)),
+      tangent(std::exchange(other.tangent, 0)),
+      indexType(std::exchange(other.indexType, IndexType::UInt32)),
+      sharedBuffers(std::exchange(other.sharedBuffers, false)),
+      baseVertex(std::exchange(other.baseVertex, 0)),
+      baseIndex(std::exchange(other.baseIndex, 0)),
+      packedVertices(std::exchange(other.packedVertices, false)),
+      positionOffset(other.positionOffset),
+      positionScale(other.positionScale),
       aabb(other.aabb) {}
 
 Mesh& Mesh::operator=(Mesh&& other) noexcept {
@@ -52,20 +60,36 @@ Mesh& Mesh::operator=(Mesh&& other) noexcept {
     vertexPositionAttribs = std::move(other.vertexPositionAttribs);
     vertexNormalAttribs = std::move(other.vertexNormalAttribs);
     vertexTextureAttribs = std::move(other.vertexTextureAttribs);
+    vertexTangentAttribs = std::move(other.vertexTangentAttribs);
     vertexJointAttribs = std::move(other.vertexJointAttribs);
     vertexWeightAttribs = std::move(other.vertexWeightAttribs);
-    matrix = other.matrix;
     vao = std::exchange(other.vao, 0);
     ebo = std::exchange(other.ebo, 0);
     pos = std::exchange(other.pos, 0);
     normal = std::exchange(other.normal, 0);
     tex = std::exchange(other.tex, 0);
+    tangent = std::exchange(other.tangent, 0);
+    indexType = std::exchange(other.indexType, IndexType::UInt32);
+    sharedBuffers = std::exchange(other.sharedBuffers, false);
+    baseVertex = std::exchange(other.baseVertex, 0);
+    baseIndex = std::exchange(other.baseIndex, 0);
+    packedVertices = std::exchange(other.packedVertices, false);
+    positionOffset = other.positionOffset;
+    positionScale = other.positionScale;
     aabb = other.aabb;
   }
   return *this;
 }
 
 void Mesh::Clear() {
+  if (sharedBuffers) {
+    // Owned and deleted by Scene::sharedGeometry
+    vao = ebo = pos = normal = tex = tangent = 0;
+    sharedBuffers = false;
+    baseVertex = 0;
+    baseIndex = 0;
+  }
+
   auto delBuf = [](uint32_t& bufId) {
     if (bufId > 0) {
       glDeleteBuffers(1, &bufId);
@@ -76,6 +100,7 @@ void Mesh::Clear() {
   delBuf(pos);
   delBuf(normal);
   delBuf(tex);
+  delBuf(tangent);
   delBuf(ebo);
 
   if (vao > 0) {
@@ -83,6 +108,11 @@ void Mesh::Clear() {
     vao = 0;
   }
 
+  indexType = IndexType::UInt32;
+  packedVertices = false;
+  positionOffset = glm::vec3(0.0f);
+  positionScale = glm::vec3(1.0f);
+
   for (auto& primitive : meshPrimitives) {
     primitive.Clear();
   }
@@ -92,10 +122,10 @@ void Mesh::Clear() {
   vertexPositionAttribs.clear();
   vertexNormalAttribs.clear();
   vertexTextureAttribs.clear();
+  vertexTangentAttribs.clear();
   vertexJointAttribs.clear();
   vertexWeightAttribs.clear();
 
-  matrix = glm::mat4(1.0f);
   name.clear();
 }
 
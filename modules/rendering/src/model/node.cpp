@@ -22,6 +22,8 @@
 
 #include <node.h>
 
+#include <vector>
+
 namespace Mgtt::Rendering {
 
 void Node::Clear() {
@@ -29,9 +31,14 @@ void Node::Clear() {
     mesh->Clear();
   }
   index = 0;
+  parent = kNoParent;
+  children.clear();
   pos = glm::vec3(0.0f);
   scale = glm::vec3(1.0f);
   matrix = glm::mat4(1.0f);
+  worldMatrix = glm::mat4(1.0f);
+  aabb = AABB();
+  instanceMatrices.clear();
 }
 
 glm::mat4 Node::LocalMatrix() const {
@@ -39,23 +46,14 @@ glm::mat4 Node::LocalMatrix() const {
          glm::scale(glm::mat4(1.0f), scale) * matrix;
 }
 
-glm::mat4 Node::GetGlobalMatrix() const {
+glm::mat4 Node::GetGlobalMatrix(
+    const std::vector<Mgtt::Rendering::Node>& nodes) const {
   glm::mat4 globalMatrix = LocalMatrix();
-  auto currentParent = parent.lock();
-  while (currentParent != nullptr) {
-    globalMatrix = currentParent->LocalMatrix() * globalMatrix;
-    currentParent = currentParent->parent.lock();
+  for (uint32_t current = parent; current != kNoParent;
+       current = nodes[current].parent) {
+    globalMatrix = nodes[current].LocalMatrix() * globalMatrix;
   }
   return globalMatrix;
 }
 
-void Node::InitialTransform() {
-  if (mesh) {
-    mesh->matrix = GetGlobalMatrix();
-  }
-  for (auto& child : children) {
-    child->InitialTransform();
-  }
-}
-
 }  // namespace Mgtt::Rendering
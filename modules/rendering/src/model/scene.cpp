@@ -38,8 +38,11 @@ Scene::Scene(Scene&& other) noexcept
       matrix(other.matrix),
       textureMap(std::move(other.textureMap)),
       nodes(std::move(other.nodes)),
-      linearNodes(std::move(other.linearNodes)),
+      rootNodes(std::move(other.rootNodes)),
+      transforms(std::move(other.transforms)),
       materials(std::move(other.materials)),
+      instanceBatches(std::move(other.instanceBatches)),
+      sharedGeometry(std::move(other.sharedGeometry)),
       aabb(other.aabb),
       shader(std::move(other.shader)) {}
 
@@ -55,8 +58,11 @@ Scene& Scene::operator=(Scene&& other) noexcept {
     matrix = other.matrix;
     textureMap = std::move(other.textureMap);
     nodes = std::move(other.nodes);
-    linearNodes = std::move(other.linearNodes);
+    rootNodes = std::move(other.rootNodes);
+    transforms = std::move(other.transforms);
     materials = std::move(other.materials);
+    instanceBatches = std::move(other.instanceBatches);
+    sharedGeometry = std::move(other.sharedGeometry);
     aabb = other.aabb;
     shader = std::move(other.shader);
   }
@@ -64,20 +70,20 @@ Scene& Scene::operator=(Scene&& other) noexcept {
 }
 
 void Scene::Clear() {
-  for (auto& node : nodes) {
-    Linearize(node);
-  }
-  for (auto& linearNode : linearNodes) {
-    linearNode->Clear();
-  }
-
+  // Nodes and batches share their meshes, so each mesh releases its buffers
+  // once, when the last reference goes with nodes.clear() below
   textureMap.clear();
+  transforms.Clear();
+
+  instanceBatches.clear();
+  instanceBatches.shrink_to_fit();
+  sharedGeometry.Clear();
 
   nodes.clear();
   nodes.shrink_to_fit();
 
-  linearNodes.clear();
-  linearNodes.shrink_to_fit();
+  rootNodes.clear();
+  rootNodes.shrink_to_fit();
 
   materials.clear();
   materials.shrink_to_fit();
@@ -101,11 +107,16 @@ void Scene::Clear() {
   aabb.scale = 1.0f;
 }
 
-void Scene::Linearize(const std::shared_ptr<Mgtt::Rendering::Node>& node) {
-  linearNodes.push_back(node);
-  for (const auto& child : node->children) {
-    Linearize(child);
+uint32_t Scene::AddNode(uint32_t parent) {
+  const auto kIndex = static_cast<uint32_t>(nodes.size());
+  auto& node = nodes.emplace_back();
+  node.parent = parent;
+  if (parent == Mgtt::Rendering::Node::kNoParent) {
+    rootNodes.push_back(kIndex);
+  } else {
+    nodes[parent].children.push_back(kIndex);
   }
+  return kIndex;
 }
 
 }  // namespace Mgtt::Rendering
@@ -0,0 +1,81 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <shared-geometry.h>
+
+#include <utility>
+
+namespace Mgtt::Rendering {
+
+SharedGeometry::~SharedGeometry() noexcept { Clear(); }
+
+SharedGeometry::SharedGeometry(SharedGeometry&& other) noexcept
+    : vao(std::exchange(other.vao, 0)),
+      ebo(std::exchange(other.ebo, 0)),
+      pos(std::exchange(other.pos, 0)),
+      normal(std::exchange(other.normal, 0)),
+      tex(std::exchange(other.tex, 0)),
+      tangent(std::exchange(other.tangent, 0)),
+      instanceVbo(std::exchange(other.instanceVbo, 0)),
+      instanceLocation(std::exchange(other.instanceLocation, -1)),
+      packedVertices(std::exchange(other.packedVertices, false)) {}
+
+SharedGeometry& SharedGeometry::operator=(SharedGeometry&& other) noexcept {
+  if (this != &other) {
+    Clear();
+    vao = std::exchange(other.vao, 0);
+    ebo = std::exchange(other.ebo, 0);
+    pos = std::exchange(other.pos, 0);
+    normal = std::exchange(other.normal, 0);
+    tex = std::exchange(other.tex, 0);
+    tangent = std::exchange(other.tangent, 0);
+    instanceVbo = std::exchange(other.instanceVbo, 0);
+    instanceLocation = std::exchange(other.instanceLocation, -1);
+    packedVertices = std::exchange(other.packedVertices, false);
+  }
+  return *this;
+}
+
+void SharedGeometry::Clear() {
+  auto delBuf = [](uint32_t& bufId) {
+    if (bufId > 0) {
+      glDeleteBuffers(1, &bufId);
+      bufId = 0;
+    }
+  };
+
+  delBuf(pos);
+  delBuf(normal);
+  delBuf(tex);
+  delBuf(tangent);
+  delBuf(ebo);
+  delBuf(instanceVbo);
+
+  if (vao > 0) {
+    glDeleteVertexArrays(1, &vao);
+    vao = 0;
+  }
+  instanceLocation = -1;
+  packedVertices = false;
+}
+
+}  // namespace Mgtt::Rendering
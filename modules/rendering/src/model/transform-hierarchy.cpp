@@ -0,0 +1,156 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <node.h>
+#include <transform-hierarchy.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace Mgtt::Rendering {
+
+void TransformHierarchy::Build(std::vector<Mgtt::Rendering::Node>& nodes,
+                               const std::vector<uint32_t>& roots) {
+  Clear();
+  nodeIndices_.reserve(nodes.size());
+
+  // Children are pushed in reverse so they are visited in order
+  std::vector<std::pair<uint32_t, uint32_t>> stack;
+  for (auto iter = roots.rbegin(); iter != roots.rend(); ++iter) {
+    stack.emplace_back(*iter, kNoParent);
+  }
+  while (!stack.empty()) {
+    const auto [kIndex, kParent] = stack.back();
+    stack.pop_back();
+    const auto& node = nodes[kIndex];
+    const auto kSlot = static_cast<uint32_t>(nodeIndices_.size());
+    nodeIndices_.push_back(kIndex);
+    parents_.push_back(kParent);
+    translations_.push_back(node.pos);
+    rotations_.push_back(node.rot);
+    scales_.push_back(node.scale);
+    matrices_.push_back(node.matrix);
+    for (auto iter = node.children.rbegin(); iter != node.children.rend();
+         ++iter) {
+      stack.emplace_back(*iter, kSlot);
+    }
+  }
+
+  // Pre-order puts each subtree right behind its root
+  const size_t kCount = nodeIndices_.size();
+  subtreeEnds_.resize(kCount);
+  for (size_t slot = kCount; slot-- > 0;) {
+    subtreeEnds_[slot] = std::max(subtreeEnds_[slot],
+                                  static_cast<uint32_t>(slot + 1));
+    if (parents_[slot] != kNoParent) {
+      subtreeEnds_[parents_[slot]] =
+          std::max(subtreeEnds_[parents_[slot]], subtreeEnds_[slot]);
+    }
+  }
+
+  worldMatrices_.assign(kCount, glm::mat4(1.0f));
+  dirty_.assign(kCount, 1);
+  firstDirty_ = 0;
+  Update(nodes);
+}
+
+void TransformHierarchy::Clear() noexcept {
+  parents_.clear();
+  subtreeEnds_.clear();
+  translations_.clear();
+  rotations_.clear();
+  scales_.clear();
+  matrices_.clear();
+  worldMatrices_.clear();
+  dirty_.clear();
+  nodeIndices_.clear();
+  firstDirty_ = 0;
+}
+
+size_t TransformHierarchy::Update(std::vector<Mgtt::Rendering::Node>& nodes) {
+  const size_t kCount = nodeIndices_.size();
+  size_t updated = 0;
+  size_t slot = firstDirty_;
+  while (slot < kCount) {
+    if (dirty_[slot] == 0) {
+      ++slot;
+      continue;
+    }
+    // Parents precede children, so one pass over the subtree suffices
+    const size_t kEnd = subtreeEnds_[slot];
+    for (; slot < kEnd; ++slot) {
+      const uint32_t kParent = parents_[slot];
+      worldMatrices_[slot] = kParent == kNoParent
+                                 ? LocalMatrix(slot)
+                                 : worldMatrices_[kParent] * LocalMatrix(slot);
+      auto& node = nodes[nodeIndices_[slot]];
+      node.pos = translations_[slot];
+      node.rot = rotations_[slot];
+      node.scale = scales_[slot];
+      node.matrix = matrices_[slot];
+      node.worldMatrix = worldMatrices_[slot];
+      dirty_[slot] = 0;
+      ++updated;
+    }
+  }
+  firstDirty_ = kCount;
+  return updated;
+}
+
+void TransformHierarchy::SetTranslation(size_t slot,
+                                        const glm::vec3& translation) {
+  translations_[slot] = translation;
+  MarkDirty(slot);
+}
+
+void TransformHierarchy::SetRotation(size_t slot, const glm::quat& rotation) {
+  rotations_[slot] = rotation;
+  MarkDirty(slot);
+}
+
+void TransformHierarchy::SetScale(size_t slot, const glm::vec3& scale) {
+  scales_[slot] = scale;
+  MarkDirty(slot);
+}
+
+void TransformHierarchy::SetMatrix(size_t slot, const glm::mat4& matrix) {
+  matrices_[slot] = matrix;
+  MarkDirty(slot);
+}
+
+void TransformHierarchy::MarkDirty(size_t slot) noexcept {
+  dirty_[slot] = 1;
+  firstDirty_ = std::min(firstDirty_, slot);
+}
+
+glm::mat4 TransformHierarchy::LocalMatrix(size_t slot) const {
+  // T * R * S without the generic matrix products
+  const glm::mat3 kRotation = glm::toMat3(rotations_[slot]);
+  glm::mat4 local(1.0f);
+  for (int axis = 0; axis < 3; ++axis) {
+    local[axis] = glm::vec4(kRotation[axis] * scales_[slot][axis], 0.0f);
+  }
+  local[3] = glm::vec4(translations_[slot], 1.0f);
+  return local * matrices_[slot];
+}
+
+}  // namespace Mgtt::Rendering
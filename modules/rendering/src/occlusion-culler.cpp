@@ -0,0 +1,323 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <occlusion-culler.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MGTT_OCCLUSION_CULLER_SSE2
+#endif
+
+namespace Mgtt::Rendering {
+namespace {
+
+// Vertices closer to the eye than this clip-space w are not projected
+constexpr float kMinClipW = 1e-5f;
+
+// Edge function a * x + b * y + c, positive on the inner side
+struct Edge {
+  float a;
+  float b;
+  float c;
+};
+
+Edge MakeEdge(const glm::vec2& from, const glm::vec2& to) {
+  const float kA = from.y - to.y;
+  const float kB = to.x - from.x;
+  return {kA, kB, -(kA * from.x + kB * from.y)};
+}
+
+}  // namespace
+
+void OcclusionCuller::Resize(uint32_t width, uint32_t height) {
+  width_ = std::max(4u, (width + 3u) & ~3u);
+  height_ = std::max(1u, height);
+  depth_.assign(static_cast<size_t>(width_) * height_, 1.0f);
+}
+
+void OcclusionCuller::BeginFrame(const glm::mat4& viewProjection) {
+  viewProjection_ = viewProjection;
+  occluders_.clear();
+  std::fill(depth_.begin(), depth_.end(), 1.0f);
+}
+
+bool OcclusionCuller::ProjectBounds(const Mgtt::Rendering::AABB& bounds,
+                                    glm::vec2& min, glm::vec2& max,
+                                    float& nearest) const {
+  min = glm::vec2(FLT_MAX);
+  max = glm::vec2(-FLT_MAX);
+  nearest = FLT_MAX;
+  for (int corner = 0; corner < 8; ++corner) {
+    const glm::vec4 kPosition((corner & 1) != 0 ? bounds.max.x : bounds.min.x,
+                              (corner & 2) != 0 ? bounds.max.y : bounds.min.y,
+                              (corner & 4) != 0 ? bounds.max.z : bounds.min.z,
+                              1.0f);
+    const glm::vec4 kClip = viewProjection_ * kPosition;
+    if (!(kClip.w > kMinClipW)) {
+      return false;
+    }
+    const glm::vec2 kScreen =
+        (glm::vec2(kClip.x, kClip.y) / kClip.w * 0.5f + 0.5f) *
+        glm::vec2(static_cast<float>(width_), static_cast<float>(height_));
+    min = glm::min(min, kScreen);
+    max = glm::max(max, kScreen);
+    nearest = std::min(nearest, kClip.z / kClip.w * 0.5f + 0.5f);
+  }
+  return true;
+}
+
+float OcclusionCuller::GetScreenCoverage(
+    const Mgtt::Rendering::AABB& bounds) const {
+  glm::vec2 min;
+  glm::vec2 max;
+  float nearest = 0.0f;
+  if (!ProjectBounds(bounds, min, max, nearest)) {
+    return 0.0f;
+  }
+  const glm::vec2 kSize(static_cast<float>(width_),
+                        static_cast<float>(height_));
+  const glm::vec2 kExtent = glm::clamp(max, glm::vec2(0.0f), kSize) -
+                            glm::clamp(min, glm::vec2(0.0f), kSize);
+  return std::max(0.0f, kExtent.x) * std::max(0.0f, kExtent.y) /
+         (kSize.x * kSize.y);
+}
+
+void OcclusionCuller::AddOccluder(const Mgtt::Rendering::Mesh& mesh,
+                                  uint32_t firstIndex, uint32_t indexCount,
+                                  const glm::mat4& model) {
+  occluders_.push_back({&mesh, firstIndex, indexCount,
+                        viewProjection_ * model});
+}
+
+size_t OcclusionCuller::Rasterize() {
+  triangles_.resize(occluders_.size());
+  workers_.ParallelFor(occluders_.size(), [this](size_t idx) {
+    SetupTriangles(occluders_[idx], triangles_[idx]);
+  });
+
+  // Every band is written by a single worker
+  const uint32_t kBandCount = (height_ + kBandRows - 1) / kBandRows;
+  workers_.ParallelFor(kBandCount, [this](size_t band) {
+    RasterizeBand(static_cast<uint32_t>(band));
+  });
+
+  size_t triangleCount = 0;
+  for (size_t idx = 0; idx < occluders_.size(); ++idx) {
+    triangleCount += triangles_[idx].size();
+  }
+  return triangleCount;
+}
+
+void OcclusionCuller::SetupTriangles(
+    const Occluder& occluder, std::vector<ScreenTriangle>& triangles) const {
+  triangles.clear();
+  const auto& indices = occluder.mesh->indices;
+  const auto& positions = occluder.mesh->vertexPositionAttribs;
+  const size_t kEnd =
+      std::min(indices.size(), static_cast<size_t>(occluder.firstIndex) +
+                                   occluder.indexCount);
+  const glm::vec2 kSize(static_cast<float>(width_),
+                        static_cast<float>(height_));
+  for (size_t idx = occluder.firstIndex; idx + 3 <= kEnd; idx += 3) {
+    glm::vec2 screen[3];
+    float depth = 0.0f;
+    bool projected = true;
+    for (size_t vertex = 0; vertex < 3 && projected; ++vertex) {
+      const uint32_t kIndex = indices[idx + vertex];
+      if (kIndex >= positions.size()) {
+        projected = false;
+        break;
+      }
+      const glm::vec4 kClip =
+          occluder.clip * glm::vec4(positions[kIndex], 1.0f);
+      // Skipping triangles that cross the near plane only loses occlusion
+      projected = kClip.w > kMinClipW && kClip.z >= -kClip.w;
+      screen[vertex] =
+          (glm::vec2(kClip.x, kClip.y) / kClip.w * 0.5f + 0.5f) * kSize;
+      depth = std::max(depth, kClip.z / kClip.w * 0.5f + 0.5f);
+    }
+    if (!projected) {
+      continue;
+    }
+    const glm::vec2 kMin = glm::min(glm::min(screen[0], screen[1]), screen[2]);
+    const glm::vec2 kMax = glm::max(glm::max(screen[0], screen[1]), screen[2]);
+    if (kMax.x < 0.0f || kMax.y < 0.0f || kMin.x > kSize.x ||
+        kMin.y > kSize.y) {
+      continue;
+    }
+    const glm::vec2 kEdge0 = screen[1] - screen[0];
+    const glm::vec2 kEdge1 = screen[2] - screen[0];
+    const float kArea = kEdge0.x * kEdge1.y - kEdge0.y * kEdge1.x;
+    if (!(kArea != 0.0f)) {
+      continue;
+    }
+    // Occluders are drawn two-sided, so wind them all the same way
+    if (kArea < 0.0f) {
+      std::swap(screen[1], screen[2]);
+    }
+    triangles.push_back({screen[0], screen[1], screen[2],
+                         std::min(depth, 1.0f)});
+  }
+}
+
+void OcclusionCuller::RasterizeBand(uint32_t band) {
+  const int kBandBegin = static_cast<int>(band * kBandRows);
+  const int kBandEnd =
+      static_cast<int>(std::min(height_, (band + 1) * kBandRows)) - 1;
+  const int kLastColumn = static_cast<int>(width_) - 1;
+  for (const auto& triangles : triangles_) {
+    for (const auto& triangle : triangles) {
+      // Pixels are covered when their centre is strictly inside
+      const float kMinY =
+          std::min(std::min(triangle.v0.y, triangle.v1.y), triangle.v2.y);
+      const float kMaxY =
+          std::max(std::max(triangle.v0.y, triangle.v1.y), triangle.v2.y);
+      const int kRowBegin = std::max(
+          kBandBegin, static_cast<int>(std::ceil(std::max(kMinY, 0.0f) -
+                                                 0.5f)));
+      const int kRowEnd = std::min(
+          kBandEnd,
+          static_cast<int>(std::floor(
+              std::min(kMaxY, static_cast<float>(height_)) - 0.5f)));
+      if (kRowBegin > kRowEnd) {
+        continue;
+      }
+      const float kMinX =
+          std::min(std::min(triangle.v0.x, triangle.v1.x), triangle.v2.x);
+      const float kMaxX =
+          std::max(std::max(triangle.v0.x, triangle.v1.x), triangle.v2.x);
+      const int kColumnBegin = std::max(
+          0, static_cast<int>(std::ceil(std::max(kMinX, 0.0f) - 0.5f)));
+      const int kColumnEnd = std::min(
+          kLastColumn,
+          static_cast<int>(std::floor(
+              std::min(kMaxX, static_cast<float>(width_)) - 0.5f)));
+      if (kColumnBegin > kColumnEnd) {
+        continue;
+      }
+
+      const Edge kEdges[3] = {MakeEdge(triangle.v1, triangle.v2),
+                              MakeEdge(triangle.v2, triangle.v0),
+                              MakeEdge(triangle.v0, triangle.v1)};
+      for (int row = kRowBegin; row <= kRowEnd; ++row) {
+        float* depth = depth_.data() + static_cast<size_t>(row) * width_;
+        const float kY = static_cast<float>(row) + 0.5f;
+        int column = kColumnBegin;
+#ifdef MGTT_OCCLUSION_CULLER_SSE2
+        // Whole aligned blocks; the edge test masks pixels outside the
+        // triangle and the width is a multiple of 4
+        const __m128 kZero = _mm_setzero_ps();
+        const __m128 kDepth = _mm_set1_ps(triangle.depth);
+        const __m128 kOffsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+        __m128 rowTerms[3];
+        __m128 slopes[3];
+        for (int edge = 0; edge < 3; ++edge) {
+          rowTerms[edge] =
+              _mm_set1_ps(kEdges[edge].b * kY + kEdges[edge].c);
+          slopes[edge] = _mm_set1_ps(kEdges[edge].a);
+        }
+        for (column = kColumnBegin & ~3; column <= kColumnEnd; column += 4) {
+          const __m128 kX =
+              _mm_add_ps(_mm_set1_ps(static_cast<float>(column)), kOffsets);
+          __m128 inside = _mm_cmpgt_ps(
+              _mm_add_ps(_mm_mul_ps(slopes[0], kX), rowTerms[0]), kZero);
+          inside = _mm_and_ps(
+              inside,
+              _mm_cmpgt_ps(_mm_add_ps(_mm_mul_ps(slopes[1], kX), rowTerms[1]),
+                           kZero));
+          inside = _mm_and_ps(
+              inside,
+              _mm_cmpgt_ps(_mm_add_ps(_mm_mul_ps(slopes[2], kX), rowTerms[2]),
+                           kZero));
+          const __m128 kOld = _mm_loadu_ps(depth + column);
+          _mm_storeu_ps(depth + column,
+                        _mm_or_ps(_mm_and_ps(inside, _mm_min_ps(kOld, kDepth)),
+                                  _mm_andnot_ps(inside, kOld)));
+        }
+#endif
+        for (; column <= kColumnEnd; ++column) {
+          const float kX = static_cast<float>(column) + 0.5f;
+          bool inside = true;
+          for (const auto& edge : kEdges) {
+            inside = inside && edge.a * kX + (edge.b * kY + edge.c) > 0.0f;
+          }
+          if (inside) {
+            depth[column] = std::min(depth[column], triangle.depth);
+          }
+        }
+      }
+    }
+  }
+}
+
+bool OcclusionCuller::IsVisible(const Mgtt::Rendering::AABB& bounds) const {
+  glm::vec2 min;
+  glm::vec2 max;
+  float nearest = 0.0f;
+  if (!ProjectBounds(bounds, min, max, nearest)) {
+    return true;
+  }
+  // Every pixel the rectangle touches, not only those with the centre in it
+  const int kColumnBegin =
+      static_cast<int>(std::floor(std::max(min.x, 0.0f)));
+  const int kColumnEnd = std::min(
+      static_cast<int>(width_) - 1,
+      static_cast<int>(
+          std::floor(std::min(max.x, static_cast<float>(width_)))));
+  const int kRowBegin = static_cast<int>(std::floor(std::max(min.y, 0.0f)));
+  const int kRowEnd = std::min(
+      static_cast<int>(height_) - 1,
+      static_cast<int>(
+          std::floor(std::min(max.y, static_cast<float>(height_)))));
+  if (kColumnBegin > kColumnEnd || kRowBegin > kRowEnd) {
+    // Off screen, which is for the frustum test to decide
+    return true;
+  }
+
+  for (int row = kRowBegin; row <= kRowEnd; ++row) {
+    const float* depth = depth_.data() + static_cast<size_t>(row) * width_;
+    int column = kColumnBegin;
+#ifdef MGTT_OCCLUSION_CULLER_SSE2
+    // Testing whole aligned blocks only widens the rectangle
+    const __m128 kNearest = _mm_set1_ps(nearest);
+    for (column = kColumnBegin & ~3; column <= kColumnEnd; column += 4) {
+      if (_mm_movemask_ps(
+              _mm_cmple_ps(kNearest, _mm_loadu_ps(depth + column))) != 0) {
+        return true;
+      }
+    }
+#endif
+    for (; column <= kColumnEnd; ++column) {
+      if (nearest <= depth[column]) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,240 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <occlusion-queries.h>
+
+#include <algorithm>
+#include <cfloat>
+
+namespace Mgtt::Rendering {
+namespace {
+
+/**
+ * @brief Whether a box reaches in front of the near plane, where its
+ * clipped faces would no longer enclose what it bounds.
+ */
+bool CrossesNearPlane(const glm::mat4& mvp,
+                      const Mgtt::Rendering::AABB& bounds) {
+  for (int corner = 0; corner < 8; ++corner) {
+    const glm::vec4 kClip =
+        mvp * glm::vec4((corner & 1) != 0 ? bounds.max.x : bounds.min.x,
+                        (corner & 2) != 0 ? bounds.max.y : bounds.min.y,
+                        (corner & 4) != 0 ? bounds.max.z : bounds.min.z,
+                        1.0f);
+    if (kClip.w <= 0.0f || kClip.z < -kClip.w) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+Mgtt::Common::Result<void> OcclusionQueries::Init(
+    const std::pair<std::string_view, std::string_view>& shaderPaths) {
+  if (auto result = shader_.Compile(shaderPaths); result.err()) {
+    return Mgtt::Common::Result<void>::Err(result.error());
+  }
+  const GLuint kProgram = shader_.GetProgramId();
+  mvpLocation_ = glGetUniformLocation(kProgram, "mvp");
+  boundsMinLocation_ = glGetUniformLocation(kProgram, "boundsMin");
+  boundsMaxLocation_ = glGetUniformLocation(kProgram, "boundsMax");
+
+  if (cubeVao_ != 0) {
+    return Mgtt::Common::Result<void>::Ok();
+  }
+  // Corner i of the unit cube has x, y and z from bits 0, 1 and 2 of i
+  static constexpr float kVertices[] = {
+      0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 1.f, 1.f, 0.f,
+      0.f, 0.f, 1.f, 1.f, 0.f, 1.f, 0.f, 1.f, 1.f, 1.f, 1.f, 1.f,
+  };
+  static constexpr uint8_t kIndices[] = {
+      0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5, 0, 1, 5, 0, 5, 4,
+      2, 6, 7, 2, 7, 3, 0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6,
+  };
+  glGenVertexArrays(1, &cubeVao_);
+  glGenBuffers(1, &cubeVbo_);
+  glGenBuffers(1, &cubeEbo_);
+  glBindVertexArray(cubeVao_);
+  glBindBuffer(GL_ARRAY_BUFFER, cubeVbo_);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices), kVertices, GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, cubeEbo_);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kIndices), kIndices,
+               GL_STATIC_DRAW);
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
+  glBindVertexArray(0);
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+void OcclusionQueries::Clear() noexcept {
+  for (const auto& pending : pending_) {
+    freeQueries_.push_back(pending.query);
+  }
+  if (!freeQueries_.empty()) {
+    glDeleteQueries(static_cast<GLsizei>(freeQueries_.size()),
+                    freeQueries_.data());
+  }
+  if (cubeVao_ != 0) {
+    glDeleteVertexArrays(1, &cubeVao_);
+    glDeleteBuffers(1, &cubeVbo_);
+    glDeleteBuffers(1, &cubeEbo_);
+  }
+  shader_.Clear();
+  cubeVao_ = 0;
+  cubeVbo_ = 0;
+  cubeEbo_ = 0;
+  freeQueries_.clear();
+  pending_.clear();
+  visible_.clear();
+  inFlight_.clear();
+  resultFrames_.clear();
+  stats_ = {};
+}
+
+void OcclusionQueries::Reset(size_t drawCount) {
+  for (auto& pending : pending_) {
+    pending.draw = kDroppedDraw;
+  }
+  visible_.assign(drawCount, 1);
+  inFlight_.assign(drawCount, 0);
+  resultFrames_.assign(drawCount, kNoResult);
+}
+
+void OcclusionQueries::BeginFrame() {
+  ++frame_;
+  stats_ = {};
+  uint64_t latencySum = 0;
+  // Results become available in issue order, so stop at the first that
+  // is not; asking for it now would stall until the GPU catches up
+  while (!pending_.empty()) {
+    const PendingQuery kPending = pending_.front();
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(kPending.query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_FALSE) {
+      break;
+    }
+    GLuint anySamplesPassed = GL_FALSE;
+    glGetQueryObjectuiv(kPending.query, GL_QUERY_RESULT, &anySamplesPassed);
+    pending_.pop_front();
+    freeQueries_.push_back(kPending.query);
+
+    if (kPending.draw != kDroppedDraw) {
+      visible_[kPending.draw] = anySamplesPassed != GL_FALSE ? 1 : 0;
+      inFlight_[kPending.draw] = 0;
+      resultFrames_[kPending.draw] = frame_;
+    }
+    const auto kLatency = static_cast<uint32_t>(frame_ - kPending.frame);
+    latencySum += kLatency;
+    stats_.maxLatency = std::max(stats_.maxLatency, kLatency);
+    ++stats_.read;
+  }
+  if (stats_.read > 0) {
+    stats_.averageLatency =
+        static_cast<float>(latencySum) / static_cast<float>(stats_.read);
+  }
+  stats_.pending = static_cast<uint32_t>(pending_.size());
+}
+
+bool OcclusionQueries::IsVisible(size_t draw) const {
+  if (draw >= visible_.size()) {
+    return true;
+  }
+  return visible_[draw] != 0 || frame_ - resultFrames_[draw] > kStaleFrames;
+}
+
+bool OcclusionQueries::IsDue(size_t draw) const {
+  if (inFlight_[draw] != 0) {
+    return false;
+  }
+  // Hidden draws, untested ones and those back in the frustum after a
+  // while go first; the rest are spread over the interval
+  if (visible_[draw] == 0 || resultFrames_[draw] == kNoResult ||
+      frame_ - resultFrames_[draw] >= kVisibleQueryInterval) {
+    return true;
+  }
+  return (frame_ + draw) % kVisibleQueryInterval == 0;
+}
+
+void OcclusionQueries::IssueQueries(
+    const glm::mat4& mvp, const Mgtt::Rendering::FrustumCuller& culler) {
+  if (culler.Size() != visible_.size()) {
+    Reset(culler.Size());
+  }
+  if (cubeVao_ == 0 || shader_.Use().err()) {
+    return;
+  }
+
+  GLint depthFunc = GL_LESS;
+  glGetIntegerv(GL_DEPTH_FUNC, &depthFunc);
+  const GLboolean kCullFace = glIsEnabled(GL_CULL_FACE);
+  glDisable(GL_CULL_FACE);
+  glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+  glDepthMask(GL_FALSE);
+  // Boxes touching the surface they bound must still pass
+  glDepthFunc(GL_LEQUAL);
+  glUniformMatrix4fv(mvpLocation_, 1, GL_FALSE, &mvp[0][0]);
+  glBindVertexArray(cubeVao_);
+
+  for (size_t draw = 0; draw < culler.Size(); ++draw) {
+    if (!culler.IsVisible(draw) || !IsDue(draw)) {
+      continue;
+    }
+    const auto kBounds = culler.GetBounds(draw);
+    if (kBounds.min.x == -FLT_MAX) {
+      // Primitives without bounds are always drawn
+      continue;
+    }
+    if (CrossesNearPlane(mvp, kBounds)) {
+      visible_[draw] = 1;
+      resultFrames_[draw] = frame_;
+      continue;
+    }
+
+    GLuint query = 0;
+    if (freeQueries_.empty()) {
+      glGenQueries(1, &query);
+    } else {
+      query = freeQueries_.back();
+      freeQueries_.pop_back();
+    }
+    glUniform3fv(boundsMinLocation_, 1, &kBounds.min[0]);
+    glUniform3fv(boundsMaxLocation_, 1, &kBounds.max[0]);
+    glBeginQuery(GL_ANY_SAMPLES_PASSED, query);
+    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_BYTE, nullptr);
+    glEndQuery(GL_ANY_SAMPLES_PASSED);
+    pending_.push_back({query, static_cast<uint32_t>(draw), frame_});
+    inFlight_[draw] = 1;
+    ++stats_.issued;
+  }
+
+  glBindVertexArray(0);
+  glDepthFunc(static_cast<GLenum>(depthFunc));
+  glDepthMask(GL_TRUE);
+  glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+  if (kCullFace == GL_TRUE) {
+    glEnable(GL_CULL_FACE);
+  }
+  stats_.pending = static_cast<uint32_t>(pending_.size());
+}
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,179 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <render-queue.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+
+namespace Mgtt::Rendering {
+namespace {
+
+constexpr uint64_t kMaxDepth =
+    (uint64_t{1} << Mgtt::Rendering::RenderQueue::kDepthBits) - 1;
+
+uint64_t Saturate(uint32_t value, uint32_t bits) {
+  return std::min<uint64_t>(value, (uint64_t{1} << bits) - 1);
+}
+
+}  // namespace
+
+uint64_t RenderQueue::MakeKey(Mgtt::Rendering::RenderPass pass,
+                              uint32_t shader, uint32_t material,
+                              uint32_t textureSet, uint32_t vao,
+                              float depth) {
+  const float kDepth = depth > 0.0f ? std::min(depth, 1.0f) : 0.0f;
+  const auto kDepthKey =
+      static_cast<uint64_t>(kDepth * static_cast<float>(kMaxDepth) + 0.5f);
+  // VAO names past the field wrap around, which only costs grouping
+  const uint64_t kState =
+      Saturate(shader, kShaderBits)
+          << (kMaterialBits + kTextureSetBits + kVaoBits) |
+      Saturate(material, kMaterialBits) << (kTextureSetBits + kVaoBits) |
+      Saturate(textureSet, kTextureSetBits) << kVaoBits |
+      (vao & ((uint64_t{1} << kVaoBits) - 1));
+  const uint64_t kPass = static_cast<uint64_t>(pass) << 62;
+  if (pass == Mgtt::Rendering::RenderPass::Blend) {
+    return kPass |
+           (kMaxDepth - kDepthKey)
+               << (kShaderBits + kMaterialBits + kTextureSetBits + kVaoBits) |
+           kState;
+  }
+  return kPass | kState << kDepthBits | kDepthKey;
+}
+
+Mgtt::Rendering::RenderPass RenderQueue::GetPass(
+    const Mgtt::Rendering::PbrMaterial& material) {
+  switch (material.alphaMode) {
+    case Mgtt::Rendering::AlphaMode::BLEND:
+      return Mgtt::Rendering::RenderPass::Blend;
+    case Mgtt::Rendering::AlphaMode::MASK:
+      return Mgtt::Rendering::RenderPass::Mask;
+    default:
+      return Mgtt::Rendering::RenderPass::Opaque;
+  }
+}
+
+void RenderQueue::AssignStateIds(
+    const std::vector<Mgtt::Rendering::InstanceBatch>& batches) {
+  firstPrimitives_.clear();
+  materialIds_.clear();
+  textureSetIds_.clear();
+  std::map<std::array<float, 12>, uint32_t> materials;
+  std::map<std::array<uint32_t, 5>, uint32_t> textureSets;
+  for (const auto& batch : batches) {
+    firstPrimitives_.push_back(materialIds_.size());
+    if (batch.mesh == nullptr) {
+      continue;
+    }
+    for (const auto& prim : batch.mesh->meshPrimitives) {
+      const auto& mat = prim.pbrMaterial;
+      const std::array<float, 12> kFactors = {
+          mat.baseColorTexture.color.x,
+          mat.baseColorTexture.color.y,
+          mat.baseColorTexture.color.z,
+          mat.baseColorTexture.color.w,
+          mat.emissiveTexture.color.x,
+          mat.emissiveTexture.color.y,
+          mat.emissiveTexture.color.z,
+          mat.occlusionTexture.strength,
+          mat.metallicRoughnessTexture.metallicFactor,
+          mat.metallicRoughnessTexture.roughnessFactor,
+          mat.alphaCutoff,
+          mat.doubleSided ? 1.0f : 0.0f};
+      const std::array<uint32_t, 5> kTextures = {
+          mat.baseColorTexture.id, mat.metallicRoughnessTexture.id,
+          mat.normalTexture.id, mat.emissiveTexture.id,
+          mat.occlusionTexture.id};
+      materialIds_.push_back(
+          materials.emplace(kFactors, static_cast<uint32_t>(materials.size()))
+              .first->second);
+      textureSetIds_.push_back(
+          textureSets
+              .emplace(kTextures, static_cast<uint32_t>(textureSets.size()))
+              .first->second);
+    }
+  }
+  firstPrimitives_.push_back(materialIds_.size());
+  materialCount_ = static_cast<uint32_t>(materials.size());
+  textureSetCount_ = static_cast<uint32_t>(textureSets.size());
+}
+
+void RenderQueue::BeginFrame() noexcept {
+  items_.clear();
+  ranges_.clear();
+  pendingRange_ = 0;
+}
+
+void RenderQueue::Clear() noexcept {
+  BeginFrame();
+  sorted_.clear();
+  firstPrimitives_.clear();
+  materialIds_.clear();
+  textureSetIds_.clear();
+  materialCount_ = 0;
+  textureSetCount_ = 0;
+}
+
+void RenderQueue::AddRange(uint32_t firstIndex, uint32_t indexCount) {
+  ranges_.push_back({firstIndex, indexCount});
+}
+
+void RenderQueue::Push(uint64_t key, uint32_t batch, uint32_t primitive) {
+  const auto kRangeEnd = static_cast<uint32_t>(ranges_.size());
+  if (kRangeEnd == pendingRange_) {
+    return;
+  }
+  items_.push_back(
+      {key, batch, primitive, pendingRange_, kRangeEnd - pendingRange_});
+  pendingRange_ = kRangeEnd;
+}
+
+void RenderQueue::Sort() {
+  const size_t kCount = items_.size();
+  if (kCount < 2) {
+    return;
+  }
+  sorted_.resize(kCount);
+  for (uint32_t shift = 0; shift < 64; shift += 8) {
+    std::array<size_t, 256> offsets{};
+    for (const auto& item : items_) {
+      ++offsets[(item.key >> shift) & 0xff];
+    }
+    if (offsets[(items_[0].key >> shift) & 0xff] == kCount) {
+      continue;
+    }
+    size_t offset = 0;
+    for (auto& bucket : offsets) {
+      const size_t kBucketSize = bucket;
+      bucket = offset;
+      offset += kBucketSize;
+    }
+    for (const auto& item : items_) {
+      sorted_[offsets[(item.key >> shift) & 0xff]++] = item;
+    }
+    items_.swap(sorted_);
+  }
+}
+
+}  // namespace Mgtt::Rendering
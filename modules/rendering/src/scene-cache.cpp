@@ -0,0 +1,895 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <mapped-file.h>
+#include <scene-cache.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+namespace {
+
+constexpr uint32_t kCacheMagic = 0x4353474D;  // "MGSC"
+// Size stamped for a dependency that does not exist
+constexpr uint64_t kMissingSize = ~uint64_t{0};
+
+struct SourceStamp {
+  int64_t modifiedTime{0};
+  uint64_t size{0};
+
+  bool operator==(const SourceStamp& other) const {
+    return modifiedTime == other.modifiedTime && size == other.size;
+  }
+};
+
+std::string AbsolutePath(std::string_view path) {
+  std::error_code error;
+  const auto kAbsolute =
+      std::filesystem::absolute(std::filesystem::path(path), error);
+  return error ? std::string(path) : kAbsolute.lexically_normal().string();
+}
+
+bool StampSource(const std::string& path, SourceStamp& stamp) {
+  std::error_code error;
+  const auto kModified = std::filesystem::last_write_time(path, error);
+  if (error) {
+    return false;
+  }
+  const auto kSize = std::filesystem::file_size(path, error);
+  if (error) {
+    return false;
+  }
+  stamp.modifiedTime =
+      static_cast<int64_t>(kModified.time_since_epoch().count());
+  stamp.size = static_cast<uint64_t>(kSize);
+  return true;
+}
+
+/**
+ * @brief Stamp of a file the source pulled in. A missing file gets a stamp
+ * of its own, so that creating it later invalidates the entry as well.
+ */
+SourceStamp StampDependency(const std::string& path) {
+  SourceStamp stamp;
+  if (!StampSource(path, stamp)) {
+    stamp = SourceStamp{0, kMissingSize};
+  }
+  return stamp;
+}
+
+/**
+ * @brief Appends plain values, strings and arrays to an in-memory entry.
+ */
+class CacheWriter {
+ public:
+  explicit CacheWriter(std::string& bytes) : bytes_(bytes) {}
+
+  template <typename T>
+  void Write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    bytes_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  void WriteBytes(const void* data, uint64_t size) {
+    Write(size);
+    if (size > 0) {
+      bytes_.append(static_cast<const char*>(data),
+                    static_cast<size_t>(size));
+    }
+  }
+
+  void WriteString(const std::string& value) {
+    WriteBytes(value.data(), value.size());
+  }
+
+  template <typename T>
+  void WriteVector(const std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    Write<uint64_t>(values.size());
+    bytes_.append(reinterpret_cast<const char*>(values.data()),
+                  values.size() * sizeof(T));
+  }
+
+ private:
+  std::string& bytes_;
+};
+
+/**
+ * @brief Bounds-checked reads from a mapped cache file.
+ */
+class CacheReader {
+ public:
+  CacheReader(const unsigned char* data, size_t size)
+      : data_(data), size_(size) {}
+
+  [[nodiscard]] const unsigned char* Take(uint64_t byteCount) {
+    if (byteCount > size_ - offset_) {
+      return nullptr;
+    }
+    const unsigned char* bytes = data_ + offset_;
+    offset_ += static_cast<size_t>(byteCount);
+    return bytes;
+  }
+
+  template <typename T>
+  [[nodiscard]] bool Read(T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const unsigned char* bytes = Take(sizeof(T));
+    if (bytes == nullptr) {
+      return false;
+    }
+    std::memcpy(&value, bytes, sizeof(T));
+    return true;
+  }
+
+  [[nodiscard]] bool ReadString(std::string& value) {
+    uint64_t size = 0;
+    if (!Read(size)) {
+      return false;
+    }
+    const unsigned char* bytes = Take(size);
+    if (bytes == nullptr) {
+      return false;
+    }
+    value.assign(reinterpret_cast<const char*>(bytes),
+                 static_cast<size_t>(size));
+    return true;
+  }
+
+  template <typename T>
+  [[nodiscard]] bool ReadVector(std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    uint64_t count = 0;
+    if (!Read(count) || count > (size_ - offset_) / sizeof(T)) {
+      return false;
+    }
+    values.resize(static_cast<size_t>(count));
+    const unsigned char* bytes = Take(count * sizeof(T));
+    if (count > 0) {
+      std::memcpy(values.data(), bytes, values.size() * sizeof(T));
+    }
+    return true;
+  }
+
+ private:
+  const unsigned char* data_;
+  size_t size_;
+  size_t offset_{0};
+};
+
+void WriteMaterial(CacheWriter& writer,
+                   const Mgtt::Rendering::PbrMaterial& material) {
+  writer.WriteString(material.name);
+  writer.Write(material.alphaCutoff);
+  writer.Write(material.doubleSided);
+  writer.Write(static_cast<int32_t>(material.alphaMode));
+  // Textures are stored by path and resolved against the textureMap
+  writer.WriteString(material.baseColorTexture.path);
+  writer.Write(material.baseColorTexture.color);
+  writer.WriteString(material.normalTexture.path);
+  writer.Write(material.normalTexture.scale);
+  writer.WriteString(material.occlusionTexture.path);
+  writer.Write(material.occlusionTexture.strength);
+  writer.WriteString(material.emissiveTexture.path);
+  writer.Write(material.emissiveTexture.color);
+  writer.WriteString(material.metallicRoughnessTexture.path);
+  writer.Write(material.metallicRoughnessTexture.metallicFactor);
+  writer.Write(material.metallicRoughnessTexture.roughnessFactor);
+}
+
+void WriteMesh(CacheWriter& writer, const Mgtt::Rendering::Mesh& mesh) {
+  writer.WriteString(mesh.name);
+  writer.Write(mesh.aabb);
+  writer.WriteVector(mesh.indices);
+  writer.WriteVector(mesh.vertexPositionAttribs);
+  writer.WriteVector(mesh.vertexNormalAttribs);
+  writer.WriteVector(mesh.vertexTextureAttribs);
+  writer.WriteVector(mesh.vertexTangentAttribs);
+  writer.WriteVector(mesh.vertexJointAttribs);
+  writer.WriteVector(mesh.vertexWeightAttribs);
+
+  writer.Write<uint64_t>(mesh.meshPrimitives.size());
+  for (const auto& prim : mesh.meshPrimitives) {
+    writer.WriteString(prim.name);
+    writer.Write(prim.firstIndex);
+    writer.Write(prim.indexCount);
+    writer.Write(prim.vertexCount);
+    writer.Write(prim.hasSkin);
+    writer.Write(prim.hasIndices);
+    writer.Write(prim.aabb);
+    writer.WriteVector(prim.lods);
+    writer.WriteVector(prim.meshlets);
+    WriteMaterial(writer, prim.pbrMaterial);
+  }
+}
+
+void WriteNode(
+    CacheWriter& writer, const Mgtt::Rendering::Node& node,
+    const std::unordered_map<const Mgtt::Rendering::Mesh*, int32_t>& meshIds) {
+  writer.WriteString(node.name);
+  writer.Write(node.index);
+  writer.Write(node.pos);
+  writer.Write(node.rot);
+  writer.Write(node.scale);
+  writer.Write(node.matrix);
+  writer.Write(node.worldMatrix);
+  writer.Write(node.aabb);
+  writer.Write(node.mesh != nullptr ? meshIds.at(node.mesh.get()) : -1);
+  writer.WriteVector(node.instanceMatrices);
+  writer.Write(node.parent);
+}
+
+using TexturesByPath =
+    std::unordered_map<std::string, const Mgtt::Rendering::Texture*>;
+
+/**
+ * @brief Read a texture reference and copy the matching textureMap entry,
+ * the same way the importers fill material textures.
+ */
+bool ReadTextureRef(CacheReader& reader, const TexturesByPath& textures,
+                    Mgtt::Rendering::Texture& texture) {
+  std::string path;
+  if (!reader.ReadString(path)) {
+    return false;
+  }
+  if (auto iter = textures.find(path); iter != textures.end()) {
+    texture = *iter->second;
+  } else {
+    texture.path = std::move(path);
+  }
+  return true;
+}
+
+bool ReadMaterial(CacheReader& reader, const TexturesByPath& textures,
+                  Mgtt::Rendering::PbrMaterial& material) {
+  int32_t alphaMode = 0;
+  const bool kOk =
+      reader.ReadString(material.name) && reader.Read(material.alphaCutoff) &&
+      reader.Read(material.doubleSided) && reader.Read(alphaMode) &&
+      ReadTextureRef(reader, textures, material.baseColorTexture) &&
+      reader.Read(material.baseColorTexture.color) &&
+      ReadTextureRef(reader, textures, material.normalTexture) &&
+      reader.Read(material.normalTexture.scale) &&
+      ReadTextureRef(reader, textures, material.occlusionTexture) &&
+      reader.Read(material.occlusionTexture.strength) &&
+      ReadTextureRef(reader, textures, material.emissiveTexture) &&
+      reader.Read(material.emissiveTexture.color) &&
+      ReadTextureRef(reader, textures, material.metallicRoughnessTexture) &&
+      reader.Read(material.metallicRoughnessTexture.metallicFactor) &&
+      reader.Read(material.metallicRoughnessTexture.roughnessFactor);
+  if (!kOk || alphaMode < static_cast<int32_t>(AlphaMode::NONE) ||
+      alphaMode > static_cast<int32_t>(AlphaMode::BLEND)) {
+    return false;
+  }
+  material.alphaMode = static_cast<AlphaMode>(alphaMode);
+  return true;
+}
+
+bool ReadMesh(CacheReader& reader, const TexturesByPath& textures,
+              Mgtt::Rendering::Mesh& mesh) {
+  uint64_t primCount = 0;
+  if (!reader.ReadString(mesh.name) || !reader.Read(mesh.aabb) ||
+      !reader.ReadVector(mesh.indices) ||
+      !reader.ReadVector(mesh.vertexPositionAttribs) ||
+      !reader.ReadVector(mesh.vertexNormalAttribs) ||
+      !reader.ReadVector(mesh.vertexTextureAttribs) ||
+      !reader.ReadVector(mesh.vertexTangentAttribs) ||
+      !reader.ReadVector(mesh.vertexJointAttribs) ||
+      !reader.ReadVector(mesh.vertexWeightAttribs) ||
+      !reader.Read(primCount)) {
+    return false;
+  }
+  // Attributes are uploaded per vertex, so each is absent or complete
+  const size_t kVertexCount = mesh.vertexPositionAttribs.size();
+  for (const size_t kAttribCount :
+       {mesh.vertexNormalAttribs.size(), mesh.vertexTextureAttribs.size(),
+        mesh.vertexTangentAttribs.size(), mesh.vertexJointAttribs.size(),
+        mesh.vertexWeightAttribs.size()}) {
+    if (kAttribCount != 0 && kAttribCount != kVertexCount) {
+      return false;
+    }
+  }
+  // Indices are uploaded as-is, so each must address a stored vertex
+  for (const uint32_t kIdx : mesh.indices) {
+    if (kIdx >= kVertexCount) {
+      return false;
+    }
+  }
+
+  for (uint64_t idx = 0; idx < primCount; ++idx) {
+    Mgtt::Rendering::MeshPrimitive prim;
+    if (!reader.ReadString(prim.name) || !reader.Read(prim.firstIndex) ||
+        !reader.Read(prim.indexCount) || !reader.Read(prim.vertexCount) ||
+        !reader.Read(prim.hasSkin) || !reader.Read(prim.hasIndices) ||
+        !reader.Read(prim.aabb) || !reader.ReadVector(prim.lods) ||
+        !reader.ReadVector(prim.meshlets) ||
+        !ReadMaterial(reader, textures, prim.pbrMaterial)) {
+      return false;
+    }
+    if (static_cast<uint64_t>(prim.firstIndex) + prim.indexCount >
+        mesh.indices.size()) {
+      return false;
+    }
+    for (const auto& lod : prim.lods) {
+      if (static_cast<uint64_t>(lod.firstIndex) + lod.indexCount >
+          mesh.indices.size()) {
+        return false;
+      }
+    }
+    for (const auto& meshlet : prim.meshlets) {
+      if (static_cast<uint64_t>(meshlet.firstIndex) + meshlet.indexCount >
+          mesh.indices.size()) {
+        return false;
+      }
+    }
+    mesh.meshPrimitives.push_back(std::move(prim));
+  }
+  return true;
+}
+
+/**
+ * @brief Read the next node and link it to its parent, which must have been
+ * read before it.
+ */
+bool ReadNode(CacheReader& reader,
+              const std::vector<std::shared_ptr<Mgtt::Rendering::Mesh>>& meshes,
+              std::vector<Mgtt::Rendering::Node>& nodes,
+              std::vector<uint32_t>& rootNodes) {
+  const auto kIndex = static_cast<uint32_t>(nodes.size());
+  auto& node = nodes.emplace_back();
+
+  int32_t meshId = -1;
+  if (!reader.ReadString(node.name) || !reader.Read(node.index) ||
+      !reader.Read(node.pos) || !reader.Read(node.rot) ||
+      !reader.Read(node.scale) || !reader.Read(node.matrix) ||
+      !reader.Read(node.worldMatrix) || !reader.Read(node.aabb) ||
+      !reader.Read(meshId) || !reader.ReadVector(node.instanceMatrices) ||
+      !reader.Read(node.parent)) {
+    return false;
+  }
+  if (meshId >= static_cast<int32_t>(meshes.size())) {
+    return false;
+  }
+  if (meshId >= 0) {
+    node.mesh = meshes[static_cast<size_t>(meshId)];
+  }
+
+  if (node.parent == Mgtt::Rendering::Node::kNoParent) {
+    rootNodes.push_back(kIndex);
+  } else if (node.parent < kIndex) {
+    nodes[node.parent].children.push_back(kIndex);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Publish an encoded entry. It is written to a temporary file first,
+ * so readers never see a partial entry.
+ */
+Mgtt::Common::Result<void> WriteEntry(const std::string& directory,
+                                      const std::string& entryPath,
+                                      const std::string& bytes) {
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+  if (error) {
+    return Mgtt::Common::Result<void>::Err(
+        "Cannot create scene cache directory: " + directory);
+  }
+
+  const std::string kTmpPath = entryPath + ".tmp";
+  {
+    std::ofstream file(kTmpPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return Mgtt::Common::Result<void>::Err(
+          "Cannot write scene cache entry: " + kTmpPath);
+    }
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    file.flush();
+    if (!file) {
+      file.close();
+      std::filesystem::remove(kTmpPath, error);
+      return Mgtt::Common::Result<void>::Err(
+          "Failed to write scene cache entry: " + kTmpPath);
+    }
+  }
+
+  std::filesystem::rename(kTmpPath, entryPath, error);
+  if (error) {
+    std::filesystem::remove(kTmpPath, error);
+    return Mgtt::Common::Result<void>::Err(
+        "Failed to publish scene cache entry: " + entryPath);
+  }
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+/**
+ * @brief Evict the least recently used entries of a directory until the
+ * remaining ones fit the size limit. Load() refreshes the modification time
+ * of the entries it serves, so that time orders them by last use.
+ */
+void TrimEntries(const std::string& directory, const std::string& keepPath,
+                 uint64_t sizeLimit) {
+  if (sizeLimit == 0) {
+    return;
+  }
+  struct Entry {
+    std::filesystem::path path;
+    std::filesystem::file_time_type lastUse;
+    uint64_t size{0};
+  };
+  std::vector<Entry> entries;
+  uint64_t totalSize = 0;
+  std::error_code error;
+  for (const auto& file :
+       std::filesystem::directory_iterator(directory, error)) {
+    if (file.path().extension() != ".mgttscene" ||
+        !file.is_regular_file(error)) {
+      continue;
+    }
+    Entry entry{file.path(), file.last_write_time(error), 0};
+    if (error) {
+      continue;
+    }
+    entry.size = static_cast<uint64_t>(file.file_size(error));
+    if (error) {
+      continue;
+    }
+    totalSize += entry.size;
+    entries.push_back(std::move(entry));
+  }
+  if (totalSize <= sizeLimit) {
+    return;
+  }
+
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& lhs, const Entry& rhs) {
+              return lhs.lastUse < rhs.lastUse;
+            });
+  const std::filesystem::path kKeepPath(keepPath);
+  for (const auto& entry : entries) {
+    if (totalSize <= sizeLimit) {
+      break;
+    }
+    if (entry.path == kKeepPath) {
+      continue;
+    }
+    if (std::filesystem::remove(entry.path, error)) {
+      totalSize -= entry.size;
+    }
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Single writer thread publishing entries queued by SaveAsync().
+ */
+struct SceneCache::WriteQueue {
+  struct Job {
+    std::string directory;
+    std::string entryPath;
+    std::string bytes;
+    uint64_t sizeLimit{0};
+  };
+
+  ~WriteQueue() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+
+  void Push(Job&& job) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      jobs.push_back(std::move(job));
+      if (!thread.joinable()) {
+        thread = std::thread([this]() { Run(); });
+      }
+    }
+    wake.notify_one();
+  }
+
+  // Queued jobs are still written after stop is set
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+      wake.wait(lock, [this]() { return stop || !jobs.empty(); });
+      if (jobs.empty()) {
+        return;
+      }
+      Job job = std::move(jobs.front());
+      jobs.pop_front();
+      busy = true;
+      lock.unlock();
+
+      auto result = WriteEntry(job.directory, job.entryPath, job.bytes);
+      if (result.ok()) {
+        TrimEntries(job.directory, job.entryPath, job.sizeLimit);
+      }
+
+      lock.lock();
+      if (result.err() && error.empty()) {
+        error = result.error();
+      }
+      busy = false;
+      if (jobs.empty()) {
+        idle.notify_all();
+      }
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::condition_variable idle;
+  std::deque<Job> jobs;
+  bool busy{false};
+  bool stop{false};
+  std::string error;
+  std::thread thread;
+};
+
+SceneCache::SceneCache() : writeQueue_(std::make_unique<WriteQueue>()) {}
+
+SceneCache::~SceneCache() noexcept = default;
+
+SceneCache::SceneCache(SceneCache&&) noexcept = default;
+
+SceneCache& SceneCache::operator=(SceneCache&&) noexcept = default;
+
+void SceneCache::SetDirectory(std::string_view directory) {
+  directory_ = std::string(directory);
+}
+
+const std::string& SceneCache::GetDirectory() const noexcept {
+  return directory_;
+}
+
+bool SceneCache::IsEnabled() const noexcept { return !directory_.empty(); }
+
+void SceneCache::SetImportOptions(std::string_view options) {
+  importOptions_ = std::string(options);
+}
+
+const std::string& SceneCache::GetImportOptions() const noexcept {
+  return importOptions_;
+}
+
+void SceneCache::SetSizeLimit(uint64_t bytes) noexcept { sizeLimit_ = bytes; }
+
+uint64_t SceneCache::GetSizeLimit() const noexcept { return sizeLimit_; }
+
+std::string SceneCache::EntryPath(std::string_view sourcePath) const {
+  // FNV-1a of the absolute source path
+  uint64_t hash = 14695981039346656037ull;
+  for (const char kChar : AbsolutePath(sourcePath)) {
+    hash ^= static_cast<unsigned char>(kChar);
+    hash *= 1099511628211ull;
+  }
+  char name[32];
+  std::snprintf(name, sizeof(name), "%016llx.mgttscene",
+                static_cast<unsigned long long>(hash));
+  return (std::filesystem::path(directory_) / name).string();
+}
+
+Mgtt::Common::Result<std::string> SceneCache::Encode(
+    const Mgtt::Rendering::Scene& scene, std::string_view sourcePath,
+    const std::vector<std::string>& dependencies) const {
+  using EncodeResult = Mgtt::Common::Result<std::string>;
+  if (!IsEnabled()) {
+    return EncodeResult::Err("Scene cache is disabled");
+  }
+
+  const std::string kSource = AbsolutePath(sourcePath);
+  SourceStamp stamp;
+  if (!StampSource(kSource, stamp)) {
+    return EncodeResult::Err("Cannot stat scene source: " + kSource);
+  }
+  uint64_t pixelBytes = 0;
+  for (const auto& [key, texture] : scene.textureMap) {
+    if (texture.data == nullptr) {
+      return EncodeResult::Err(
+          "Texture pixels already released, save before upload: " + key);
+    }
+    pixelBytes += static_cast<uint64_t>(texture.width) *
+                  static_cast<uint64_t>(texture.height) *
+                  static_cast<uint64_t>(texture.nrComponents);
+  }
+
+  std::string bytes;
+  bytes.reserve(static_cast<size_t>(pixelBytes));
+  CacheWriter writer(bytes);
+
+  writer.Write(kCacheMagic);
+  writer.Write(kFormatVersion);
+  writer.WriteString(kSource);
+  writer.Write(stamp.modifiedTime);
+  writer.Write(stamp.size);
+
+  std::vector<std::string> dependencyPaths;
+  dependencyPaths.reserve(dependencies.size());
+  for (const auto& dependency : dependencies) {
+    dependencyPaths.push_back(AbsolutePath(dependency));
+  }
+  std::sort(dependencyPaths.begin(), dependencyPaths.end());
+  dependencyPaths.erase(
+      std::unique(dependencyPaths.begin(), dependencyPaths.end()),
+      dependencyPaths.end());
+  writer.Write<uint64_t>(dependencyPaths.size());
+  for (const auto& dependency : dependencyPaths) {
+    const SourceStamp kStamp = StampDependency(dependency);
+    writer.WriteString(dependency);
+    writer.Write(kStamp.modifiedTime);
+    writer.Write(kStamp.size);
+  }
+  writer.WriteString(importOptions_);
+  writer.Write(scene.aabb);
+
+  writer.Write<uint64_t>(scene.textureMap.size());
+  for (const auto& [key, texture] : scene.textureMap) {
+    writer.WriteString(key);
+    writer.WriteString(texture.name);
+    writer.WriteString(texture.path);
+    writer.Write(texture.width);
+    writer.Write(texture.height);
+    writer.Write(texture.nrComponents);
+    const uint64_t kByteCount = static_cast<uint64_t>(texture.width) *
+                                static_cast<uint64_t>(texture.height) *
+                                static_cast<uint64_t>(texture.nrComponents);
+    writer.WriteBytes(texture.data, kByteCount);
+  }
+
+  std::unordered_map<const Mgtt::Rendering::Mesh*, int32_t> meshIds;
+  std::vector<const Mgtt::Rendering::Mesh*> meshes;
+  for (const auto& node : scene.nodes) {
+    if (node.mesh != nullptr &&
+        meshIds
+            .try_emplace(node.mesh.get(), static_cast<int32_t>(meshes.size()))
+            .second) {
+      meshes.push_back(node.mesh.get());
+    }
+  }
+  writer.Write<uint64_t>(meshes.size());
+  for (const auto* mesh : meshes) {
+    WriteMesh(writer, *mesh);
+  }
+
+  // Parents precede children in Scene::nodes, so the flat array is written
+  // as is
+  writer.Write<uint64_t>(scene.nodes.size());
+  for (const auto& node : scene.nodes) {
+    WriteNode(writer, node, meshIds);
+  }
+  return EncodeResult::Ok(std::move(bytes));
+}
+
+Mgtt::Common::Result<void> SceneCache::Save(
+    const Mgtt::Rendering::Scene& scene, std::string_view sourcePath,
+    const std::vector<std::string>& dependencies) const {
+  auto encoded = Encode(scene, sourcePath, dependencies);
+  if (encoded.err()) {
+    return Mgtt::Common::Result<void>::Err(encoded.error());
+  }
+  const std::string kEntryPath = EntryPath(sourcePath);
+  auto result = WriteEntry(directory_, kEntryPath, encoded.value());
+  if (result.ok()) {
+    TrimEntries(directory_, kEntryPath, sizeLimit_);
+  }
+  return result;
+}
+
+Mgtt::Common::Result<void> SceneCache::SaveAsync(
+    const Mgtt::Rendering::Scene& scene, std::string_view sourcePath,
+    const std::vector<std::string>& dependencies) const {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  return Save(scene, sourcePath, dependencies);
+#else
+  // A moved-from cache has no queue left
+  if (writeQueue_ == nullptr) {
+    return Save(scene, sourcePath, dependencies);
+  }
+  auto encoded = Encode(scene, sourcePath, dependencies);
+  if (encoded.err()) {
+    return Mgtt::Common::Result<void>::Err(encoded.error());
+  }
+  writeQueue_->Push({directory_, EntryPath(sourcePath),
+                     std::move(encoded.value()), sizeLimit_});
+  return Mgtt::Common::Result<void>::Ok();
+#endif
+}
+
+Mgtt::Common::Result<void> SceneCache::Flush() const {
+  if (writeQueue_ == nullptr) {
+    return Mgtt::Common::Result<void>::Ok();
+  }
+  std::unique_lock<std::mutex> lock(writeQueue_->mutex);
+  writeQueue_->idle.wait(lock, [this]() {
+    return writeQueue_->jobs.empty() && !writeQueue_->busy;
+  });
+  if (writeQueue_->error.empty()) {
+    return Mgtt::Common::Result<void>::Ok();
+  }
+  return Mgtt::Common::Result<void>::Err(
+      std::exchange(writeQueue_->error, std::string()));
+}
+
+Mgtt::Common::Result<void> SceneCache::Load(Mgtt::Rendering::Scene& scene,
+                                            std::string_view sourcePath) const {
+  if (!IsEnabled()) {
+    return Mgtt::Common::Result<void>::Err("Scene cache is disabled");
+  }
+
+  const std::string kSource = AbsolutePath(sourcePath);
+  SourceStamp stamp;
+  if (!StampSource(kSource, stamp)) {
+    return Mgtt::Common::Result<void>::Err("Cannot stat scene source: " +
+                                           kSource);
+  }
+
+  Mgtt::Rendering::MappedFile entry;
+  const std::string kEntryPath = EntryPath(sourcePath);
+  if (auto result = entry.Open(kEntryPath); result.err()) {
+    return result;
+  }
+  CacheReader reader(entry.Data(), entry.Size());
+
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  std::string source;
+  SourceStamp entryStamp;
+  uint64_t dependencyCount = 0;
+  std::string importOptions;
+  auto stale = [&]() {
+    return Mgtt::Common::Result<void>::Err("Stale scene cache entry for " +
+                                           kSource);
+  };
+  if (!reader.Read(magic) || magic != kCacheMagic || !reader.Read(version) ||
+      version != kFormatVersion || !reader.ReadString(source) ||
+      source != kSource || !reader.Read(entryStamp.modifiedTime) ||
+      !reader.Read(entryStamp.size) || !(entryStamp == stamp) ||
+      !reader.Read(dependencyCount)) {
+    return stale();
+  }
+  for (uint64_t idx = 0; idx < dependencyCount; ++idx) {
+    std::string dependency;
+    SourceStamp dependencyStamp;
+    if (!reader.ReadString(dependency) ||
+        !reader.Read(dependencyStamp.modifiedTime) ||
+        !reader.Read(dependencyStamp.size) ||
+        !(StampDependency(dependency) == dependencyStamp)) {
+      return stale();
+    }
+  }
+  if (!reader.ReadString(importOptions) || importOptions != importOptions_) {
+    return stale();
+  }
+
+  std::map<std::string, Mgtt::Rendering::Texture> textureMap;
+  auto corrupt = [&]() {
+    for (auto& [key, texture] : textureMap) {
+      std::free(texture.data);
+    }
+    return Mgtt::Common::Result<void>::Err("Corrupt scene cache entry for " +
+                                           kSource);
+  };
+
+  Mgtt::Rendering::AABB aabb;
+  uint64_t textureCount = 0;
+  if (!reader.Read(aabb) || !reader.Read(textureCount)) {
+    return corrupt();
+  }
+  for (uint64_t idx = 0; idx < textureCount; ++idx) {
+    std::string key;
+    Mgtt::Rendering::Texture texture;
+    uint64_t byteCount = 0;
+    if (!reader.ReadString(key) || !reader.ReadString(texture.name) ||
+        !reader.ReadString(texture.path) || !reader.Read(texture.width) ||
+        !reader.Read(texture.height) || !reader.Read(texture.nrComponents) ||
+        !reader.Read(byteCount) || texture.width <= 0 ||
+        texture.height <= 0 || texture.nrComponents <= 0 ||
+        byteCount != static_cast<uint64_t>(texture.width) *
+                         static_cast<uint64_t>(texture.height) *
+                         static_cast<uint64_t>(texture.nrComponents)) {
+      return corrupt();
+    }
+    const unsigned char* pixels = reader.Take(byteCount);
+    if (pixels == nullptr) {
+      return corrupt();
+    }
+    // malloc matches the stbi_image_free() the uploader releases pixels with
+    texture.data = static_cast<unsigned char*>(
+        std::malloc(static_cast<size_t>(byteCount)));
+    if (texture.data == nullptr) {
+      return corrupt();
+    }
+    std::memcpy(texture.data, pixels, static_cast<size_t>(byteCount));
+    textureMap[key] = std::move(texture);
+  }
+
+  TexturesByPath texturesByPath;
+  for (const auto& [key, texture] : textureMap) {
+    texturesByPath.emplace(texture.path, &texture);
+  }
+
+  uint64_t meshCount = 0;
+  if (!reader.Read(meshCount)) {
+    return corrupt();
+  }
+  std::vector<std::shared_ptr<Mgtt::Rendering::Mesh>> meshes;
+  for (uint64_t idx = 0; idx < meshCount; ++idx) {
+    auto mesh = std::make_shared<Mgtt::Rendering::Mesh>();
+    if (!ReadMesh(reader, texturesByPath, *mesh)) {
+      return corrupt();
+    }
+    meshes.push_back(std::move(mesh));
+  }
+
+  uint64_t nodeCount = 0;
+  if (!reader.Read(nodeCount) ||
+      nodeCount >= Mgtt::Rendering::Node::kNoParent) {
+    return corrupt();
+  }
+  std::vector<Mgtt::Rendering::Node> nodes;
+  std::vector<uint32_t> rootNodes;
+  for (uint64_t idx = 0; idx < nodeCount; ++idx) {
+    if (!ReadNode(reader, meshes, nodes, rootNodes)) {
+      return corrupt();
+    }
+  }
+
+  scene.path = std::string(sourcePath);
+  scene.aabb = aabb;
+  scene.textureMap = std::move(textureMap);
+  scene.nodes = std::move(nodes);
+  scene.rootNodes = std::move(rootNodes);
+
+  // Mark the entry as most recently used for TrimEntries()
+  std::error_code error;
+  std::filesystem::last_write_time(
+      kEntryPath, std::filesystem::file_time_type::clock::now(), error);
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+}  // namespace Mgtt::Rendering
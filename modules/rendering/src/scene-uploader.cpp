@@ -23,35 +23,183 @@
 #include <scene-uploader.h>
 #include <utils.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <iostream>
 #include <map>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace Mgtt::Rendering {
 
 Mgtt::Common::Result<void> SceneUploader::Upload(
     Mgtt::Rendering::Scene& scene) {
-  // Upload textures to GPU and record their GL ids in the textureMap
-  for (auto& [uri, texture] : scene.textureMap) {
-    UploadTexture(texture);
+  BeginUpload(scene);
+  if (auto result = UploadStep(scene, UploadBudget{}); result.err()) {
+    return Mgtt::Common::Result<void>::Err(result.error());
+  }
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+void SceneUploader::BeginUpload(Mgtt::Rendering::Scene& scene) {
+  pendingTasks_.clear();
+  pendingBytes_ = 0;
+
+  // Group the nodes by mesh; every mesh is uploaded once together with the
+  // world matrices of all nodes that reference it
+  scene.instanceBatches.clear();
+  scene.sharedGeometry.Clear();
+  std::unordered_map<const Mgtt::Rendering::Mesh*, size_t> batchIndices;
+  CollectInstances(scene, scene.instanceBatches, batchIndices);
+  if (sharedBuffers_ && !scene.instanceBatches.empty()) {
+    AllocateSharedGeometry(scene);
+  }
+
+  auto queue = [&](UploadTask task) {
+    pendingBytes_ += task.bytes;
+    pendingTasks_.push_back(std::move(task));
+  };
+
+  // Materials reference textures by path, the textureMap is keyed by uri
+  std::unordered_map<std::string, std::string> keysByPath;
+  for (const auto& [key, texture] : scene.textureMap) {
+    if (texture.data != nullptr) {
+      keysByPath.try_emplace(texture.path, key);
+    }
+  }
+  std::unordered_set<std::string> queuedKeys;
+  auto queueTexture = [&](const Mgtt::Rendering::Texture& materialTexture) {
+    auto iter = keysByPath.find(materialTexture.path);
+    if (iter == keysByPath.end() || !queuedKeys.insert(iter->second).second) {
+      return;
+    }
+    const auto& texture = scene.textureMap.at(iter->second);
+    queue({iter->second, 0,
+           static_cast<size_t>(texture.width) *
+               static_cast<size_t>(texture.height) *
+               static_cast<size_t>(texture.nrComponents)});
+  };
+
+  for (size_t idx = 0; idx < scene.instanceBatches.size(); ++idx) {
+    const auto& mesh = *scene.instanceBatches[idx].mesh;
+    for (const auto& prim : mesh.meshPrimitives) {
+      const auto& mat = prim.pbrMaterial;
+      queueTexture(mat.baseColorTexture);
+      queueTexture(mat.metallicRoughnessTexture);
+      queueTexture(mat.normalTexture);
+      queueTexture(mat.emissiveTexture);
+      queueTexture(mat.occlusionTexture);
+    }
+    const size_t kVertexBytes =
+        packedVertices_
+            ? mesh.vertexPositionAttribs.size() *
+                  sizeof(Mgtt::Rendering::PackedVertex)
+            : mesh.vertexPositionAttribs.size() * sizeof(glm::vec3) +
+                  mesh.vertexNormalAttribs.size() * sizeof(glm::vec3) +
+                  mesh.vertexTextureAttribs.size() * sizeof(glm::vec2) +
+                  mesh.vertexPositionAttribs.size() * sizeof(glm::vec4);
+    const size_t kIndexBytes =
+        mesh.indices.size() *
+        GetIndexSize(SelectIndexType(mesh.indices,
+                                     mesh.vertexPositionAttribs.size()));
+    queue({"", idx,
+           kIndexBytes + kVertexBytes +
+               scene.instanceBatches[idx].instanceMatrices.size() *
+                   sizeof(glm::mat4)});
   }
 
-  // Patch material texture ids from the map back into each primitive's
-  // PbrMaterial. LoadMaterials copies textures by value, so the id written
-  // into the map during upload is not reflected in the material copies.
-  for (auto& node : scene.nodes) {
-    PatchMaterialIds(node, scene.textureMap);
+  // Textures no material uses are still uploaded, which frees their pixels
+  for (const auto& [key, texture] : scene.textureMap) {
+    if (texture.data != nullptr && queuedKeys.count(key) == 0) {
+      queue({key, 0,
+             static_cast<size_t>(texture.width) *
+                 static_cast<size_t>(texture.height) *
+                 static_cast<size_t>(texture.nrComponents)});
+    }
   }
+}
+
+Mgtt::Common::Result<bool> SceneUploader::UploadStep(
+    Mgtt::Rendering::Scene& scene, const UploadBudget& budget) {
+  const auto kStart = std::chrono::steady_clock::now();
+  size_t uploadedBytes = 0;
+
+  while (!pendingTasks_.empty()) {
+    if (budget.bytes > 0 && uploadedBytes > 0 &&
+        uploadedBytes + pendingTasks_.front().bytes > budget.bytes) {
+      break;
+    }
+    const UploadTask kTask = std::move(pendingTasks_.front());
+    pendingTasks_.pop_front();
+    pendingBytes_ -= kTask.bytes;
+    uploadedBytes += kTask.bytes;
 
-  // Upload meshes
-  for (auto& node : scene.nodes) {
-    if (auto r = UploadNode(node, scene.shader.GetProgramId()); r.err()) {
-      return r;
+    if (!kTask.textureKey.empty()) {
+      if (auto iter = scene.textureMap.find(kTask.textureKey);
+          iter != scene.textureMap.end()) {
+        UploadTexture(iter->second);
+      }
+    } else {
+      if (kTask.batchIndex >= scene.instanceBatches.size()) {
+        pendingTasks_.clear();
+        pendingBytes_ = 0;
+        return Mgtt::Common::Result<bool>::Err(
+            "Instance batches changed during an incremental upload");
+      }
+      auto& batch = scene.instanceBatches[kTask.batchIndex];
+      // The textures of this batch were queued ahead of it
+      PatchMaterialIds(*batch.mesh, scene.textureMap);
+      auto result =
+          scene.sharedGeometry.vao > 0
+              ? UploadSharedMesh(scene, batch)
+              : UploadMesh(batch.mesh, scene.shader.GetProgramId());
+      if (result.err()) {
+        pendingTasks_.clear();
+        pendingBytes_ = 0;
+        return Mgtt::Common::Result<bool>::Err(result.error());
+      }
+      if (scene.sharedGeometry.vao == 0) {
+        UploadInstanceBuffer(batch, scene.shader.GetProgramId());
+      }
+    }
+
+    if (budget.time.count() > 0 &&
+        std::chrono::steady_clock::now() - kStart >= budget.time) {
+      break;
     }
   }
 
+  if (!pendingTasks_.empty()) {
+    return Mgtt::Common::Result<bool>::Ok(false);
+  }
   std::cout << "Scene uploaded to GPU: " << scene.path << '\n';
-  return Mgtt::Common::Result<void>::Ok();
+  return Mgtt::Common::Result<bool>::Ok(true);
+}
+
+void SceneUploader::SetPackedVertices(bool enabled) noexcept {
+  packedVertices_ = enabled;
+}
+
+bool SceneUploader::IsPackedVertices() const noexcept {
+  return packedVertices_;
+}
+
+void SceneUploader::SetSharedBuffers(bool enabled) noexcept {
+  sharedBuffers_ = enabled;
+}
+
+bool SceneUploader::IsSharedBuffers() const noexcept { return sharedBuffers_; }
+
+bool SceneUploader::IsUploading() const noexcept {
+  return !pendingTasks_.empty();
+}
+
+size_t SceneUploader::GetPendingBytes() const noexcept {
+  return pendingBytes_;
 }
 
 void SceneUploader::UploadTexture(Mgtt::Rendering::Texture& texture) {
@@ -95,7 +243,7 @@ Mgtt::Common::Result<void> SceneUploader::UploadMesh(
     return Mgtt::Common::Result<void>::Ok();
   }
   if (HasValuesGreaterThanZero(
-          {mesh->ebo, mesh->pos, mesh->normal, mesh->tex})) {
+          {mesh->ebo, mesh->pos, mesh->normal, mesh->tex, mesh->tangent})) {
     return Mgtt::Common::Result<void>::Err(
         "Mesh GL buffers must be 0 before UploadMesh (already uploaded?)");
   }
@@ -106,16 +254,22 @@ Mgtt::Common::Result<void> SceneUploader::UploadMesh(
 
   glGenVertexArrays(1, &mesh->vao);
   glGenBuffers(1, &mesh->pos);
-  glGenBuffers(1, &mesh->normal);
-  glGenBuffers(1, &mesh->tex);
+  if (!packedVertices_) {
+    glGenBuffers(1, &mesh->normal);
+    glGenBuffers(1, &mesh->tex);
+    glGenBuffers(1, &mesh->tangent);
+  }
   glGenBuffers(1, &mesh->ebo);
 
   glBindVertexArray(mesh->vao);
 
+  const Mgtt::Rendering::IndexBuffer kIndexBuffer(
+      mesh->indices, mesh->vertexPositionAttribs.size());
+  mesh->indexType = kIndexBuffer.type;
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->ebo);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-               static_cast<GLsizeiptr>(mesh->indices.size() * sizeof(uint32_t)),
-               mesh->indices.data(), GL_STATIC_DRAW);
+               static_cast<GLsizeiptr>(kIndexBuffer.GetByteSize()),
+               kIndexBuffer.GetData(), GL_STATIC_DRAW);
 
   auto uploadAttrib = [&](uint32_t buf, auto& attribs, const char* attrName,
                           GLint components) {
@@ -124,16 +278,42 @@ Mgtt::Common::Result<void> SceneUploader::UploadMesh(
     glBufferData(GL_ARRAY_BUFFER,
                  static_cast<GLsizeiptr>(attribs.size() * sizeof(T)),
                  attribs.data(), GL_STATIC_DRAW);
-    const uint32_t kLoc = glGetAttribLocation(shaderId, attrName);
+    const GLint kLoc = glGetAttribLocation(shaderId, attrName);
+    if (kLoc < 0) {
+      return;
+    }
     glEnableVertexAttribArray(kLoc);
     glVertexAttribPointer(kLoc, components, GL_FLOAT, GL_FALSE, sizeof(T),
                           nullptr);
   };
 
-  uploadAttrib(mesh->pos, mesh->vertexPositionAttribs, "inVertexPosition", 3);
-  uploadAttrib(mesh->normal, mesh->vertexNormalAttribs, "inVertexNormal", 3);
-  uploadAttrib(mesh->tex, mesh->vertexTextureAttribs,
-               "inVertexTextureCoordinates", 2);
+  if (packedVertices_) {
+    const auto kPacked =
+        PackVertices(*mesh, mesh->positionOffset, mesh->positionScale);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->pos);
+    glBufferData(GL_ARRAY_BUFFER,
+                 static_cast<GLsizeiptr>(kPacked.size() *
+                                         sizeof(Mgtt::Rendering::PackedVertex)),
+                 kPacked.data(), GL_STATIC_DRAW);
+    SetPackedAttribPointers(shaderId);
+    mesh->packedVertices = true;
+  } else {
+    uploadAttrib(mesh->pos, mesh->vertexPositionAttribs, "inVertexPosition",
+                 3);
+    uploadAttrib(mesh->normal, mesh->vertexNormalAttribs, "inVertexNormal", 3);
+    uploadAttrib(mesh->tex, mesh->vertexTextureAttribs,
+                 "inVertexTextureCoordinates", 2);
+    // Zero tangents select the shader's derivative-based normal mapping
+    const std::vector<glm::vec4> kNoTangents(
+        mesh->vertexTangentAttribs.empty() ? mesh->vertexPositionAttribs.size()
+                                           : 0,
+        glm::vec4(0.0f));
+    uploadAttrib(mesh->tangent,
+                 mesh->vertexTangentAttribs.empty()
+                     ? kNoTangents
+                     : mesh->vertexTangentAttribs,
+                 "inVertexTangent", 4);
+  }
 
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->ebo);
   glBindVertexArray(0);
@@ -141,24 +321,321 @@ Mgtt::Common::Result<void> SceneUploader::UploadMesh(
   return Mgtt::Common::Result<void>::Ok();
 }
 
-Mgtt::Common::Result<void> SceneUploader::UploadNode(
-    const std::shared_ptr<Mgtt::Rendering::Node>& node, uint32_t shaderId) {
-  if (node->mesh != nullptr) {
-    if (auto r = UploadMesh(node->mesh, shaderId); r.err()) {
-      return r;
+void SceneUploader::SetPackedAttribPointers(uint32_t shaderId) {
+  using Mgtt::Rendering::PackedVertex;
+  auto attrib = [&](const char* attrName, GLint components, GLenum type,
+                    GLboolean normalized, size_t offset) {
+    const GLint kLoc = glGetAttribLocation(shaderId, attrName);
+    if (kLoc < 0) {
+      return;
+    }
+    glEnableVertexAttribArray(kLoc);
+    glVertexAttribPointer(kLoc, components, type, normalized,
+                          sizeof(PackedVertex),
+                          // NOLINTNEXTLINE(performance-no-int-to-ptr)
+                          reinterpret_cast<const void*>(offset));
+  };
+
+  attrib("inVertexPosition", 3, GL_SHORT, GL_TRUE,
+         offsetof(PackedVertex, position));
+  // Packed 2_10_10_10 attributes always have four components
+  attrib("inVertexNormal", 4, GL_INT_2_10_10_10_REV, GL_TRUE,
+         offsetof(PackedVertex, normal));
+  attrib("inVertexTextureCoordinates", 2, GL_HALF_FLOAT, GL_FALSE,
+         offsetof(PackedVertex, textureCoordinates));
+  attrib("inVertexTangent", 4, GL_INT_2_10_10_10_REV, GL_TRUE,
+         offsetof(PackedVertex, tangent));
+}
+
+void SceneUploader::AllocateSharedGeometry(Mgtt::Rendering::Scene& scene) {
+  size_t vertexCount = 0;
+  size_t indexBytes = 0;
+  size_t instanceCount = 0;
+  for (auto& batch : scene.instanceBatches) {
+    auto& mesh = *batch.mesh;
+    const size_t kMeshVertexCount = mesh.vertexPositionAttribs.size();
+#ifdef __EMSCRIPTEN__
+    // Rebased indices address the whole range up to the mesh's last vertex
+    mesh.indexType = SelectIndexType(mesh.indices, kMeshVertexCount,
+                                     static_cast<uint32_t>(vertexCount));
+#else
+    mesh.indexType = SelectIndexType(mesh.indices, kMeshVertexCount);
+#endif
+    // Ranges of both index types start on a 4-byte boundary
+    indexBytes = (indexBytes + 3) & ~size_t{3};
+    mesh.baseVertex = static_cast<int32_t>(vertexCount);
+    mesh.baseIndex =
+        static_cast<uint32_t>(indexBytes / GetIndexSize(mesh.indexType));
+    batch.firstInstance = static_cast<uint32_t>(instanceCount);
+    vertexCount += kMeshVertexCount;
+    indexBytes += mesh.indices.size() * GetIndexSize(mesh.indexType);
+    instanceCount += batch.instanceMatrices.size();
+  }
+
+  const uint32_t kShaderId = scene.shader.GetProgramId();
+  auto& geometry = scene.sharedGeometry;
+  geometry.packedVertices = packedVertices_;
+  glGenVertexArrays(1, &geometry.vao);
+  glGenBuffers(1, &geometry.pos);
+  if (!geometry.packedVertices) {
+    glGenBuffers(1, &geometry.normal);
+    glGenBuffers(1, &geometry.tex);
+    glGenBuffers(1, &geometry.tangent);
+  }
+  glGenBuffers(1, &geometry.ebo);
+  glGenBuffers(1, &geometry.instanceVbo);
+
+  glBindVertexArray(geometry.vao);
+
+  // Storage only; every mesh writes its own range when it is uploaded
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry.ebo);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+               static_cast<GLsizeiptr>(indexBytes), nullptr, GL_STATIC_DRAW);
+
+  auto allocAttrib = [&](uint32_t buf, size_t elementSize,
+                         const char* attrName, GLint components) {
+    glBindBuffer(GL_ARRAY_BUFFER, buf);
+    glBufferData(GL_ARRAY_BUFFER,
+                 static_cast<GLsizeiptr>(vertexCount * elementSize), nullptr,
+                 GL_STATIC_DRAW);
+    const GLint kLoc = glGetAttribLocation(kShaderId, attrName);
+    if (kLoc < 0) {
+      return;
     }
+    glEnableVertexAttribArray(kLoc);
+    glVertexAttribPointer(kLoc, components, GL_FLOAT, GL_FALSE,
+                          static_cast<GLsizei>(elementSize), nullptr);
+  };
+
+  if (geometry.packedVertices) {
+    glBindBuffer(GL_ARRAY_BUFFER, geometry.pos);
+    glBufferData(GL_ARRAY_BUFFER,
+                 static_cast<GLsizeiptr>(vertexCount *
+                                         sizeof(Mgtt::Rendering::PackedVertex)),
+                 nullptr, GL_STATIC_DRAW);
+    SetPackedAttribPointers(kShaderId);
+  } else {
+    allocAttrib(geometry.pos, sizeof(glm::vec3), "inVertexPosition", 3);
+    allocAttrib(geometry.normal, sizeof(glm::vec3), "inVertexNormal", 3);
+    allocAttrib(geometry.tex, sizeof(glm::vec2), "inVertexTextureCoordinates",
+                2);
+    allocAttrib(geometry.tangent, sizeof(glm::vec4), "inVertexTangent", 4);
   }
-  for (auto& child : node->children) {
-    if (auto r = UploadNode(child, shaderId); r.err()) {
-      return r;
+
+  glBindBuffer(GL_ARRAY_BUFFER, geometry.instanceVbo);
+  glBufferData(GL_ARRAY_BUFFER,
+               static_cast<GLsizeiptr>(instanceCount * sizeof(glm::mat4)),
+               nullptr, GL_STATIC_DRAW);
+  geometry.instanceLocation =
+      glGetAttribLocation(kShaderId, "inInstanceMatrix");
+  if (geometry.instanceLocation >= 0) {
+    // Points at the first batch; the renderer moves it to each batch's range
+    for (uint32_t column = 0; column < 4; ++column) {
+      const uint32_t kColumnLoc =
+          static_cast<uint32_t>(geometry.instanceLocation) + column;
+      glEnableVertexAttribArray(kColumnLoc);
+      glVertexAttribPointer(
+          kColumnLoc, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+          // NOLINTNEXTLINE(performance-no-int-to-ptr)
+          reinterpret_cast<const void*>(column * sizeof(glm::vec4)));
+      glVertexAttribDivisor(kColumnLoc, 1);
     }
   }
+  glBindVertexArray(0);
+}
+
+Mgtt::Common::Result<void> SceneUploader::UploadSharedMesh(
+    Mgtt::Rendering::Scene& scene, Mgtt::Rendering::InstanceBatch& batch) {
+  auto& mesh = *batch.mesh;
+  const auto& geometry = scene.sharedGeometry;
+  if (mesh.vao > 0) {
+    return Mgtt::Common::Result<void>::Err(
+        "Mesh GL buffers must be 0 before UploadSharedMesh (already "
+        "uploaded?)");
+  }
+  if (mesh.vertexPositionAttribs.empty()) {
+    return Mgtt::Common::Result<void>::Err(
+        "Mesh has no vertex position attributes");
+  }
+
+  const size_t kVertexCount = mesh.vertexPositionAttribs.size();
+  const auto kBaseVertex = static_cast<size_t>(mesh.baseVertex);
+#ifdef __EMSCRIPTEN__
+  // WebGL 2 has no base-vertex draws, so the indices are rebased instead
+  const Mgtt::Rendering::IndexBuffer kIndexBuffer(
+      mesh.indices, kVertexCount, static_cast<uint32_t>(kBaseVertex));
+#else
+  const Mgtt::Rendering::IndexBuffer kIndexBuffer(mesh.indices, kVertexCount);
+#endif
+  if (kIndexBuffer.type != mesh.indexType) {
+    return Mgtt::Common::Result<void>::Err(
+        "Mesh index type changed since shared buffers were allocated");
+  }
+
+  auto writeAttrib = [&](uint32_t buf, const auto& attribs) {
+    using T = typename std::decay_t<decltype(attribs)>::value_type;
+    glBindBuffer(GL_ARRAY_BUFFER, buf);
+    glBufferSubData(
+        GL_ARRAY_BUFFER, static_cast<GLintptr>(kBaseVertex * sizeof(T)),
+        static_cast<GLsizeiptr>(std::min(attribs.size(), kVertexCount) *
+                                sizeof(T)),
+        attribs.data());
+  };
+  if (geometry.packedVertices) {
+    writeAttrib(geometry.pos,
+                PackVertices(mesh, mesh.positionOffset, mesh.positionScale));
+    mesh.packedVertices = true;
+  } else {
+    writeAttrib(geometry.pos, mesh.vertexPositionAttribs);
+    writeAttrib(geometry.normal, mesh.vertexNormalAttribs);
+    writeAttrib(geometry.tex, mesh.vertexTextureAttribs);
+    // The shared range is uninitialized, so missing tangents write zeros
+    writeAttrib(geometry.tangent,
+                mesh.vertexTangentAttribs.empty()
+                    ? std::vector<glm::vec4>(kVertexCount, glm::vec4(0.0f))
+                    : mesh.vertexTangentAttribs);
+  }
+
+  glBindBuffer(GL_ARRAY_BUFFER, geometry.instanceVbo);
+  glBufferSubData(
+      GL_ARRAY_BUFFER,
+      static_cast<GLintptr>(batch.firstInstance * sizeof(glm::mat4)),
+      static_cast<GLsizeiptr>(batch.instanceMatrices.size() *
+                              sizeof(glm::mat4)),
+      batch.instanceMatrices.data());
+
+  // The element buffer binding is VAO state, so write it through the VAO
+  glBindVertexArray(geometry.vao);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry.ebo);
+#ifdef __EMSCRIPTEN__
+  mesh.baseVertex = 0;
+#endif
+  glBufferSubData(
+      GL_ELEMENT_ARRAY_BUFFER,
+      static_cast<GLintptr>(mesh.baseIndex * GetIndexSize(mesh.indexType)),
+      static_cast<GLsizeiptr>(kIndexBuffer.GetByteSize()),
+      kIndexBuffer.GetData());
+  glBindVertexArray(0);
+
+  mesh.vao = geometry.vao;
+  mesh.ebo = geometry.ebo;
+  mesh.pos = geometry.pos;
+  mesh.normal = geometry.normal;
+  mesh.tex = geometry.tex;
+  mesh.tangent = geometry.tangent;
+  mesh.sharedBuffers = true;
   return Mgtt::Common::Result<void>::Ok();
 }
 
+void SceneUploader::UploadInstanceBuffer(
+    Mgtt::Rendering::InstanceBatch& batch, uint32_t shaderId) {
+  glGenBuffers(1, &batch.instanceVbo);
+
+  glBindVertexArray(batch.mesh->vao);
+  glBindBuffer(GL_ARRAY_BUFFER, batch.instanceVbo);
+  glBufferData(GL_ARRAY_BUFFER,
+               static_cast<GLsizeiptr>(batch.instanceMatrices.size() *
+                                       sizeof(glm::mat4)),
+               batch.instanceMatrices.data(), GL_STATIC_DRAW);
+
+  // Shaders without instancing support simply do not declare the attribute
+  const GLint kLoc = glGetAttribLocation(shaderId, "inInstanceMatrix");
+  if (kLoc >= 0) {
+    // A mat4 attribute occupies four consecutive vec4 locations
+    for (uint32_t column = 0; column < 4; ++column) {
+      const uint32_t kColumnLoc = static_cast<uint32_t>(kLoc) + column;
+      glEnableVertexAttribArray(kColumnLoc);
+      glVertexAttribPointer(
+          kColumnLoc, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+          // NOLINTNEXTLINE(performance-no-int-to-ptr)
+          reinterpret_cast<const void*>(column * sizeof(glm::vec4)));
+      glVertexAttribDivisor(kColumnLoc, 1);
+    }
+  }
+  glBindVertexArray(0);
+}
+
+void SceneUploader::UpdateInstanceMatrices(Mgtt::Rendering::Scene& scene) {
+  std::unordered_map<const Mgtt::Rendering::Mesh*,
+                     Mgtt::Rendering::InstanceBatch*>
+      batches;
+  for (auto& batch : scene.instanceBatches) {
+    batch.instanceMatrices.clear();
+    batches.emplace(batch.mesh.get(), &batch);
+  }
+  // Slots are in the same pre-order CollectInstances() walks
+  for (size_t slot = 0; slot < scene.transforms.Size(); ++slot) {
+    const auto& node = scene.nodes[scene.transforms.GetNodeIndex(slot)];
+    const auto kIter = node.mesh != nullptr ? batches.find(node.mesh.get())
+                                            : batches.end();
+    if (kIter == batches.end()) {
+      continue;
+    }
+    auto& matrices = kIter->second->instanceMatrices;
+    if (node.instanceMatrices.empty()) {
+      matrices.push_back(node.worldMatrix);
+    } else {
+      for (const auto& instanceMatrix : node.instanceMatrices) {
+        matrices.push_back(node.worldMatrix * instanceMatrix);
+      }
+    }
+  }
+
+  for (const auto& batch : scene.instanceBatches) {
+    const bool kShared = batch.instanceVbo == 0;
+    const uint32_t kBuffer =
+        kShared ? scene.sharedGeometry.instanceVbo : batch.instanceVbo;
+    if (kBuffer == 0 || batch.mesh->vao == 0) {
+      continue;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, kBuffer);
+    glBufferSubData(
+        GL_ARRAY_BUFFER,
+        static_cast<GLintptr>(
+            kShared ? batch.firstInstance * sizeof(glm::mat4) : 0),
+        static_cast<GLsizeiptr>(batch.instanceMatrices.size() *
+                                sizeof(glm::mat4)),
+        batch.instanceMatrices.data());
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void SceneUploader::CollectInstances(
+    const Mgtt::Rendering::Scene& scene,
+    std::vector<Mgtt::Rendering::InstanceBatch>& batches,
+    std::unordered_map<const Mgtt::Rendering::Mesh*, size_t>& batchIndices) {
+  // Pre-order like Scene::transforms, so UpdateInstanceMatrices() refills the
+  // batches in the same order
+  std::vector<uint32_t> stack(scene.rootNodes.rbegin(),
+                              scene.rootNodes.rend());
+  while (!stack.empty()) {
+    const auto& node = scene.nodes[stack.back()];
+    stack.pop_back();
+    stack.insert(stack.end(), node.children.rbegin(), node.children.rend());
+    if (node.mesh == nullptr) {
+      continue;
+    }
+    auto [iter, inserted] =
+        batchIndices.try_emplace(node.mesh.get(), batches.size());
+    if (inserted) {
+      batches.emplace_back().mesh = node.mesh;
+    }
+    auto& matrices = batches[iter->second].instanceMatrices;
+    if (node.instanceMatrices.empty()) {
+      matrices.push_back(node.worldMatrix);
+    } else {
+      for (const auto& instanceMatrix : node.instanceMatrices) {
+        matrices.push_back(node.worldMatrix * instanceMatrix);
+      }
+    }
+  }
+}
+
 void SceneUploader::PatchMaterialIds(
-    const std::shared_ptr<Mgtt::Rendering::Node>& node,
+    Mgtt::Rendering::Mesh& mesh,
     const std::map<std::string, Mgtt::Rendering::Texture>& textureMap) {
+  // LoadMaterials copies textures by value, so the id written into the map
+  // during upload is not reflected in the material copies
   auto patchTex = [&](Mgtt::Rendering::Texture& tex) {
     if (tex.id == 0 && !tex.path.empty()) {
       // path is "folder/uri" — find the matching map entry by path suffix
@@ -171,19 +648,13 @@ void SceneUploader::PatchMaterialIds(
     }
   };
 
-  if (node->mesh != nullptr) {
-    for (auto& prim : node->mesh->meshPrimitives) {
-      auto& mat = prim.pbrMaterial;
-      patchTex(mat.baseColorTexture);
-      patchTex(mat.metallicRoughnessTexture);
-      patchTex(mat.normalTexture);
-      patchTex(mat.emissiveTexture);
-      patchTex(mat.occlusionTexture);
-    }
-  }
-
-  for (const auto& child : node->children) {
-    PatchMaterialIds(child, textureMap);
+  for (auto& prim : mesh.meshPrimitives) {
+    auto& mat = prim.pbrMaterial;
+    patchTex(mat.baseColorTexture);
+    patchTex(mat.metallicRoughnessTexture);
+    patchTex(mat.normalTexture);
+    patchTex(mat.emissiveTexture);
+    patchTex(mat.occlusionTexture);
   }
 }
 
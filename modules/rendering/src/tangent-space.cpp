@@ -0,0 +1,484 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <tangent-space.h>
+#include <worker-pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MGTT_TANGENT_SPACE_SSE2
+#endif
+
+namespace Mgtt::Rendering {
+
+namespace {
+
+/**
+ * @brief Primitives of one mesh whose vertex ranges overlap. Items never
+ * share vertices, so they can be processed concurrently.
+ */
+struct WorkItem {
+  Mgtt::Rendering::Mesh* mesh{nullptr};
+  std::vector<const Mgtt::Rendering::MeshPrimitive*> primitives;
+  uint32_t firstVertex{0};
+  uint32_t lastVertex{0};
+};
+
+/**
+ * @brief Normal, tangent and bitangent of up to four faces, each scaled by
+ * twice the face area, stored per component.
+ */
+struct FaceBatch {
+  alignas(16) float normal[3][4];
+  alignas(16) float tangent[3][4];
+  alignas(16) float bitangent[3][4];
+};
+
+glm::vec2 TextureAt(const Mgtt::Rendering::Mesh& mesh, uint32_t vertex) {
+  return mesh.vertexTextureAttribs.empty() ? glm::vec2(0.0f)
+                                           : mesh.vertexTextureAttribs[vertex];
+}
+
+void ComputeFace(const Mgtt::Rendering::Mesh& mesh, const uint32_t* tri,
+                 FaceBatch& out, size_t lane) {
+  const glm::vec3& kP0 = mesh.vertexPositionAttribs[tri[0]];
+  const glm::vec3 kE1 = mesh.vertexPositionAttribs[tri[1]] - kP0;
+  const glm::vec3 kE2 = mesh.vertexPositionAttribs[tri[2]] - kP0;
+  const glm::vec2 kT0 = TextureAt(mesh, tri[0]);
+  const glm::vec2 kD1 = TextureAt(mesh, tri[1]) - kT0;
+  const glm::vec2 kD2 = TextureAt(mesh, tri[2]) - kT0;
+
+  const glm::vec3 kNormal = glm::cross(kE1, kE2);
+  const float kArea = glm::length(kNormal);
+  const float kDet = kD1.x * kD2.y - kD2.x * kD1.y;
+  const float kSign = std::copysign(1.0f, kDet);
+  glm::vec3 tangent = kE1 * kD2.y - kE2 * kD1.y;
+  glm::vec3 bitangent = kE2 * kD1.x - kE1 * kD2.x;
+  const float kTangentLength = glm::length(tangent);
+  const float kBitangentLength = glm::length(bitangent);
+  tangent = kDet != 0.0f && kTangentLength > 0.0f
+                ? tangent * (kSign * kArea / kTangentLength)
+                : glm::vec3(0.0f);
+  bitangent = kDet != 0.0f && kBitangentLength > 0.0f
+                  ? bitangent * (kSign * kArea / kBitangentLength)
+                  : glm::vec3(0.0f);
+  for (int axis = 0; axis < 3; ++axis) {
+    out.normal[axis][lane] = kNormal[axis];
+    out.tangent[axis][lane] = tangent[axis];
+    out.bitangent[axis][lane] = bitangent[axis];
+  }
+}
+
+#ifdef MGTT_TANGENT_SPACE_SSE2
+/**
+ * @brief ComputeFace() for four consecutive triangles at once.
+ */
+void ComputeFaces4(const Mgtt::Rendering::Mesh& mesh, const uint32_t* tris,
+                   FaceBatch& out) {
+  const auto& positions = mesh.vertexPositionAttribs;
+  auto position = [&](size_t corner, int axis) {
+    return _mm_setr_ps(positions[tris[corner]][axis],
+                       positions[tris[3 + corner]][axis],
+                       positions[tris[6 + corner]][axis],
+                       positions[tris[9 + corner]][axis]);
+  };
+  auto texture = [&](size_t corner, int axis) {
+    if (mesh.vertexTextureAttribs.empty()) {
+      return _mm_setzero_ps();
+    }
+    const auto& uvs = mesh.vertexTextureAttribs;
+    return _mm_setr_ps(uvs[tris[corner]][axis], uvs[tris[3 + corner]][axis],
+                       uvs[tris[6 + corner]][axis],
+                       uvs[tris[9 + corner]][axis]);
+  };
+  auto length = [](__m128 x, __m128 y, __m128 z) {
+    return _mm_sqrt_ps(_mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+  };
+
+  __m128 e1[3];
+  __m128 e2[3];
+  for (int axis = 0; axis < 3; ++axis) {
+    const __m128 kP0 = position(0, axis);
+    e1[axis] = _mm_sub_ps(position(1, axis), kP0);
+    e2[axis] = _mm_sub_ps(position(2, axis), kP0);
+  }
+  const __m128 kU0 = texture(0, 0);
+  const __m128 kV0 = texture(0, 1);
+  const __m128 kD1u = _mm_sub_ps(texture(1, 0), kU0);
+  const __m128 kD1v = _mm_sub_ps(texture(1, 1), kV0);
+  const __m128 kD2u = _mm_sub_ps(texture(2, 0), kU0);
+  const __m128 kD2v = _mm_sub_ps(texture(2, 1), kV0);
+
+  const __m128 kNormal[3] = {
+      _mm_sub_ps(_mm_mul_ps(e1[1], e2[2]), _mm_mul_ps(e1[2], e2[1])),
+      _mm_sub_ps(_mm_mul_ps(e1[2], e2[0]), _mm_mul_ps(e1[0], e2[2])),
+      _mm_sub_ps(_mm_mul_ps(e1[0], e2[1]), _mm_mul_ps(e1[1], e2[0]))};
+  const __m128 kArea = length(kNormal[0], kNormal[1], kNormal[2]);
+  const __m128 kDet =
+      _mm_sub_ps(_mm_mul_ps(kD1u, kD2v), _mm_mul_ps(kD2u, kD1v));
+  // copysign(area, det)
+  const __m128 kSignedArea =
+      _mm_or_ps(kArea, _mm_and_ps(kDet, _mm_set1_ps(-0.0f)));
+  const __m128 kHasUv = _mm_cmpneq_ps(kDet, _mm_setzero_ps());
+
+  __m128 tangent[3];
+  __m128 bitangent[3];
+  for (int axis = 0; axis < 3; ++axis) {
+    tangent[axis] =
+        _mm_sub_ps(_mm_mul_ps(e1[axis], kD2v), _mm_mul_ps(e2[axis], kD1v));
+    bitangent[axis] =
+        _mm_sub_ps(_mm_mul_ps(e2[axis], kD1u), _mm_mul_ps(e1[axis], kD2u));
+  }
+  // Masked lanes may divide by zero; the mask clears the result
+  const __m128 kTangentLength = length(tangent[0], tangent[1], tangent[2]);
+  const __m128 kBitangentLength =
+      length(bitangent[0], bitangent[1], bitangent[2]);
+  const __m128 kTangentScale = _mm_and_ps(
+      _mm_and_ps(kHasUv, _mm_cmpgt_ps(kTangentLength, _mm_setzero_ps())),
+      _mm_div_ps(kSignedArea, kTangentLength));
+  const __m128 kBitangentScale = _mm_and_ps(
+      _mm_and_ps(kHasUv, _mm_cmpgt_ps(kBitangentLength, _mm_setzero_ps())),
+      _mm_div_ps(kSignedArea, kBitangentLength));
+
+  for (int axis = 0; axis < 3; ++axis) {
+    _mm_store_ps(out.normal[axis], kNormal[axis]);
+    _mm_store_ps(out.tangent[axis], _mm_mul_ps(tangent[axis], kTangentScale));
+    _mm_store_ps(out.bitangent[axis],
+                 _mm_mul_ps(bitangent[axis], kBitangentScale));
+  }
+}
+#endif
+
+bool NeedsNormal(const glm::vec3& normal) {
+  const float kLengthSq = glm::dot(normal, normal);
+  return !(kLengthSq > 0.0f) || !std::isfinite(kLengthSq);
+}
+
+/**
+ * @brief Any unit vector perpendicular to a unit normal.
+ */
+glm::vec3 Perpendicular(const glm::vec3& normal) {
+  const glm::vec3 kAxis = std::abs(normal.x) < 0.9f
+                              ? glm::vec3(1.0f, 0.0f, 0.0f)
+                              : glm::vec3(0.0f, 1.0f, 0.0f);
+  const glm::vec3 kTangent = glm::cross(normal, kAxis);
+  const float kLength = glm::length(kTangent);
+  return kLength > 0.0f ? kTangent / kLength : glm::vec3(1.0f, 0.0f, 0.0f);
+}
+
+size_t ProcessItem(const WorkItem& item) {
+  auto& mesh = *item.mesh;
+  const uint32_t kFirst = item.firstVertex;
+  const size_t kCount = size_t{item.lastVertex} - kFirst + 1;
+
+  std::vector<uint8_t> needsNormal(kCount);
+  std::vector<uint8_t> needsTangent(kCount);
+  bool anyNeeded = false;
+  for (size_t local = 0; local < kCount; ++local) {
+    needsNormal[local] = NeedsNormal(mesh.vertexNormalAttribs[kFirst + local]);
+    needsTangent[local] = mesh.vertexTangentAttribs[kFirst + local].w == 0.0f;
+    anyNeeded = anyNeeded || needsNormal[local] || needsTangent[local];
+  }
+  if (!anyNeeded) {
+    return 0;
+  }
+
+  // Accumulate the faces around every vertex
+  std::vector<glm::vec3> normalSum(kCount, glm::vec3(0.0f));
+  std::vector<glm::vec3> tangentSum(kCount, glm::vec3(0.0f));
+  std::vector<glm::vec3> bitangentSum(kCount, glm::vec3(0.0f));
+  FaceBatch batch{};
+  auto scatter = [&](const uint32_t* tris, size_t faceCount) {
+    for (size_t lane = 0; lane < faceCount; ++lane) {
+      const glm::vec3 kNormal(batch.normal[0][lane], batch.normal[1][lane],
+                              batch.normal[2][lane]);
+      const glm::vec3 kTangent(batch.tangent[0][lane], batch.tangent[1][lane],
+                               batch.tangent[2][lane]);
+      const glm::vec3 kBitangent(batch.bitangent[0][lane],
+                                 batch.bitangent[1][lane],
+                                 batch.bitangent[2][lane]);
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const uint32_t kLocal = tris[lane * 3 + corner] - kFirst;
+        normalSum[kLocal] += kNormal;
+        tangentSum[kLocal] += kTangent;
+        bitangentSum[kLocal] += kBitangent;
+      }
+    }
+  };
+  for (const auto* prim : item.primitives) {
+    const uint32_t* kTris = mesh.indices.data() + prim->firstIndex;
+    const size_t kFaceCount = prim->indexCount / 3;
+    size_t face = 0;
+#ifdef MGTT_TANGENT_SPACE_SSE2
+    for (; face + 4 <= kFaceCount; face += 4) {
+      ComputeFaces4(mesh, kTris + face * 3, batch);
+      scatter(kTris + face * 3, 4);
+    }
+#endif
+    for (; face < kFaceCount; ++face) {
+      ComputeFace(mesh, kTris + face * 3, batch, 0);
+      scatter(kTris + face * 3, 1);
+    }
+  }
+
+  // Normalize the sums, then orthogonalize tangents against the normals
+  std::vector<uint8_t> generated(kCount);
+  size_t local = 0;
+#ifdef MGTT_TANGENT_SPACE_SSE2
+  alignas(16) float normalOut[3][4];
+  alignas(16) float lengthOut[4];
+  for (; local + 4 <= kCount; local += 4) {
+    __m128 sum[3];
+    for (int axis = 0; axis < 3; ++axis) {
+      sum[axis] = _mm_setr_ps(
+          normalSum[local][axis], normalSum[local + 1][axis],
+          normalSum[local + 2][axis], normalSum[local + 3][axis]);
+    }
+    const __m128 kLength = _mm_sqrt_ps(
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(sum[0], sum[0]),
+                              _mm_mul_ps(sum[1], sum[1])),
+                   _mm_mul_ps(sum[2], sum[2])));
+    const __m128 kInverse = _mm_div_ps(_mm_set1_ps(1.0f), kLength);
+    for (int axis = 0; axis < 3; ++axis) {
+      _mm_store_ps(normalOut[axis], _mm_mul_ps(sum[axis], kInverse));
+    }
+    _mm_store_ps(lengthOut, kLength);
+    for (size_t lane = 0; lane < 4; ++lane) {
+      if (needsNormal[local + lane] && lengthOut[lane] > 0.0f) {
+        mesh.vertexNormalAttribs[kFirst + local + lane] = glm::vec3(
+            normalOut[0][lane], normalOut[1][lane], normalOut[2][lane]);
+        generated[local + lane] = 1;
+      }
+    }
+  }
+#endif
+  for (; local < kCount; ++local) {
+    const float kLength = glm::length(normalSum[local]);
+    if (needsNormal[local] && kLength > 0.0f) {
+      mesh.vertexNormalAttribs[kFirst + local] = normalSum[local] / kLength;
+      generated[local] = 1;
+    }
+  }
+
+  auto storeTangent = [&](size_t at, const glm::vec3& tangent, float length,
+                          float handedness) {
+    const glm::vec3& kNormal = mesh.vertexNormalAttribs[kFirst + at];
+    mesh.vertexTangentAttribs[kFirst + at] =
+        length > 1.0e-12f
+            ? glm::vec4(tangent, handedness < 0.0f ? -1.0f : 1.0f)
+            : glm::vec4(Perpendicular(kNormal), 1.0f);
+    generated[at] = 1;
+  };
+  local = 0;
+#ifdef MGTT_TANGENT_SPACE_SSE2
+  alignas(16) float tangentOut[3][4];
+  alignas(16) float handednessOut[4];
+  for (; local + 4 <= kCount; local += 4) {
+    if (!needsTangent[local] && !needsTangent[local + 1] &&
+        !needsTangent[local + 2] && !needsTangent[local + 3]) {
+      continue;
+    }
+    __m128 normal[3];
+    __m128 tangent[3];
+    __m128 bitangent[3];
+    for (int axis = 0; axis < 3; ++axis) {
+      const glm::vec3* kNormals = &mesh.vertexNormalAttribs[kFirst + local];
+      normal[axis] = _mm_setr_ps(kNormals[0][axis], kNormals[1][axis],
+                                 kNormals[2][axis], kNormals[3][axis]);
+      tangent[axis] = _mm_setr_ps(
+          tangentSum[local][axis], tangentSum[local + 1][axis],
+          tangentSum[local + 2][axis], tangentSum[local + 3][axis]);
+      bitangent[axis] = _mm_setr_ps(
+          bitangentSum[local][axis], bitangentSum[local + 1][axis],
+          bitangentSum[local + 2][axis], bitangentSum[local + 3][axis]);
+    }
+    // Gram-Schmidt: t -= n * dot(n, t)
+    const __m128 kDot = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(normal[0], tangent[0]),
+                   _mm_mul_ps(normal[1], tangent[1])),
+        _mm_mul_ps(normal[2], tangent[2]));
+    for (int axis = 0; axis < 3; ++axis) {
+      tangent[axis] = _mm_sub_ps(tangent[axis], _mm_mul_ps(normal[axis], kDot));
+    }
+    const __m128 kLength = _mm_sqrt_ps(
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(tangent[0], tangent[0]),
+                              _mm_mul_ps(tangent[1], tangent[1])),
+                   _mm_mul_ps(tangent[2], tangent[2])));
+    const __m128 kInverse = _mm_div_ps(_mm_set1_ps(1.0f), kLength);
+    for (int axis = 0; axis < 3; ++axis) {
+      tangent[axis] = _mm_mul_ps(tangent[axis], kInverse);
+    }
+    // Sign of dot(cross(n, t), b)
+    const __m128 kCross[3] = {
+        _mm_sub_ps(_mm_mul_ps(normal[1], tangent[2]),
+                   _mm_mul_ps(normal[2], tangent[1])),
+        _mm_sub_ps(_mm_mul_ps(normal[2], tangent[0]),
+                   _mm_mul_ps(normal[0], tangent[2])),
+        _mm_sub_ps(_mm_mul_ps(normal[0], tangent[1]),
+                   _mm_mul_ps(normal[1], tangent[0]))};
+    const __m128 kHandedness = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(kCross[0], bitangent[0]),
+                   _mm_mul_ps(kCross[1], bitangent[1])),
+        _mm_mul_ps(kCross[2], bitangent[2]));
+    for (int axis = 0; axis < 3; ++axis) {
+      _mm_store_ps(tangentOut[axis], tangent[axis]);
+    }
+    _mm_store_ps(lengthOut, kLength);
+    _mm_store_ps(handednessOut, kHandedness);
+    for (size_t lane = 0; lane < 4; ++lane) {
+      if (needsTangent[local + lane]) {
+        storeTangent(local + lane,
+                     glm::vec3(tangentOut[0][lane], tangentOut[1][lane],
+                               tangentOut[2][lane]),
+                     lengthOut[lane], handednessOut[lane]);
+      }
+    }
+  }
+#endif
+  for (; local < kCount; ++local) {
+    if (!needsTangent[local]) {
+      continue;
+    }
+    const glm::vec3& kNormal = mesh.vertexNormalAttribs[kFirst + local];
+    const glm::vec3 kTangent =
+        tangentSum[local] - kNormal * glm::dot(kNormal, tangentSum[local]);
+    const float kLength = glm::length(kTangent);
+    const glm::vec3 kUnit =
+        kLength > 0.0f ? kTangent / kLength : glm::vec3(0.0f);
+    storeTangent(local, kUnit, kLength,
+                 glm::dot(glm::cross(kNormal, kUnit), bitangentSum[local]));
+  }
+
+  return static_cast<size_t>(
+      std::count(generated.begin(), generated.end(), uint8_t{1}));
+}
+
+/**
+ * @brief Validate a mesh, size its normal and tangent arrays and append its
+ * work items.
+ */
+Mgtt::Common::Result<void> CollectItems(Mgtt::Rendering::Mesh& mesh,
+                                        std::vector<WorkItem>& items) {
+  const size_t kVertexCount = mesh.vertexPositionAttribs.size();
+  if (mesh.vertexNormalAttribs.empty()) {
+    mesh.vertexNormalAttribs.assign(kVertexCount, glm::vec3(0.0f));
+  }
+  if (mesh.vertexTangentAttribs.empty()) {
+    mesh.vertexTangentAttribs.assign(kVertexCount, glm::vec4(0.0f));
+  }
+  if (mesh.vertexNormalAttribs.size() != kVertexCount ||
+      mesh.vertexTangentAttribs.size() != kVertexCount ||
+      (!mesh.vertexTextureAttribs.empty() &&
+       mesh.vertexTextureAttribs.size() != kVertexCount)) {
+    return Mgtt::Common::Result<void>::Err(
+        "Vertex attribute count mismatch in mesh " + mesh.name);
+  }
+
+  std::vector<WorkItem> meshItems;
+  for (const auto& prim : mesh.meshPrimitives) {
+    const size_t kEnd = size_t{prim.firstIndex} + prim.indexCount;
+    if (!prim.hasIndices || prim.indexCount < 3) {
+      continue;
+    }
+    if (kEnd > mesh.indices.size()) {
+      return Mgtt::Common::Result<void>::Err(
+          "Mesh primitive index range out of bounds in mesh " + mesh.name);
+    }
+    const auto [kMin, kMax] = std::minmax_element(
+        mesh.indices.begin() + prim.firstIndex, mesh.indices.begin() + kEnd);
+    if (*kMax >= kVertexCount) {
+      return Mgtt::Common::Result<void>::Err(
+          "Mesh index out of range in mesh " + mesh.name);
+    }
+    WorkItem item;
+    item.mesh = &mesh;
+    item.primitives.push_back(&prim);
+    item.firstVertex = *kMin;
+    item.lastVertex = *kMax;
+    meshItems.push_back(std::move(item));
+  }
+
+  // Merge primitives whose vertex ranges overlap
+  std::sort(meshItems.begin(), meshItems.end(),
+            [](const WorkItem& lhs, const WorkItem& rhs) {
+              return lhs.firstVertex < rhs.firstVertex;
+            });
+  for (auto& item : meshItems) {
+    if (!items.empty() && items.back().mesh == &mesh &&
+        item.firstVertex <= items.back().lastVertex) {
+      auto& merged = items.back();
+      merged.primitives.insert(merged.primitives.end(),
+                               item.primitives.begin(), item.primitives.end());
+      merged.lastVertex = std::max(merged.lastVertex, item.lastVertex);
+    } else {
+      items.push_back(std::move(item));
+    }
+  }
+  return Mgtt::Common::Result<void>::Ok();
+}
+
+size_t RunItems(const std::vector<WorkItem>& items, uint32_t threadCount) {
+  std::atomic<size_t> generated{0};
+  ParallelFor(items.size(), threadCount, [&](size_t idx) {
+    generated += ProcessItem(items[idx]);
+  });
+  return generated.load();
+}
+
+}  // namespace
+
+Mgtt::Common::Result<size_t> GenerateTangentSpace(
+    Mgtt::Rendering::Mesh& mesh, uint32_t threadCount) {
+  std::vector<WorkItem> items;
+  if (auto result = CollectItems(mesh, items); result.err()) {
+    return Mgtt::Common::Result<size_t>::Err(result.error());
+  }
+  return Mgtt::Common::Result<size_t>::Ok(RunItems(items, threadCount));
+}
+
+Mgtt::Common::Result<size_t> GenerateTangentSpace(
+    Mgtt::Rendering::Scene& scene, uint32_t threadCount) {
+  std::vector<WorkItem> items;
+  std::unordered_set<const Mgtt::Rendering::Mesh*> visited;
+  for (const auto& node : scene.nodes) {
+    if (node.mesh == nullptr || !visited.insert(node.mesh.get()).second) {
+      continue;
+    }
+    if (auto result = CollectItems(*node.mesh, items); result.err()) {
+      return Mgtt::Common::Result<size_t>::Err(result.error());
+    }
+  }
+  return Mgtt::Common::Result<size_t>::Ok(RunItems(items, threadCount));
+}
+
+}  // namespace Mgtt::Rendering
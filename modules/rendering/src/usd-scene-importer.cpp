@@ -29,9 +29,75 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace Mgtt::Rendering {
 
+namespace {
+
+/**
+ * @brief Resolve an asset path of the stage against the directory of the
+ * USD file, leaving absolute paths untouched.
+ */
+std::string ResolveAssetPath(const std::string& baseDir,
+                             const std::string& assetPath) {
+  if (baseDir.empty() || assetPath.empty() ||
+      assetPath.find(":/") != std::string::npos ||
+      assetPath.find(":\\") != std::string::npos || assetPath[0] == '/') {
+    return assetPath;
+  }
+  return baseDir + assetPath;
+}
+
+/**
+ * @brief Sublayer, reference and payload layers and texture files the stage
+ * pulls in, which the scene cache stamps along with the USD file.
+ */
+std::vector<std::string> ExternalFiles(
+    const tinyusdz::Stage& stage,
+    const tinyusdz::tydra::RenderScene& renderScene,
+    const std::string& baseDir) {
+  std::vector<std::string> files;
+  auto addAsset = [&](const std::string& assetPath) {
+    if (!assetPath.empty()) {
+      files.push_back(ResolveAssetPath(baseDir, assetPath));
+    }
+  };
+  for (const auto& subLayer : stage.metas().subLayers) {
+    addAsset(subLayer.GetAssetPath());
+  }
+
+  std::vector<const tinyusdz::Prim*> prims;
+  for (const auto& prim : stage.root_prims()) {
+    prims.push_back(&prim);
+  }
+  while (!prims.empty()) {
+    const tinyusdz::Prim* prim = prims.back();
+    prims.pop_back();
+    const auto& metas = prim->metas();
+    if (metas.references) {
+      for (const auto& reference : metas.references->second) {
+        addAsset(reference.asset_path.GetAssetPath());
+      }
+    }
+    if (metas.payload) {
+      for (const auto& payload : metas.payload->second) {
+        addAsset(payload.asset_path.GetAssetPath());
+      }
+    }
+    for (const auto& child : prim->children()) {
+      prims.push_back(&child);
+    }
+  }
+
+  for (const auto& image : renderScene.images) {
+    addAsset(image.asset_identifier);
+  }
+  return files;
+}
+
+}  // namespace
+
 Mgtt::Common::Result<void> UsdSceneImporter::Load(Mgtt::Rendering::Scene& scene,
                                                   std::string_view path) {
   if (scene.shader.GetProgramId() == 0) {
@@ -58,6 +124,23 @@ Mgtt::Common::Result<void> UsdSceneImporter::Load(Mgtt::Rendering::Scene& scene,
         "File not found or not a USD format: " + kPathStr);
   }
 
+  auto cancelled = [&]() {
+    DiscardScene(scene);
+    return Mgtt::Common::Result<void>::Err("Load cancelled: " + kPathStr);
+  };
+
+  sceneCache_.SetImportOptions(GetImportOptions());
+  // Entries of earlier loads may still be in flight
+  if (auto result = sceneCache_.Flush(); result.err()) {
+    std::cerr << "Scene cache not written: " << result.error() << '\n';
+  }
+  if (sceneCache_.IsEnabled() && sceneCache_.Load(scene, kPathStr).ok()) {
+    std::cout << "Scene cache hit: " << kPathStr << '\n';
+    scene.transforms.Build(scene.nodes, scene.rootNodes);
+    return ReportProgress(1.0f) ? Mgtt::Common::Result<void>::Ok()
+                                : cancelled();
+  }
+
   scene.path = kPathStr;
 
   std::string warn;
@@ -65,7 +148,7 @@ Mgtt::Common::Result<void> UsdSceneImporter::Load(Mgtt::Rendering::Scene& scene,
   tinyusdz::Stage stage;
 
   if (!tinyusdz::LoadUSDFromFile(kPathStr, &stage, &warn, &err)) {
-    Clear(scene);
+    DiscardScene(scene);
     return Mgtt::Common::Result<void>::Err(
         "Failed to load USD file: " + kPathStr +
         (err.empty() ? "" : " — " + err));
@@ -73,6 +156,9 @@ Mgtt::Common::Result<void> UsdSceneImporter::Load(Mgtt::Rendering::Scene& scene,
   if (!warn.empty()) {
     std::cout << "USD load warning: " << warn << '\n';
   }
+  if (!ReportProgress(0.3f)) {
+    return cancelled();
+  }
 
   tinyusdz::tydra::RenderScene renderScene;
   tinyusdz::tydra::RenderSceneConverter converter;
@@ -88,7 +174,7 @@ Mgtt::Common::Result<void> UsdSceneImporter::Load(Mgtt::Rendering::Scene& scene,
   env.set_search_paths({kBaseDir});
 
   if (!converter.ConvertToRenderScene(env, &renderScene)) {
-    Clear(scene);
+    DiscardScene(scene);
     return Mgtt::Common::Result<void>::Err(
         "Failed to convert USD stage to RenderScene: " + converter.GetError());
   }
@@ -97,27 +183,35 @@ Mgtt::Common::Result<void> UsdSceneImporter::Load(Mgtt::Rendering::Scene& scene,
   if (!kConverterWarn.empty()) {
     std::cout << "RenderScene converter warning: " << kConverterWarn << '\n';
   }
+  if (!ReportProgress(0.6f)) {
+    return cancelled();
+  }
 
   if (auto r = LoadTextures(scene, renderScene); r.err()) {
-    Clear(scene);
+    DiscardScene(scene);
     return r;
   }
 
   LoadMaterials(scene, renderScene);
+  if (!ReportProgress(0.8f)) {
+    return cancelled();
+  }
 
   if (auto r = LoadMeshes(scene, renderScene); r.err()) {
-    Clear(scene);
+    DiscardScene(scene);
     return r;
   }
 
+  scene.transforms.Build(scene.nodes, scene.rootNodes);
+
   // Compute scene AABB from all loaded meshes
   scene.aabb.min = glm::vec3(FLT_MAX);
   scene.aabb.max = glm::vec3(-FLT_MAX);
 
   for (const auto& node : scene.nodes) {
-    if (node->mesh != nullptr) {
-      scene.aabb.min = glm::min(scene.aabb.min, node->mesh->aabb.min);
-      scene.aabb.max = glm::max(scene.aabb.max, node->mesh->aabb.max);
+    if (node.mesh != nullptr) {
+      scene.aabb.min = glm::min(scene.aabb.min, node.aabb.min);
+      scene.aabb.max = glm::max(scene.aabb.max, node.aabb.max);
     }
   }
 
@@ -131,6 +225,22 @@ Mgtt::Common::Result<void> UsdSceneImporter::Load(Mgtt::Rendering::Scene& scene,
 
   std::cout << "USD scene loaded: " << kPathStr
             << " (scale=" << scene.aabb.scale << ")\n";
+
+  if (auto result = ProcessMeshes(scene); result.err()) {
+    DiscardScene(scene);
+    return result;
+  }
+
+  if (!ReportProgress(1.0f)) {
+    return cancelled();
+  }
+  if (sceneCache_.IsEnabled()) {
+    if (auto result = sceneCache_.SaveAsync(
+            scene, kPathStr, ExternalFiles(stage, renderScene, kBaseDir));
+        result.err()) {
+      std::cerr << "Scene cache not written: " << result.error() << '\n';
+    }
+  }
   return Mgtt::Common::Result<void>::Ok();
 }
 
@@ -138,6 +248,25 @@ void UsdSceneImporter::Clear(Mgtt::Rendering::Scene& scene) noexcept {
   scene.Clear();
 }
 
+void UsdSceneImporter::DiscardScene(Mgtt::Rendering::Scene& scene) noexcept {
+  // Load makes no GL calls, so the caller's shader survives a failed load
+  Mgtt::Rendering::OpenGlShader shader = std::move(scene.shader);
+  for (auto& [key, texture] : scene.textureMap) {
+    if (texture.data != nullptr) {
+      stbi_image_free(texture.data);
+      texture.data = nullptr;
+    }
+  }
+  Clear(scene);
+  scene.shader = std::move(shader);
+}
+
+void UsdSceneImporter::SetCacheDirectory(std::string_view directory,
+                                         uint64_t sizeLimit) {
+  sceneCache_.SetDirectory(directory);
+  sceneCache_.SetSizeLimit(sizeLimit);
+}
+
 Mgtt::Common::Result<void> UsdSceneImporter::LoadTextures(
     Mgtt::Rendering::Scene& scene,
     const tinyusdz::tydra::RenderScene& renderScene) {
@@ -164,12 +293,8 @@ Mgtt::Common::Result<void> UsdSceneImporter::LoadTextures(
 
     if (!texture.path.empty()) {
       // Resolve relative paths against the USD file's directory
-      std::string kResolvedPath = texture.path;
-      if (!kBaseDir.empty() && texture.path.find(":/") == std::string::npos &&
-          texture.path.find(":\\") == std::string::npos &&
-          texture.path[0] != '/') {
-        kResolvedPath = kBaseDir + texture.path;
-      }
+      const std::string kResolvedPath =
+          ResolveAssetPath(kBaseDir, texture.path);
 
       texture.data = stbi_load(kResolvedPath.c_str(), &texture.width,
                                &texture.height, &texture.nrComponents, 0);
@@ -264,10 +389,11 @@ Mgtt::Common::Result<void> UsdSceneImporter::LoadMeshes(
     Mgtt::Rendering::Scene& scene,
     const tinyusdz::tydra::RenderScene& renderScene) {
   for (const auto& tydraMesh : renderScene.meshes) {
-    auto newNode = std::make_shared<Mgtt::Rendering::Node>();
-    newNode->name = tydraMesh.prim_name;
-    newNode->matrix = glm::mat4(1.0f);  // world matrix not on RenderMesh;
-                                        // use node hierarchy if needed
+    // Every mesh becomes a root node
+    auto& newNode = scene.nodes[scene.AddNode()];
+    newNode.name = tydraMesh.prim_name;
+    newNode.matrix = glm::mat4(1.0f);  // world matrix not on RenderMesh;
+                                       // use node hierarchy if needed
 
     auto newMesh = std::make_shared<Mgtt::Rendering::Mesh>();
     newMesh->name = tydraMesh.prim_name;
@@ -327,6 +453,8 @@ Mgtt::Common::Result<void> UsdSceneImporter::LoadMeshes(
         static_cast<uint32_t>(newMesh->vertexPositionAttribs.size());
     prim.hasIndices = !newMesh->indices.empty();
     prim.aabb = newMesh->aabb;
+    // USD nodes carry no transform, so world and mesh bounds coincide
+    newNode.aabb = newMesh->aabb;
 
     const int kMatId = tydraMesh.material_id;
     if (kMatId >= 0 && static_cast<size_t>(kMatId) < scene.materials.size()) {
@@ -337,10 +465,9 @@ Mgtt::Common::Result<void> UsdSceneImporter::LoadMeshes(
     newMesh->meshPrimitives.push_back(std::move(prim));
 
     // GPU upload deferred to SceneUploader::Upload()
-    newNode->mesh = std::move(newMesh);
+    newNode.mesh = std::move(newMesh);
 
-    std::cout << "Allocated USD node " << newNode->name << '\n';
-    scene.nodes.push_back(std::move(newNode));
+    std::cout << "Allocated USD node " << newNode.name << '\n';
   }
 
   return Mgtt::Common::Result<void>::Ok();
@@ -0,0 +1,147 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vertex-packing.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Mgtt::Rendering {
+
+namespace {
+
+int16_t PackSnorm16(float value) {
+  return static_cast<int16_t>(
+      std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+}
+
+uint32_t PackSnorm10(float value) {
+  const auto kSigned = static_cast<int32_t>(
+      std::lround(std::clamp(value, -1.0f, 1.0f) * 511.0f));
+  return static_cast<uint32_t>(kSigned) & 0x3FFu;
+}
+
+}  // namespace
+
+uint16_t FloatToHalf(float value) {
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  const auto kSign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+  const uint32_t kMagnitude = bits & 0x7FFFFFFFu;
+
+  if (kMagnitude >= 0x7F800000u) {
+    // Infinity keeps its sign, NaN stays a quiet NaN
+    return static_cast<uint16_t>(kSign | 0x7C00u |
+                                 (kMagnitude > 0x7F800000u ? 0x200u : 0u));
+  }
+  if (kMagnitude >= 0x477FF000u) {
+    // Rounds to a value above the largest finite half
+    return static_cast<uint16_t>(kSign | 0x7C00u);
+  }
+  if (kMagnitude < 0x38800000u) {
+    // Subnormal half or zero: shift the mantissa with its implicit bit into
+    // place and round to nearest even
+    if (kMagnitude < 0x33000000u) {
+      return kSign;
+    }
+    const uint32_t kExponent = kMagnitude >> 23;
+    const uint32_t kMantissa = (kMagnitude & 0x7FFFFFu) | 0x800000u;
+    const uint32_t kShift = 126u - kExponent;
+    uint32_t half = kMantissa >> kShift;
+    const uint32_t kRemainder = kMantissa & ((1u << kShift) - 1u);
+    const uint32_t kHalfway = 1u << (kShift - 1u);
+    if (kRemainder > kHalfway || (kRemainder == kHalfway && (half & 1u))) {
+      ++half;
+    }
+    return static_cast<uint16_t>(kSign | half);
+  }
+
+  // Normal half: rebias the exponent and round the mantissa to nearest even
+  uint32_t half = (kMagnitude - 0x38000000u) >> 13;
+  const uint32_t kRemainder = kMagnitude & 0x1FFFu;
+  if (kRemainder > 0x1000u || (kRemainder == 0x1000u && (half & 1u))) {
+    ++half;
+  }
+  return static_cast<uint16_t>(kSign | half);
+}
+
+uint32_t PackNormal(const glm::vec3& normal) {
+  return PackSnorm10(normal.x) | (PackSnorm10(normal.y) << 10) |
+         (PackSnorm10(normal.z) << 20);
+}
+
+uint32_t PackTangent(const glm::vec4& tangent) {
+  // 2-bit two's complement: 1 is +1, 3 is -1
+  const uint32_t kSign = tangent.w > 0.0f ? 1u : (tangent.w < 0.0f ? 3u : 0u);
+  return PackNormal(glm::vec3(tangent)) | (kSign << 30);
+}
+
+std::vector<PackedVertex> PackVertices(const Mgtt::Rendering::Mesh& mesh,
+                                       glm::vec3& positionOffset,
+                                       glm::vec3& positionScale) {
+  const auto& positions = mesh.vertexPositionAttribs;
+  glm::vec3 minPos(0.0f);
+  glm::vec3 maxPos(0.0f);
+  if (!positions.empty()) {
+    minPos = positions[0];
+    maxPos = positions[0];
+    for (const auto& position : positions) {
+      minPos = glm::min(minPos, position);
+      maxPos = glm::max(maxPos, position);
+    }
+  }
+  positionOffset = (minPos + maxPos) * 0.5f;
+  positionScale = (maxPos - minPos) * 0.5f;
+
+  std::vector<PackedVertex> packed(positions.size());
+  for (size_t idx = 0; idx < positions.size(); ++idx) {
+    PackedVertex& vertex = packed[idx];
+    const glm::vec3 kRelative = positions[idx] - positionOffset;
+    for (int axis = 0; axis < 3; ++axis) {
+      // A flat axis is stored as 0 and restored from the offset alone
+      vertex.position[axis] =
+          positionScale[axis] > 0.0f
+              ? PackSnorm16(kRelative[axis] / positionScale[axis])
+              : int16_t{0};
+    }
+    vertex.position[3] = 0;
+
+    vertex.normal = idx < mesh.vertexNormalAttribs.size()
+                        ? PackNormal(mesh.vertexNormalAttribs[idx])
+                        : 0u;
+
+    const glm::vec2 kUv = idx < mesh.vertexTextureAttribs.size()
+                              ? mesh.vertexTextureAttribs[idx]
+                              : glm::vec2(0.0f);
+    vertex.textureCoordinates[0] = FloatToHalf(kUv.x);
+    vertex.textureCoordinates[1] = FloatToHalf(kUv.y);
+
+    vertex.tangent = idx < mesh.vertexTangentAttribs.size()
+                         ? PackTangent(mesh.vertexTangentAttribs[idx])
+                         : 0u;
+  }
+  return packed;
+}
+
+}  // namespace Mgtt::Rendering
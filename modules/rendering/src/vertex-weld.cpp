@@ -0,0 +1,218 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vertex-weld.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Mgtt::Rendering {
+
+namespace {
+
+constexpr uint32_t kNoVertex = ~0u;
+
+using Cell = std::array<int64_t, 3>;
+
+/**
+ * @brief Spatial hash cell of a position. With epsilon 0 the cell is the
+ * exact bit pattern, so only identical positions share it.
+ */
+Cell CellOf(const glm::vec3& position, float epsilon) {
+  Cell cell{};
+  for (int axis = 0; axis < 3; ++axis) {
+    // Adding 0 folds -0 into +0, which compare equal
+    const float kValue = position[axis] + 0.0f;
+    if (epsilon > 0.0f) {
+      constexpr double kLimit = 4.0e18;
+      cell[axis] = static_cast<int64_t>(std::clamp(
+          std::floor(static_cast<double>(kValue) / epsilon), -kLimit, kLimit));
+    } else {
+      int32_t bits = 0;
+      std::memcpy(&bits, &kValue, sizeof(bits));
+      cell[axis] = bits;
+    }
+  }
+  return cell;
+}
+
+uint64_t HashCell(const Cell& cell) {
+  uint64_t hash = 14695981039346656037ull;
+  for (const int64_t kCoord : cell) {
+    hash ^= static_cast<uint64_t>(kCoord);
+    hash *= 1099511628211ull;
+    hash ^= hash >> 29;
+  }
+  return hash;
+}
+
+template <typename T>
+bool Near(const T& lhs, const T& rhs, float epsilon) {
+  for (int comp = 0; comp < T::length(); ++comp) {
+    if (!(std::abs(lhs[comp] - rhs[comp]) <= epsilon)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+void Compact(std::vector<T>& attribs, const std::vector<uint32_t>& kept) {
+  if (attribs.empty()) {
+    return;
+  }
+  std::vector<T> compacted;
+  compacted.reserve(kept.size());
+  for (const uint32_t kVertex : kept) {
+    compacted.push_back(attribs[kVertex]);
+  }
+  attribs = std::move(compacted);
+}
+
+}  // namespace
+
+Mgtt::Common::Result<size_t> WeldVertices(Mgtt::Rendering::Mesh& mesh,
+                                          float epsilon) {
+  using SizeResult = Mgtt::Common::Result<size_t>;
+  const size_t kVertexCount = mesh.vertexPositionAttribs.size();
+  auto fits = [&](size_t size) { return size == 0 || size == kVertexCount; };
+  if (!fits(mesh.vertexNormalAttribs.size()) ||
+      !fits(mesh.vertexTextureAttribs.size()) ||
+      !fits(mesh.vertexTangentAttribs.size()) ||
+      !fits(mesh.vertexJointAttribs.size()) ||
+      !fits(mesh.vertexWeightAttribs.size())) {
+    return SizeResult::Err("Vertex attribute count mismatch in mesh " +
+                           mesh.name);
+  }
+  for (const uint32_t kIdx : mesh.indices) {
+    if (kIdx >= kVertexCount) {
+      return SizeResult::Err("Mesh index out of range in mesh " + mesh.name);
+    }
+  }
+  for (const auto& prim : mesh.meshPrimitives) {
+    if (!prim.hasIndices && prim.vertexCount > 0) {
+      return SizeResult::Ok(0);
+    }
+  }
+  epsilon = std::max(epsilon, 0.0f);
+
+  const auto& positions = mesh.vertexPositionAttribs;
+  auto same = [&](uint32_t lhs, uint32_t rhs) {
+    return Near(positions[lhs], positions[rhs], epsilon) &&
+           (mesh.vertexNormalAttribs.empty() ||
+            Near(mesh.vertexNormalAttribs[lhs], mesh.vertexNormalAttribs[rhs],
+                 epsilon)) &&
+           (mesh.vertexTextureAttribs.empty() ||
+            Near(mesh.vertexTextureAttribs[lhs],
+                 mesh.vertexTextureAttribs[rhs], epsilon)) &&
+           (mesh.vertexTangentAttribs.empty() ||
+            Near(mesh.vertexTangentAttribs[lhs],
+                 mesh.vertexTangentAttribs[rhs], epsilon)) &&
+           (mesh.vertexJointAttribs.empty() ||
+            mesh.vertexJointAttribs[lhs] == mesh.vertexJointAttribs[rhs]) &&
+           (mesh.vertexWeightAttribs.empty() ||
+            Near(mesh.vertexWeightAttribs[lhs], mesh.vertexWeightAttribs[rhs],
+                 epsilon));
+  };
+
+  // Kept vertices chained per hash bucket. Vertices within epsilon lie in
+  // the same or an adjacent cell, so with a tolerance all 27 are searched.
+  std::vector<uint32_t> kept;
+  std::vector<uint32_t> chainNext;
+  std::unordered_map<uint64_t, uint32_t> buckets;
+  buckets.reserve(kVertexCount);
+  std::vector<uint32_t> remap(kVertexCount, kNoVertex);
+  const int64_t kReach = epsilon > 0.0f ? 1 : 0;
+
+  for (uint32_t vertex = 0; vertex < kVertexCount; ++vertex) {
+    const Cell kCell = CellOf(positions[vertex], epsilon);
+    uint32_t match = kNoVertex;
+    for (int64_t dz = -kReach; dz <= kReach && match == kNoVertex; ++dz) {
+      for (int64_t dy = -kReach; dy <= kReach && match == kNoVertex; ++dy) {
+        for (int64_t dx = -kReach; dx <= kReach && match == kNoVertex;
+             ++dx) {
+          const auto kIter = buckets.find(
+              HashCell({kCell[0] + dx, kCell[1] + dy, kCell[2] + dz}));
+          if (kIter == buckets.end()) {
+            continue;
+          }
+          for (uint32_t slot = kIter->second; slot != kNoVertex;
+               slot = chainNext[slot]) {
+            if (same(kept[slot], vertex)) {
+              match = slot;
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    if (match == kNoVertex) {
+      match = static_cast<uint32_t>(kept.size());
+      kept.push_back(vertex);
+      auto [iter, inserted] = buckets.try_emplace(HashCell(kCell), match);
+      chainNext.push_back(inserted ? kNoVertex : iter->second);
+      iter->second = match;
+    }
+    remap[vertex] = match;
+  }
+
+  const size_t kRemoved = kVertexCount - kept.size();
+  if (kRemoved == 0) {
+    return SizeResult::Ok(0);
+  }
+
+  for (auto& index : mesh.indices) {
+    index = remap[index];
+  }
+  Compact(mesh.vertexPositionAttribs, kept);
+  Compact(mesh.vertexNormalAttribs, kept);
+  Compact(mesh.vertexTextureAttribs, kept);
+  Compact(mesh.vertexTangentAttribs, kept);
+  Compact(mesh.vertexJointAttribs, kept);
+  Compact(mesh.vertexWeightAttribs, kept);
+
+  std::vector<uint32_t> lastSeen(kept.size(), kNoVertex);
+  for (uint32_t primIdx = 0; primIdx < mesh.meshPrimitives.size();
+       ++primIdx) {
+    auto& prim = mesh.meshPrimitives[primIdx];
+    const size_t kEnd = std::min(
+        mesh.indices.size(), prim.firstIndex + size_t{prim.indexCount});
+    uint32_t distinct = 0;
+    for (size_t idx = prim.firstIndex; idx < kEnd; ++idx) {
+      if (lastSeen[mesh.indices[idx]] != primIdx) {
+        lastSeen[mesh.indices[idx]] = primIdx;
+        ++distinct;
+      }
+    }
+    prim.vertexCount = distinct;
+  }
+  return SizeResult::Ok(kRemoved);
+}
+
+}  // namespace Mgtt::Rendering
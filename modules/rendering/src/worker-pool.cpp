@@ -0,0 +1,109 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <worker-pool.h>
+
+namespace Mgtt::Rendering {
+
+WorkerPool::~WorkerPool() noexcept { Stop(); }
+
+void WorkerPool::SetThreadCount(uint32_t threadCount) {
+  Stop();
+#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+  stop_ = false;
+  // Threads only run loops published after they were started
+  const uint64_t kGeneration = generation_;
+  for (uint32_t thread = 1; thread < threadCount; ++thread) {
+    threads_.emplace_back([this, kGeneration]() { WorkerLoop(kGeneration); });
+  }
+#endif
+}
+
+uint32_t WorkerPool::GetThreadCount() const noexcept {
+  return static_cast<uint32_t>(threads_.size()) + 1;
+}
+
+void WorkerPool::Run(size_t count, ItemFn fn, const void* context) {
+  auto drain = [fn, context](size_t idx) { fn(context, idx); };
+  if (threads_.empty() || count <= 1) {
+    std::atomic<size_t> nextItem{0};
+    detail::DrainItems(nextItem, count, drain);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    itemFn_ = fn;
+    context_ = context;
+    count_ = count;
+    nextItem_.store(0);
+    busyThreads_ = threads_.size();
+    ++generation_;
+  }
+  wake_.notify_all();
+  detail::DrainItems(nextItem_, count, drain);
+
+  // Every pool thread takes part in every loop, so none can still read this
+  // loop's state once it is replaced by the next
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this]() { return busyThreads_ == 0; });
+}
+
+void WorkerPool::WorkerLoop(uint64_t seenGeneration) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    wake_.wait(lock, [&]() {
+      return stop_ || generation_ != seenGeneration;
+    });
+    if (stop_) {
+      return;
+    }
+    seenGeneration = generation_;
+    const ItemFn kFn = itemFn_;
+    const void* kContext = context_;
+    const size_t kCount = count_;
+    lock.unlock();
+
+    detail::DrainItems(nextItem_, kCount, [kFn, kContext](size_t idx) {
+      kFn(kContext, idx);
+    });
+
+    lock.lock();
+    if (--busyThreads_ == 0) {
+      done_.notify_one();
+    }
+  }
+}
+
+void WorkerPool::Stop() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+  threads_.clear();
+}
+
+}  // namespace Mgtt::Rendering
@@ -0,0 +1,135 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <accessor-copy.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class AccessorCopyTest : public ::testing::Test {};
+
+TEST_F(AccessorCopyTest, CopyPackedVec3) {
+  RecordProperty("Test Description",
+                 "Tightly packed vec3 accessors are copied verbatim");
+  RecordProperty("Expected Result", "Destination equals source");
+
+  const std::vector<float> kSrc = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::vector<glm::vec3> dst(3);
+  CopyAccessor(reinterpret_cast<const unsigned char*>(kSrc.data()), 3,
+               sizeof(glm::vec3), dst.data());
+
+  EXPECT_EQ(dst[0], glm::vec3(1, 2, 3));
+  EXPECT_EQ(dst[1], glm::vec3(4, 5, 6));
+  EXPECT_EQ(dst[2], glm::vec3(7, 8, 9));
+}
+
+TEST_F(AccessorCopyTest, CopyStridedAccessors) {
+  RecordProperty("Test Description",
+                 "Interleaved accessors are gathered by byte stride");
+  RecordProperty("Expected Result",
+                 "Only the addressed components are copied, nothing is "
+                 "written past the destination");
+
+  // Interleaved position (3), uv (2), padding (3) -> 32 byte stride. A vec4
+  // read at the uv overlaps the padding
+  constexpr size_t kCount = 5;
+  constexpr size_t kStrideFloats = 8;
+  std::vector<float> src(kCount * kStrideFloats, -1.0f);
+  for (size_t vtx = 0; vtx < kCount; ++vtx) {
+    const float kBase = static_cast<float>(vtx * 10);
+    src[vtx * kStrideFloats + 0] = kBase + 1;
+    src[vtx * kStrideFloats + 1] = kBase + 2;
+    src[vtx * kStrideFloats + 2] = kBase + 3;
+    src[vtx * kStrideFloats + 3] = kBase + 4;
+    src[vtx * kStrideFloats + 4] = kBase + 5;
+    src[vtx * kStrideFloats + 5] = kBase + 6;
+  }
+  const auto* kBytes = reinterpret_cast<const unsigned char*>(src.data());
+
+  std::vector<glm::vec3> positions(kCount + 1, glm::vec3(42.0f));
+  std::vector<glm::vec2> uvs(kCount + 1, glm::vec2(42.0f));
+  std::vector<glm::vec4> tuples(kCount + 1, glm::vec4(42.0f));
+  CopyAccessor(kBytes, kCount, kStrideFloats * sizeof(float),
+               positions.data());
+  CopyAccessor(kBytes + 3 * sizeof(float), kCount,
+               kStrideFloats * sizeof(float), uvs.data());
+  CopyAccessor(kBytes + 3 * sizeof(float), kCount,
+               kStrideFloats * sizeof(float), tuples.data());
+
+  for (size_t vtx = 0; vtx < kCount; ++vtx) {
+    const float kBase = static_cast<float>(vtx * 10);
+    EXPECT_EQ(positions[vtx], glm::vec3(kBase + 1, kBase + 2, kBase + 3));
+    EXPECT_EQ(uvs[vtx], glm::vec2(kBase + 4, kBase + 5));
+    EXPECT_EQ(tuples[vtx], glm::vec4(kBase + 4, kBase + 5, kBase + 6, -1.0f));
+  }
+  EXPECT_EQ(positions[kCount], glm::vec3(42.0f));
+  EXPECT_EQ(uvs[kCount], glm::vec2(42.0f));
+  EXPECT_EQ(tuples[kCount], glm::vec4(42.0f));
+}
+
+TEST_F(AccessorCopyTest, WidenAndRebaseIndices) {
+  RecordProperty("Test Description",
+                 "8, 16 and 32 bit indices are widened and rebased");
+  RecordProperty("Expected Result",
+                 "Every index equals source + base, including the scalar "
+                 "tail");
+
+  constexpr size_t kCount = 37;
+  constexpr uint32_t kBaseVertex = 1000;
+  std::vector<uint8_t> src8(kCount);
+  std::vector<uint16_t> src16(kCount);
+  std::vector<uint32_t> src32(kCount);
+  for (size_t idx = 0; idx < kCount; ++idx) {
+    src8[idx] = static_cast<uint8_t>(255 - idx);
+    src16[idx] = static_cast<uint16_t>(65535 - idx * 7);
+    src32[idx] = static_cast<uint32_t>(100000 + idx * 13);
+  }
+
+  std::vector<uint32_t> dst(kCount);
+  CopyIndices(src8.data(), kCount, sizeof(uint8_t), kBaseVertex, dst.data());
+  for (size_t idx = 0; idx < kCount; ++idx) {
+    EXPECT_EQ(dst[idx], src8[idx] + kBaseVertex);
+  }
+
+  CopyIndices(reinterpret_cast<const unsigned char*>(src16.data()), kCount,
+              sizeof(uint16_t), kBaseVertex, dst.data());
+  for (size_t idx = 0; idx < kCount; ++idx) {
+    EXPECT_EQ(dst[idx], src16[idx] + kBaseVertex);
+  }
+
+  CopyIndices(reinterpret_cast<const unsigned char*>(src32.data()), kCount,
+              sizeof(uint32_t), kBaseVertex, dst.data());
+  for (size_t idx = 0; idx < kCount; ++idx) {
+    EXPECT_EQ(dst[idx], src32[idx] + kBaseVertex);
+  }
+
+  CopyIndices(reinterpret_cast<const unsigned char*>(src32.data()), kCount,
+              sizeof(uint32_t), 0, dst.data());
+  EXPECT_EQ(dst, src32);
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
@@ -0,0 +1,210 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#ifdef __EMSCRIPTEN__
+#include <GLES3/gl3.h>
+#else
+#include <GL/glew.h>
+#endif
+#include <GLFW/glfw3.h>
+#include <async-scene-loader.h>
+#include <gltf-scene-importer.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+namespace Mgtt::Rendering::Test {
+
+/**
+ * @brief Importer whose Load() runs until it is cancelled.
+ */
+class BlockingSceneImporter : public Mgtt::Rendering::ISceneImporter {
+ public:
+  Mgtt::Common::Result<void> Load(Mgtt::Rendering::Scene& scene,
+                                  std::string_view path) override {
+    scene.path = std::string(path);
+    while (ReportProgress(0.5f)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return Mgtt::Common::Result<void>::Err("Load cancelled: " + scene.path);
+  }
+
+  void Clear(Mgtt::Rendering::Scene& scene) noexcept override {
+    scene.Clear();
+  }
+};
+
+class AsyncSceneLoaderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (!glfwInit()) {
+      GTEST_SKIP() << "glfwInit failed — skipping GL test";
+    }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#else
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+#endif
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    window = glfwCreateWindow(800, 600, "test-window", nullptr, nullptr);
+    if (!window) {
+      glfwTerminate();
+      GTEST_SKIP() << "glfwCreateWindow failed — skipping GL test";
+    }
+
+    glfwMakeContextCurrent(window);
+
+    if (glewInit() != GLEW_OK) {
+      glfwDestroyWindow(window);
+      window = nullptr;
+      glfwTerminate();
+      GTEST_SKIP() << "glewInit failed — skipping GL test";
+    }
+
+    ASSERT_TRUE(shader.Compile(shaderPaths).ok());
+  }
+
+  void TearDown() override {
+    if (window) {
+      shader.Clear();
+      glfwDestroyWindow(window);
+      window = nullptr;
+      glfwTerminate();
+    }
+  }
+
+  /**
+   * @brief Poll until the running load is collected or a timeout elapses.
+   */
+  Mgtt::Common::Result<bool> WaitForLoad(
+      Mgtt::Rendering::AsyncSceneLoader& loader,
+      Mgtt::Rendering::Scene& scene) {
+    const auto kDeadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (!loader.IsFinished() &&
+           std::chrono::steady_clock::now() < kDeadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return loader.Poll(scene);
+  }
+
+  GLFWwindow* window{nullptr};
+  Mgtt::Rendering::OpenGlShader shader;
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+};
+
+TEST_F(AsyncSceneLoaderTest, LoadInBackground) {
+  RecordProperty("Test Description",
+                 "A glTF scene loaded on the worker thread is handed over "
+                 "by Poll");
+  RecordProperty("Expected Result",
+                 "Poll returns Ok(true), scene holds nodes and the shader");
+
+  Mgtt::Rendering::GltfSceneImporter importer;
+  Mgtt::Rendering::AsyncSceneLoader loader;
+  const uint32_t kProgramId = shader.GetProgramId();
+  ASSERT_TRUE(loader
+                  .Start(importer,
+                         "assets/scenes/water-bottle/WaterBottle.gltf",
+                         std::move(shader))
+                  .ok());
+  EXPECT_TRUE(loader.IsLoading());
+
+  Mgtt::Rendering::Scene scene;
+  const auto kResult = WaitForLoad(loader, scene);
+  ASSERT_TRUE(kResult.ok()) << kResult.error();
+  EXPECT_TRUE(kResult.value());
+  EXPECT_FALSE(loader.IsLoading());
+  EXPECT_FLOAT_EQ(loader.GetProgress(), 1.0f);
+  EXPECT_FALSE(scene.nodes.empty());
+  EXPECT_FALSE(scene.textureMap.empty());
+  EXPECT_EQ(scene.shader.GetProgramId(), kProgramId);
+  EXPECT_EQ(scene.path, "assets/scenes/water-bottle/WaterBottle.gltf");
+
+  importer.Clear(scene);
+}
+
+TEST_F(AsyncSceneLoaderTest, PollWithoutLoad) {
+  RecordProperty("Test Description", "Poll before Start reports nothing");
+  RecordProperty("Expected Result", "Ok(false), scene untouched");
+
+  Mgtt::Rendering::AsyncSceneLoader loader;
+  Mgtt::Rendering::Scene scene;
+  const auto kResult = loader.Poll(scene);
+
+  ASSERT_TRUE(kResult.ok());
+  EXPECT_FALSE(kResult.value());
+  EXPECT_FALSE(loader.IsLoading());
+}
+
+TEST_F(AsyncSceneLoaderTest, CancelLoad) {
+  RecordProperty("Test Description",
+                 "Cancel stops a running load and Poll reports the error");
+  RecordProperty("Expected Result",
+                 "Poll returns Err, the target scene stays empty");
+
+  BlockingSceneImporter importer;
+  Mgtt::Rendering::AsyncSceneLoader loader;
+  ASSERT_TRUE(loader.Start(importer, "blocking.gltf", std::move(shader)).ok());
+
+  // Wait until the importer reports progress, then cancel it
+  while (loader.GetProgress() < 0.5f) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_FALSE(loader.IsFinished());
+  loader.Cancel();
+
+  Mgtt::Rendering::Scene scene;
+  const auto kResult = WaitForLoad(loader, scene);
+  EXPECT_TRUE(kResult.err());
+  EXPECT_FALSE(loader.IsLoading());
+  EXPECT_TRUE(scene.path.empty());
+  EXPECT_EQ(scene.shader.GetProgramId(), 0u);
+}
+
+TEST_F(AsyncSceneLoaderTest, StartWithoutShader) {
+  RecordProperty("Test Description",
+                 "Start refuses a shader that was not compiled");
+  RecordProperty("Expected Result", "Result::err() is true, nothing runs");
+
+  Mgtt::Rendering::GltfSceneImporter importer;
+  Mgtt::Rendering::AsyncSceneLoader loader;
+  const auto kResult =
+      loader.Start(importer, "assets/scenes/water-bottle/WaterBottle.gltf",
+                   Mgtt::Rendering::OpenGlShader());
+
+  EXPECT_TRUE(kResult.err());
+  EXPECT_FALSE(loader.IsLoading());
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
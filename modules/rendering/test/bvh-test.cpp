@@ -0,0 +1,231 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <bvh.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <glm/gtc/matrix_transform.hpp>
+#include <memory>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class BvhTest : public ::testing::Test {
+ protected:
+  /**
+   * @brief Unit boxes on a cells^3 grid with spacing 2, centered at 0.
+   */
+  static std::vector<Mgtt::Rendering::BvhItem> MakeGrid(uint32_t cells) {
+    std::vector<Mgtt::Rendering::BvhItem> items;
+    const float kOffset = static_cast<float>(cells - 1);
+    for (uint32_t x = 0; x < cells; ++x) {
+      for (uint32_t y = 0; y < cells; ++y) {
+        for (uint32_t z = 0; z < cells; ++z) {
+          const glm::vec3 kCenter =
+              glm::vec3(static_cast<float>(x), static_cast<float>(y),
+                        static_cast<float>(z)) *
+                  2.0f -
+              glm::vec3(kOffset);
+          auto& item = items.emplace_back();
+          item.bounds.min = kCenter - glm::vec3(0.5f);
+          item.bounds.max = kCenter + glm::vec3(0.5f);
+          item.primitive = static_cast<uint32_t>(items.size() - 1);
+        }
+      }
+    }
+    return items;
+  }
+
+  /**
+   * @brief Items intersecting the frustum, tested one by one.
+   */
+  static std::vector<uint32_t> BruteForce(
+      const std::vector<Mgtt::Rendering::BvhItem>& items,
+      const Mgtt::Rendering::FrustumPlanes& planes) {
+    std::vector<uint32_t> visible;
+    for (size_t idx = 0; idx < items.size(); ++idx) {
+      const auto& bounds = items[idx].bounds;
+      bool inside = true;
+      for (const auto& plane : planes) {
+        const glm::vec3 kFar(plane.x >= 0.0f ? bounds.max.x : bounds.min.x,
+                             plane.y >= 0.0f ? bounds.max.y : bounds.min.y,
+                             plane.z >= 0.0f ? bounds.max.z : bounds.min.z);
+        inside = inside && glm::dot(glm::vec3(plane), kFar) + plane.w >= 0.0f;
+      }
+      if (inside) {
+        visible.push_back(static_cast<uint32_t>(idx));
+      }
+    }
+    return visible;
+  }
+
+  /**
+   * @brief Every item is in exactly one leaf and every child follows its
+   * parent and lies within its bounds.
+   */
+  static void ExpectValidTree(const Mgtt::Rendering::Bvh& bvh) {
+    const auto& nodes = bvh.GetNodes();
+    std::vector<uint32_t> seen(bvh.Size(), 0);
+    for (size_t idx = 0; idx < nodes.size(); ++idx) {
+      const auto& node = nodes[idx];
+      if (node.count > 0) {
+        EXPECT_LE(node.first + node.count, bvh.Size());
+        seen[node.first] += node.count;
+        continue;
+      }
+      ASSERT_GT(node.first, idx);
+      ASSERT_LT(node.first + 1, nodes.size());
+      for (uint32_t child = node.first; child <= node.first + 1; ++child) {
+        EXPECT_TRUE(glm::all(glm::lessThanEqual(node.min, nodes[child].min)));
+        EXPECT_TRUE(
+            glm::all(glm::greaterThanEqual(node.max, nodes[child].max)));
+      }
+    }
+    // Leaf ranges tile the item order without gaps or overlaps
+    size_t covered = 0;
+    for (size_t pos = 0; pos < seen.size(); pos += seen[pos]) {
+      ASSERT_GT(seen[pos], 0u) << pos;
+      covered += seen[pos];
+    }
+    EXPECT_EQ(covered, bvh.Size());
+  }
+
+  // Clip transform scaled by 1/10: the frustum is the cube [-10, 10]^3
+  const Mgtt::Rendering::FrustumPlanes kPlanes =
+      Mgtt::Rendering::ExtractFrustumPlanes(
+          glm::scale(glm::mat4(1.0f), glm::vec3(0.1f)));
+};
+
+TEST_F(BvhTest, QueryFrustumMatchesBruteForce) {
+  RecordProperty("Test Description",
+                 "Build over 27000 boxes on one and on four threads and "
+                 "query a frustum");
+  RecordProperty("Expected Result",
+                 "Both trees are valid and return the same items as testing "
+                 "every box");
+
+  const auto kItems = MakeGrid(30);
+  const auto kExpected = BruteForce(kItems, kPlanes);
+  ASSERT_FALSE(kExpected.empty());
+  ASSERT_LT(kExpected.size(), kItems.size());
+
+  for (const uint32_t kThreads : {1u, 4u}) {
+    Bvh bvh;
+    bvh.Build(kItems, kThreads);
+    ASSERT_EQ(bvh.Size(), kItems.size());
+    ExpectValidTree(bvh);
+
+    std::vector<uint32_t> visible;
+    bvh.QueryFrustum(kPlanes, visible);
+    std::sort(visible.begin(), visible.end());
+    EXPECT_EQ(visible, kExpected) << kThreads << " threads";
+  }
+}
+
+TEST_F(BvhTest, RefitMovedItems) {
+  RecordProperty("Test Description",
+                 "Move every box out of the frustum and refit");
+  RecordProperty("Expected Result",
+                 "The query follows the new bounds, a refit with a different "
+                 "item count fails");
+
+  auto items = MakeGrid(8);
+  Bvh bvh;
+  bvh.Build(items);
+  std::vector<uint32_t> visible;
+  bvh.QueryFrustum(kPlanes, visible);
+  EXPECT_EQ(visible.size(), items.size());
+
+  for (auto& item : items) {
+    item.bounds.min.x += 100.0f;
+    item.bounds.max.x += 100.0f;
+  }
+  ASSERT_TRUE(bvh.Refit(items).ok());
+  ExpectValidTree(bvh);
+  bvh.QueryFrustum(kPlanes, visible);
+  EXPECT_TRUE(visible.empty());
+  EXPECT_GT(bvh.GetNodes()[0].min.x, 80.0f);
+
+  items.pop_back();
+  EXPECT_TRUE(bvh.Refit(items).err());
+}
+
+TEST_F(BvhTest, RaycastClosestItem) {
+  RecordProperty("Test Description",
+                 "Cast rays along and past a grid of boxes");
+  RecordProperty("Expected Result",
+                 "The first box along the ray is hit, rays that miss or end "
+                 "early hit nothing");
+
+  const auto kItems = MakeGrid(10);
+  Bvh bvh;
+  bvh.Build(kItems);
+
+  // Row y = -9, z = -9 starts at x = -9.5
+  const auto kHit = bvh.Raycast(glm::vec3(-20.0f, -9.0f, -9.0f),
+                                glm::vec3(1.0f, 0.0f, 0.0f));
+  ASSERT_TRUE(kHit.has_value());
+  EXPECT_NEAR(kHit->distance, 10.5f, 1.0e-4f);
+  EXPECT_EQ(kHit->item, 0u);
+
+  EXPECT_FALSE(bvh.Raycast(glm::vec3(-20.0f, -9.0f, -9.0f),
+                           glm::vec3(1.0f, 0.0f, 0.0f), 5.0f)
+                   .has_value());
+  // Between two rows of boxes
+  EXPECT_FALSE(bvh.Raycast(glm::vec3(-20.0f, -8.0f, -9.0f),
+                           glm::vec3(1.0f, 0.0f, 0.0f))
+                   .has_value());
+  EXPECT_FALSE(Bvh().Raycast(glm::vec3(0.0f), glm::vec3(1.0f)).has_value());
+}
+
+TEST_F(BvhTest, CollectItemsFromBatches) {
+  RecordProperty("Test Description",
+                 "Collect items of a batch with two instances and a "
+                 "primitive without bounds");
+  RecordProperty("Expected Result",
+                 "One item per bounded primitive and instance, bounds in "
+                 "world space");
+
+  std::vector<Mgtt::Rendering::InstanceBatch> batches(1);
+  auto& batch = batches[0];
+  batch.mesh = std::make_shared<Mgtt::Rendering::Mesh>();
+  batch.mesh->meshPrimitives.emplace_back();
+  batch.mesh->meshPrimitives[0].aabb.min = glm::vec3(-1.0f);
+  batch.mesh->meshPrimitives[0].aabb.max = glm::vec3(1.0f);
+  batch.mesh->meshPrimitives.emplace_back();
+  batch.instanceMatrices = {
+      glm::mat4(1.0f),
+      glm::translate(glm::mat4(1.0f), glm::vec3(5.0f, 0.0f, 0.0f))};
+
+  const auto kItems = CollectBvhItems(batches);
+  ASSERT_EQ(kItems.size(), 2u);
+  EXPECT_EQ(kItems[1].batch, 0u);
+  EXPECT_EQ(kItems[1].primitive, 0u);
+  EXPECT_EQ(kItems[1].instance, 1u);
+  EXPECT_FLOAT_EQ(kItems[1].bounds.min.x, 4.0f);
+  EXPECT_FLOAT_EQ(kItems[1].bounds.max.x, 6.0f);
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
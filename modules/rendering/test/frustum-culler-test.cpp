@@ -0,0 +1,181 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <frustum-culler.h>
+#include <gtest/gtest.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <memory>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class FrustumCullerTest : public ::testing::Test {
+ protected:
+  /**
+   * @brief Batch of a mesh with one unit box primitive per center.
+   */
+  static Mgtt::Rendering::InstanceBatch MakeBatch(
+      const std::vector<glm::vec3>& centers,
+      const std::vector<glm::mat4>& instanceMatrices) {
+    Mgtt::Rendering::InstanceBatch batch;
+    batch.mesh = std::make_shared<Mgtt::Rendering::Mesh>();
+    for (const auto& center : centers) {
+      Mgtt::Rendering::MeshPrimitive prim;
+      prim.aabb.min = center - glm::vec3(0.5f);
+      prim.aabb.max = center + glm::vec3(0.5f);
+      batch.mesh->meshPrimitives.push_back(std::move(prim));
+    }
+    batch.instanceMatrices = instanceMatrices;
+    return batch;
+  }
+
+  // Identity clip transform: the frustum is the cube [-1, 1]^3
+  const Mgtt::Rendering::FrustumPlanes kPlanes =
+      Mgtt::Rendering::ExtractFrustumPlanes(glm::mat4(1.0f));
+};
+
+TEST_F(FrustumCullerTest, CullPrimitivesOutsideFrustum) {
+  RecordProperty("Test Description",
+                 "Cull seven boxes along x, more than one SIMD block");
+  RecordProperty("Expected Result",
+                 "Boxes touching the frustum are visible, the rest culled");
+
+  std::vector<Mgtt::Rendering::InstanceBatch> batches;
+  batches.push_back(MakeBatch({{-6.0f, 0.0f, 0.0f},
+                               {-3.0f, 0.0f, 0.0f},
+                               {-1.25f, 0.0f, 0.0f},
+                               {0.0f, 0.0f, 0.0f},
+                               {1.25f, 0.0f, 0.0f},
+                               {0.0f, 3.0f, 0.0f},
+                               {0.0f, 0.0f, -3.0f}},
+                              {glm::mat4(1.0f)}));
+
+  FrustumCuller culler;
+  culler.Build(batches);
+  ASSERT_EQ(culler.Size(), 7u);
+  EXPECT_EQ(culler.GetStats().visible, 7u);
+
+  const auto kStats = culler.Cull(kPlanes);
+  EXPECT_EQ(kStats.visible, 3u);
+  EXPECT_EQ(kStats.culled, 4u);
+  EXPECT_EQ(culler.GetStats().culled, 4u);
+  const std::vector<bool> kExpected = {false, false, true, true,
+                                       true,  false, false};
+  for (size_t draw = 0; draw < kExpected.size(); ++draw) {
+    EXPECT_EQ(culler.IsVisible(draw), kExpected[draw]) << draw;
+  }
+  EXPECT_TRUE(culler.IsBatchVisible(0));
+}
+
+TEST_F(FrustumCullerTest, BoundInstancesAndBatches) {
+  RecordProperty("Test Description",
+                 "Cull two batches, one with an instance inside the "
+                 "frustum and one moved out of it");
+  RecordProperty("Expected Result",
+                 "Draw bounds cover all instances, the moved batch is "
+                 "culled as a whole");
+
+  const glm::mat4 kFar =
+      glm::translate(glm::mat4(1.0f), glm::vec3(10.0f, 0.0f, 0.0f));
+  std::vector<Mgtt::Rendering::InstanceBatch> batches;
+  batches.push_back(
+      MakeBatch({{0.0f, 0.0f, 0.0f}, {0.0f, 5.0f, 0.0f}}, {kFar,
+                                                          glm::mat4(1.0f)}));
+  batches.push_back(MakeBatch({{0.0f, 0.0f, 0.0f}}, {kFar}));
+
+  FrustumCuller culler;
+  culler.Build(batches);
+  ASSERT_EQ(culler.Size(), 3u);
+  EXPECT_EQ(culler.GetFirstDraw(0), 0u);
+  EXPECT_EQ(culler.GetFirstDraw(1), 2u);
+  EXPECT_EQ(culler.GetBounds(0).min.x, -0.5f);
+  EXPECT_EQ(culler.GetBounds(0).max.x, 10.5f);
+
+  const auto kStats = culler.Cull(kPlanes);
+  EXPECT_EQ(kStats.visible, 1u);
+  EXPECT_TRUE(culler.IsVisible(0));
+  EXPECT_FALSE(culler.IsVisible(1));
+  EXPECT_FALSE(culler.IsVisible(2));
+  EXPECT_TRUE(culler.IsBatchVisible(0));
+  EXPECT_FALSE(culler.IsBatchVisible(1));
+}
+
+TEST_F(FrustumCullerTest, KeepPrimitivesWithoutBounds) {
+  RecordProperty("Test Description",
+                 "Cull a primitive whose AABB was never computed");
+  RecordProperty("Expected Result", "The primitive is always visible");
+
+  std::vector<Mgtt::Rendering::InstanceBatch> batches;
+  batches.push_back(MakeBatch({}, {glm::mat4(1.0f)}));
+  batches[0].mesh->meshPrimitives.emplace_back();
+
+  FrustumCuller culler;
+  culler.Build(batches);
+  ASSERT_EQ(culler.Size(), 1u);
+  EXPECT_EQ(culler.Cull(kPlanes).visible, 1u);
+
+  culler.Clear();
+  EXPECT_EQ(culler.Size(), 0u);
+  EXPECT_EQ(culler.Cull(kPlanes).visible, 0u);
+}
+
+TEST_F(FrustumCullerTest, CullOccludedPrimitives) {
+  RecordProperty("Test Description",
+                 "Cull two boxes, one behind a rasterized wall and one "
+                 "beside it");
+  RecordProperty("Expected Result",
+                 "The hidden box is counted as occluded, not as culled");
+
+  std::vector<Mgtt::Rendering::InstanceBatch> batches;
+  batches.push_back(MakeBatch({{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}},
+                              {glm::mat4(1.0f)}));
+  batches[0].mesh->meshPrimitives[0].aabb.min = glm::vec3(-0.1f, -0.1f, 0.5f);
+  batches[0].mesh->meshPrimitives[0].aabb.max = glm::vec3(0.1f, 0.1f, 0.7f);
+  batches[0].mesh->meshPrimitives[1].aabb.min = glm::vec3(0.7f, 0.7f, 0.5f);
+  batches[0].mesh->meshPrimitives[1].aabb.max = glm::vec3(0.9f, 0.9f, 0.7f);
+
+  Mgtt::Rendering::Mesh wall;
+  wall.vertexPositionAttribs = {{-0.5f, -0.5f, 0.0f},
+                                {0.5f, -0.5f, 0.0f},
+                                {0.5f, 0.5f, 0.0f},
+                                {-0.5f, 0.5f, 0.0f}};
+  wall.indices = {0, 1, 2, 0, 2, 3};
+  OcclusionCuller occlusion;
+  occlusion.BeginFrame(glm::mat4(1.0f));
+  occlusion.AddOccluder(wall, 0, 6, glm::mat4(1.0f));
+  occlusion.Rasterize();
+
+  FrustumCuller culler;
+  culler.Build(batches);
+  EXPECT_EQ(culler.Cull(kPlanes).visible, 2u);
+  const auto kStats = culler.CullOccluded(occlusion);
+  EXPECT_EQ(kStats.visible, 1u);
+  EXPECT_EQ(kStats.culled, 0u);
+  EXPECT_EQ(kStats.occluded, 1u);
+  EXPECT_FALSE(culler.IsVisible(0));
+  EXPECT_TRUE(culler.IsVisible(1));
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
@@ -0,0 +1,121 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <glb-json.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class GlbJsonTest : public ::testing::Test {};
+
+TEST_F(GlbJsonTest, DetachBinChunk) {
+  RecordProperty("Test Description",
+                 "The GLB-stored buffer and embedded images are redirected "
+                 "to one-byte placeholders");
+  RecordProperty("Expected Result",
+                 "Buffer 0 becomes a data URI, image bufferViews point at "
+                 "an appended view and are reported in source order");
+
+  const std::string kJson =
+      R"({"asset":{"version":"2.0"},"buffers":[{"byteLength":64}],)"
+      R"("bufferViews":[{"buffer":0,"byteLength":32},)"
+      R"({"buffer":0,"byteOffset":32,"byteLength":32}],)"
+      R"("images":[{"bufferView" : 1,"mimeType":"image/png"},)"
+      R"({"uri":"a.png"}]}   )";
+
+  const auto result = Mgtt::Rendering::DetachGlbBinChunk(kJson);
+  ASSERT_TRUE(result.ok()) << result.error();
+  const auto& detached = result.value();
+
+  EXPECT_TRUE(detached.detached);
+  EXPECT_EQ(detached.imageBufferViews, (std::vector<int>{1, -1}));
+  EXPECT_EQ(detached.placeholderView, 2);
+  EXPECT_EQ(
+      detached.json,
+      R"({"asset":{"version":"2.0"},"buffers":[{"byteLength":1,)"
+      R"("uri":"data:application/octet-stream;base64,AA=="}],)"
+      R"("bufferViews":[{"buffer":0,"byteLength":32},)"
+      R"({"buffer":0,"byteOffset":32,"byteLength":32},)"
+      R"({"buffer":0,"byteLength":1}],)"
+      R"("images":[{"bufferView" : 2,"mimeType":"image/png"},)"
+      R"({"uri":"a.png"}]}   )");
+}
+
+TEST_F(GlbJsonTest, DetachWithoutImages) {
+  RecordProperty("Test Description",
+                 "Documents without embedded images get no placeholder "
+                 "view; strings holding brackets and quotes are skipped");
+  RecordProperty("Expected Result",
+                 "Only buffer 0 is replaced, placeholderView is -1");
+
+  const std::string kJson =
+      R"({"nodes":[{"name":"a]}\"{["}],"buffers":[{"byteLength":4,)"
+      R"("name":"bin"},{"uri":"b.bin","byteLength":8}]})";
+
+  const auto result = Mgtt::Rendering::DetachGlbBinChunk(kJson);
+  ASSERT_TRUE(result.ok()) << result.error();
+
+  EXPECT_TRUE(result.value().detached);
+  EXPECT_TRUE(result.value().imageBufferViews.empty());
+  EXPECT_EQ(result.value().placeholderView, -1);
+  EXPECT_EQ(result.value().json,
+            R"({"nodes":[{"name":"a]}\"{["}],"buffers":[{"byteLength":1,)"
+            R"("uri":"data:application/octet-stream;base64,AA=="},)"
+            R"({"uri":"b.bin","byteLength":8}]})");
+}
+
+TEST_F(GlbJsonTest, KeepExternalBuffer) {
+  RecordProperty("Test Description",
+                 "A first buffer with a URI is not stored in the BIN chunk");
+  RecordProperty("Expected Result",
+                 "detached is false and the document is unchanged");
+
+  const std::string kJson =
+      R"({"buffers":[{"uri":"a.bin","byteLength":4}],)"
+      R"("bufferViews":[{"buffer":0,"byteLength":4}],)"
+      R"("images":[{"bufferView":0,"mimeType":"image/png"}]})";
+
+  const auto result = Mgtt::Rendering::DetachGlbBinChunk(kJson);
+  ASSERT_TRUE(result.ok()) << result.error();
+
+  EXPECT_FALSE(result.value().detached);
+  EXPECT_EQ(result.value().json, kJson);
+}
+
+TEST_F(GlbJsonTest, RejectMalformedJson) {
+  RecordProperty("Test Description",
+                 "Truncated or non-object chunks are rejected");
+  RecordProperty("Expected Result", "Result::err() is true");
+
+  for (const char* kJson :
+       {"", "[]", R"({"buffers":[{"byteLength":4})", R"({"buffers" 1})",
+        R"({"images":[{"bufferView":0}],"buffers":[{"byteLength":4}]})"}) {
+    EXPECT_TRUE(Mgtt::Rendering::DetachGlbBinChunk(kJson).err()) << kJson;
+  }
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
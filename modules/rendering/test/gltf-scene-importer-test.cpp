@@ -29,13 +29,249 @@
 #include <GLFW/glfw3.h>
 #include <gltf-scene-importer.h>
 #include <gtest/gtest.h>
+#include <scene-cache.h>
 #include <scene-uploader.h>
 
-#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
 
 namespace Mgtt::Rendering::Test {
 
+/**
+ * @brief Base64-encode bytes for a glTF data URI.
+ */
+static std::string EncodeBase64(const std::vector<unsigned char>& bytes) {
+  static constexpr char kAlphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string encoded;
+  encoded.reserve((bytes.size() + 2) / 3 * 4);
+  for (size_t idx = 0; idx < bytes.size(); idx += 3) {
+    const size_t kRemaining = bytes.size() - idx;
+    const uint32_t kChunk =
+        (uint32_t{bytes[idx]} << 16) |
+        (kRemaining > 1 ? uint32_t{bytes[idx + 1]} << 8 : 0) |
+        (kRemaining > 2 ? uint32_t{bytes[idx + 2]} : 0);
+    encoded += kAlphabet[(kChunk >> 18) & 0x3F];
+    encoded += kAlphabet[(kChunk >> 12) & 0x3F];
+    encoded += kRemaining > 1 ? kAlphabet[(kChunk >> 6) & 0x3F] : '=';
+    encoded += kRemaining > 2 ? kAlphabet[kChunk & 0x3F] : '=';
+  }
+  return encoded;
+}
+
+/**
+ * @brief Write a self-contained GLB holding a single indexed triangle.
+ *
+ * If an encoded image is given, the triangle gets a material that uses it
+ * twice: once from a bufferView and once as a base64 data URI. nodeCount
+ * root nodes all reference the triangle, node i translated by (2i, 0, 0).
+ * binPadding zero bytes no view references are appended to the BIN chunk.
+ */
+static void WriteTriangleGlb(const std::string& path,
+                             const std::vector<unsigned char>& image = {},
+                             size_t nodeCount = 1, size_t binPadding = 0) {
+  const float kPositions[] = {0, 0, 0, 1, 0, 0, 0, 1, 0};
+  const uint16_t kIndices[] = {0, 1, 2, 0};  // last entry pads to 4 bytes
+
+  std::vector<unsigned char> bin(sizeof(kPositions) + sizeof(kIndices));
+  std::memcpy(bin.data(), kPositions, sizeof(kPositions));
+  std::memcpy(bin.data() + sizeof(kPositions), kIndices, sizeof(kIndices));
+  const size_t kImageOffset = bin.size();
+  bin.insert(bin.end(), image.begin(), image.end());
+  bin.resize((bin.size() + 3) & ~size_t{3}, 0);
+  binPadding &= ~size_t{3};
+
+  const bool kHasImage = !image.empty();
+  std::string sceneNodes;
+  std::string nodes;
+  for (size_t idx = 0; idx < nodeCount; ++idx) {
+    sceneNodes += (idx > 0 ? "," : "") + std::to_string(idx);
+    nodes += idx > 0 ? "," : "";
+    nodes += R"({"mesh":0,"translation":[)" + std::to_string(2 * idx) +
+             ",0,0]}";
+  }
+
+  std::string json = R"({"asset":{"version":"2.0"},"scene":0,"scenes":)"
+                     R"([{"nodes":[)" +
+                     sceneNodes + R"(]}],"nodes":[)" + nodes +
+                     R"(],"meshes":[{"primitives":[{"attributes":)"
+                     R"({"POSITION":0},"indices":1)";
+  json += kHasImage ? R"(,"material":0}]}],)" : "}]}],";
+  json += R"("buffers":[{"byteLength":)" +
+          std::to_string(bin.size() + binPadding) +
+          R"(}],"bufferViews":[{"buffer":0,"byteLength":36},)"
+          R"({"buffer":0,"byteOffset":36,"byteLength":6})";
+  if (kHasImage) {
+    json += R"(,{"buffer":0,"byteOffset":)" + std::to_string(kImageOffset) +
+            R"(,"byteLength":)" + std::to_string(image.size()) + "}";
+  }
+  json +=
+      R"(],"accessors":[)"
+      R"({"bufferView":0,"componentType":5126,"count":3,"type":"VEC3",)"
+      R"("min":[0,0,0],"max":[1,1,0]},)"
+      R"({"bufferView":1,"componentType":5123,"count":3,"type":"SCALAR"}])";
+  if (kHasImage) {
+    json += R"(,"images":[{"bufferView":2,"mimeType":"image/png"},)"
+            R"({"uri":"data:image/png;base64,)" +
+            EncodeBase64(image) +
+            R"("}],"textures":[{"source":0},{"source":1}],)"
+            R"("materials":[{"pbrMetallicRoughness":)"
+            R"({"baseColorTexture":{"index":0}},)"
+            R"("emissiveTexture":{"index":1}}])";
+  }
+  json += "}";
+  json.resize((json.size() + 3) & ~size_t{3}, ' ');
+
+  auto writeU32 = [](std::ofstream& file, uint32_t value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+  std::ofstream file(path, std::ios::binary);
+  writeU32(file, 0x46546C67);
+  writeU32(file, 2);
+  writeU32(file, static_cast<uint32_t>(12 + 8 + json.size() + 8 + bin.size() +
+                                       binPadding));
+  writeU32(file, static_cast<uint32_t>(json.size()));
+  writeU32(file, 0x4E4F534A);
+  file.write(json.data(), static_cast<std::streamsize>(json.size()));
+  writeU32(file, static_cast<uint32_t>(bin.size() + binPadding));
+  writeU32(file, 0x004E4942);
+  file.write(reinterpret_cast<const char*>(bin.data()),
+             static_cast<std::streamsize>(bin.size()));
+  // Written in blocks so the padding never sits in memory as a whole
+  const std::vector<char> kZeros(size_t{1} << 20, 0);
+  while (binPadding > 0) {
+    const size_t kBlock = std::min(binPadding, kZeros.size());
+    file.write(kZeros.data(), static_cast<std::streamsize>(kBlock));
+    binPadding -= kBlock;
+  }
+}
+
+/**
+ * @brief Peak resident set size of the process in KiB, 0 where the
+ * platform does not report it.
+ */
+static int64_t PeakRssKiB() {
+#ifdef _WIN32
+  return 0;
+#else
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  // Reported in bytes on macOS, in KiB elsewhere
+  return static_cast<int64_t>(usage.ru_maxrss) / 1024;
+#else
+  return static_cast<int64_t>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+/**
+ * @brief Write a .gltf with an embedded buffer holding a single triangle
+ * placed instanceCount times via EXT_mesh_gpu_instancing, instance i
+ * translated by (3i, 0, 0). A non-zero accessorCount overrides the count
+ * the TRANSLATION accessor declares.
+ */
+static void WriteInstancedTriangleGltf(const std::string& path,
+                                       size_t instanceCount,
+                                       size_t accessorCount = 0) {
+  const float kPositions[] = {0, 0, 0, 1, 0, 0, 0, 1, 0};
+  const uint16_t kIndices[] = {0, 1, 2, 0};  // last entry pads to 4 bytes
+
+  std::vector<unsigned char> bin(sizeof(kPositions) + sizeof(kIndices));
+  std::memcpy(bin.data(), kPositions, sizeof(kPositions));
+  std::memcpy(bin.data() + sizeof(kPositions), kIndices, sizeof(kIndices));
+  const size_t kTranslationOffset = bin.size();
+  for (size_t idx = 0; idx < instanceCount; ++idx) {
+    const float kTranslation[] = {3.0f * static_cast<float>(idx), 0, 0};
+    const auto* bytes = reinterpret_cast<const unsigned char*>(kTranslation);
+    bin.insert(bin.end(), bytes, bytes + sizeof(kTranslation));
+  }
+
+  const std::string json =
+      R"({"asset":{"version":"2.0"},)"
+      R"("extensionsUsed":["EXT_mesh_gpu_instancing"],"scene":0,)"
+      R"("scenes":[{"nodes":[0]}],"nodes":[{"mesh":0,"extensions":)"
+      R"({"EXT_mesh_gpu_instancing":{"attributes":{"TRANSLATION":2}}}}],)"
+      R"("meshes":[{"primitives":[{"attributes":{"POSITION":0},)"
+      R"("indices":1}]}],"buffers":[{"byteLength":)" +
+      std::to_string(bin.size()) +
+      R"(,"uri":"data:application/octet-stream;base64,)" +
+      EncodeBase64(bin) +
+      R"("}],"bufferViews":[{"buffer":0,"byteLength":36},)"
+      R"({"buffer":0,"byteOffset":36,"byteLength":6},)"
+      R"({"buffer":0,"byteOffset":)" +
+      std::to_string(kTranslationOffset) + R"(,"byteLength":)" +
+      std::to_string(bin.size() - kTranslationOffset) +
+      R"(}],"accessors":[)"
+      R"({"bufferView":0,"componentType":5126,"count":3,"type":"VEC3",)"
+      R"("min":[0,0,0],"max":[1,1,0]},)"
+      R"({"bufferView":1,"componentType":5123,"count":3,"type":"SCALAR"},)"
+      R"({"bufferView":2,"componentType":5126,"count":)" +
+      std::to_string(accessorCount > 0 ? accessorCount : instanceCount) +
+      R"(,"type":"VEC3"}]})";
+
+  std::ofstream file(path);
+  file << json;
+}
+
+/**
+ * @brief Write a .gltf with an embedded buffer holding a single triangle
+ * plus one extra float vertex attribute of the given accessor type with
+ * attributeCount elements, which need not match the three positions.
+ */
+static void WriteTriangleAttributeGltf(const std::string& path,
+                                       const std::string& attribute,
+                                       const std::string& type,
+                                       size_t components,
+                                       size_t attributeCount) {
+  const float kPositions[] = {0, 0, 0, 1, 0, 0, 0, 1, 0};
+  const uint16_t kIndices[] = {0, 1, 2, 0};  // last entry pads to 4 bytes
+
+  std::vector<unsigned char> bin(sizeof(kPositions) + sizeof(kIndices));
+  std::memcpy(bin.data(), kPositions, sizeof(kPositions));
+  std::memcpy(bin.data() + sizeof(kPositions), kIndices, sizeof(kIndices));
+  const size_t kAttributeOffset = bin.size();
+  const size_t kAttributeBytes = attributeCount * components * sizeof(float);
+  bin.resize(bin.size() + kAttributeBytes, 0);
+
+  const std::string json =
+      R"({"asset":{"version":"2.0"},"scene":0,)"
+      R"("scenes":[{"nodes":[0]}],"nodes":[{"mesh":0}],)"
+      R"("meshes":[{"primitives":[{"attributes":{"POSITION":0,")" +
+      attribute + R"(":2},"indices":1}]}],"buffers":[{"byteLength":)" +
+      std::to_string(bin.size()) +
+      R"(,"uri":"data:application/octet-stream;base64,)" +
+      EncodeBase64(bin) +
+      R"("}],"bufferViews":[{"buffer":0,"byteLength":36},)"
+      R"({"buffer":0,"byteOffset":36,"byteLength":6},)"
+      R"({"buffer":0,"byteOffset":)" +
+      std::to_string(kAttributeOffset) + R"(,"byteLength":)" +
+      std::to_string(kAttributeBytes) +
+      R"(}],"accessors":[)"
+      R"({"bufferView":0,"componentType":5126,"count":3,"type":"VEC3",)"
+      R"("min":[0,0,0],"max":[1,1,0]},)"
+      R"({"bufferView":1,"componentType":5123,"count":3,"type":"SCALAR"},)"
+      R"({"bufferView":2,"componentType":5126,"count":)" +
+      std::to_string(attributeCount) + R"(,"type":")" + type + R"("}]})";
+
+  std::ofstream file(path);
+  file << json;
+}
+
 class GltfSceneImporterTest : public ::testing::Test {
  public:
   static Mgtt::Rendering::Scene mgttScene;
@@ -130,7 +366,7 @@ TEST_F(GltfSceneImporterTest, LoadValidGltfFile) {
   EXPECT_EQ(mgttScene.textureMap.size(), 4u);
   ASSERT_EQ(mgttScene.nodes.size(), 1u);
 
-  const auto& meshAfterLoad = mgttScene.nodes[0]->mesh;
+  const auto& meshAfterLoad = mgttScene.nodes[0].mesh;
   ASSERT_NE(meshAfterLoad, nullptr);
   // CPU-side data is populated
   EXPECT_FALSE(meshAfterLoad->indices.empty());
@@ -148,7 +384,7 @@ TEST_F(GltfSceneImporterTest, LoadValidGltfFile) {
   const auto uploadResult = sceneUploader->Upload(mgttScene);
   ASSERT_TRUE(uploadResult.ok()) << "Upload failed: " << uploadResult.error();
 
-  const auto& meshAfterUpload = mgttScene.nodes[0]->mesh;
+  const auto& meshAfterUpload = mgttScene.nodes[0].mesh;
   EXPECT_GT(meshAfterUpload->pos, 0u);
   EXPECT_GT(meshAfterUpload->normal, 0u);
   EXPECT_GT(meshAfterUpload->tex, 0u);
@@ -163,6 +399,542 @@ TEST_F(GltfSceneImporterTest, LoadValidGltfFile) {
   EXPECT_GT(prim.pbrMaterial.emissiveTexture.id, 0u);
 }
 
+TEST_F(GltfSceneImporterTest, LoadValidGltfFileParallelTextureDecode) {
+  RecordProperty("Test Description",
+                 "Parallel texture decode yields the same textureMap as the "
+                 "serial path");
+  RecordProperty("Expected Result",
+                 "Same keys, dimensions and pixel checksums for 1 and 4 "
+                 "decode threads");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  const std::string_view kPath = "assets/scenes/water-bottle/WaterBottle.gltf";
+
+  // Summarize each texture by dimensions and a byte checksum
+  using TextureSummary = std::map<std::string, std::pair<int64_t, uint64_t>>;
+  auto loadAndSummarize = [&](uint32_t threadCount, double& elapsedMs) {
+    Mgtt::Rendering::Scene scene;
+    EXPECT_TRUE(scene.shader.Compile(shaderPaths).ok());
+    Mgtt::Rendering::GltfSceneImporter importer;
+    importer.SetTextureDecodeThreadCount(threadCount);
+
+    const auto kStart = std::chrono::steady_clock::now();
+    const auto result = importer.Load(scene, kPath);
+    elapsedMs = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - kStart)
+                    .count();
+    EXPECT_TRUE(result.ok()) << result.error();
+
+    TextureSummary summary;
+    for (auto& [uri, texture] : scene.textureMap) {
+      const size_t kBytes = static_cast<size_t>(texture.width) *
+                            static_cast<size_t>(texture.height) *
+                            static_cast<size_t>(texture.nrComponents);
+      summary[uri] = {
+          static_cast<int64_t>(texture.width) * texture.height,
+          std::accumulate(texture.data, texture.data + kBytes, uint64_t{0})};
+      stbi_image_free(texture.data);
+      texture.data = nullptr;
+    }
+    importer.Clear(scene);
+    return summary;
+  };
+
+  double serialMs = 0.0;
+  double parallelMs = 0.0;
+  const TextureSummary kSerial = loadAndSummarize(1, serialMs);
+  const TextureSummary kParallel = loadAndSummarize(4, parallelMs);
+
+  RecordProperty("Serial Decode Ms", std::to_string(serialMs));
+  RecordProperty("Parallel Decode Ms", std::to_string(parallelMs));
+
+  EXPECT_EQ(kSerial.size(), 4u);
+  EXPECT_EQ(kSerial, kParallel);
+}
+
+TEST_F(GltfSceneImporterTest, LoadMemoryMappedGlb) {
+  RecordProperty("Test Description",
+                 "The memory-mapped GLB path yields the same mesh data as "
+                 "the regular binary loader");
+  RecordProperty("Expected Result",
+                 "Result::ok() for both, identical indices and positions");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  const std::string kPath = ::testing::TempDir() + "triangle.glb";
+  WriteTriangleGlb(kPath);
+
+  auto loadMesh = [&](bool memoryMapped) {
+    Mgtt::Rendering::Scene scene;
+    EXPECT_TRUE(scene.shader.Compile(shaderPaths).ok());
+    Mgtt::Rendering::GltfSceneImporter importer;
+    importer.SetMemoryMappedGlb(memoryMapped);
+    EXPECT_EQ(importer.IsMemoryMappedGlb(), memoryMapped);
+
+    const auto result = importer.Load(scene, kPath);
+    EXPECT_TRUE(result.ok()) << result.error();
+    std::shared_ptr<Mgtt::Rendering::Mesh> mesh;
+    if (!scene.nodes.empty()) {
+      mesh = scene.nodes[0].mesh;
+    }
+    importer.Clear(scene);
+    return mesh;
+  };
+
+  const auto kMapped = loadMesh(true);
+  const auto kRead = loadMesh(false);
+  ASSERT_NE(kMapped, nullptr);
+  ASSERT_NE(kRead, nullptr);
+
+  EXPECT_EQ(kMapped->indices, (std::vector<uint32_t>{0, 1, 2}));
+  EXPECT_EQ(kMapped->indices, kRead->indices);
+  ASSERT_EQ(kMapped->vertexPositionAttribs.size(), 3u);
+  EXPECT_EQ(kMapped->vertexPositionAttribs, kRead->vertexPositionAttribs);
+  EXPECT_EQ(kMapped->vertexPositionAttribs[1], glm::vec3(1.0f, 0.0f, 0.0f));
+}
+
+TEST_F(GltfSceneImporterTest, MemoryMappedGlbFootprint) {
+  RecordProperty("Test Description",
+                 "Load time and peak RSS growth of a GLB with a 64 MiB BIN "
+                 "chunk, memory-mapped and read into the heap");
+  RecordProperty("Expected Result",
+                 "Result::ok() for both; timings and peak RSS growth are "
+                 "recorded as test properties");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  const std::string kPath = ::testing::TempDir() + "padded-triangle.glb";
+  WriteTriangleGlb(kPath, {}, 1, size_t{64} << 20);
+
+  auto measureLoad = [&](bool memoryMapped, double& elapsedMs) {
+    Mgtt::Rendering::Scene scene;
+    EXPECT_TRUE(scene.shader.Compile(shaderPaths).ok());
+    Mgtt::Rendering::GltfSceneImporter importer;
+    importer.SetMemoryMappedGlb(memoryMapped);
+
+    const int64_t kPeakBefore = PeakRssKiB();
+    const auto kStart = std::chrono::steady_clock::now();
+    const auto result = importer.Load(scene, kPath);
+    elapsedMs = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - kStart)
+                    .count();
+    EXPECT_TRUE(result.ok()) << result.error();
+    EXPECT_EQ(scene.nodes.size(), 1u);
+    importer.Clear(scene);
+    return PeakRssKiB() - kPeakBefore;
+  };
+
+  // The peak is process-wide and only ever grows, so the growth depends on
+  // the tests run before; it is recorded, not compared
+  double mappedMs = 0.0;
+  double readMs = 0.0;
+  const int64_t kMappedKiB = measureLoad(true, mappedMs);
+  const int64_t kReadKiB = measureLoad(false, readMs);
+
+  RecordProperty("Mapped Load Ms", std::to_string(mappedMs));
+  RecordProperty("Read Load Ms", std::to_string(readMs));
+  RecordProperty("Mapped Peak RSS Growth KiB", std::to_string(kMappedKiB));
+  RecordProperty("Read Peak RSS Growth KiB", std::to_string(kReadKiB));
+  std::filesystem::remove(kPath);
+}
+
+TEST_F(GltfSceneImporterTest, LoadEmbeddedImages) {
+  RecordProperty("Test Description",
+                 "bufferView and data URI images are decoded from memory");
+  RecordProperty("Expected Result",
+                 "Both images decode to the dimensions of the source PNG, "
+                 "in the regular and the memory-mapped GLB path");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  const std::string kPngPath =
+      "assets/scenes/water-bottle/WaterBottle_emissive.png";
+  const std::string kGlbPath = ::testing::TempDir() + "textured-triangle.glb";
+
+  std::ifstream pngFile(kPngPath, std::ios::binary);
+  const std::vector<unsigned char> kPng(
+      (std::istreambuf_iterator<char>(pngFile)),
+      std::istreambuf_iterator<char>());
+  ASSERT_FALSE(kPng.empty()) << "Missing " << kPngPath;
+  WriteTriangleGlb(kGlbPath, kPng);
+
+  int width = 0;
+  int height = 0;
+  int components = 0;
+  ASSERT_EQ(stbi_info_from_memory(kPng.data(), static_cast<int>(kPng.size()),
+                                  &width, &height, &components),
+            1);
+
+  for (const bool kMemoryMapped : {false, true}) {
+    Mgtt::Rendering::Scene scene;
+    ASSERT_TRUE(scene.shader.Compile(shaderPaths).ok());
+    Mgtt::Rendering::GltfSceneImporter importer;
+    importer.SetMemoryMappedGlb(kMemoryMapped);
+
+    const auto result = importer.Load(scene, kGlbPath);
+    ASSERT_TRUE(result.ok()) << result.error();
+    ASSERT_EQ(scene.textureMap.size(), 2u);
+
+    for (const char* kKey : {"#image0", "#image1"}) {
+      const auto iter = scene.textureMap.find(kKey);
+      ASSERT_NE(iter, scene.textureMap.end()) << kKey;
+      EXPECT_NE(iter->second.data, nullptr) << kKey;
+      EXPECT_EQ(iter->second.width, width) << kKey;
+      EXPECT_EQ(iter->second.height, height) << kKey;
+      EXPECT_EQ(iter->second.nrComponents, components) << kKey;
+    }
+
+    ASSERT_EQ(scene.nodes.size(), 1u);
+    const auto& prim = scene.nodes[0].mesh->meshPrimitives[0];
+    EXPECT_EQ(prim.pbrMaterial.baseColorTexture.path,
+              scene.textureMap["#image0"].path);
+    EXPECT_EQ(prim.pbrMaterial.emissiveTexture.path,
+              scene.textureMap["#image1"].path);
+
+    for (auto& [key, texture] : scene.textureMap) {
+      stbi_image_free(texture.data);
+      texture.data = nullptr;
+    }
+    importer.Clear(scene);
+  }
+}
+
+TEST_F(GltfSceneImporterTest, LoadSharedMesh) {
+  RecordProperty("Test Description",
+                 "Nodes referencing the same glTF mesh share one Mesh");
+  RecordProperty("Expected Result",
+                 "One Mesh object and one set of GL buffers, per-node world "
+                 "matrices and bounds, one instance batch");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  const std::string kPath = ::testing::TempDir() + "shared-triangle.glb";
+  WriteTriangleGlb(kPath, {}, 3);
+
+  Mgtt::Rendering::Scene scene;
+  ASSERT_TRUE(scene.shader.Compile(shaderPaths).ok());
+  const auto loadResult = gltfSceneImporter->Load(scene, kPath);
+  ASSERT_TRUE(loadResult.ok()) << loadResult.error();
+  ASSERT_EQ(scene.nodes.size(), 3u);
+
+  const auto& kMesh = scene.nodes[0].mesh;
+  ASSERT_NE(kMesh, nullptr);
+  for (size_t idx = 0; idx < scene.nodes.size(); ++idx) {
+    const auto& node = scene.nodes[idx];
+    EXPECT_EQ(node.mesh, kMesh);
+    EXPECT_FLOAT_EQ(node.worldMatrix[3][0], 2.0f * static_cast<float>(idx));
+    EXPECT_FLOAT_EQ(node.aabb.min.x, 2.0f * static_cast<float>(idx));
+  }
+  // Mesh bounds stay in mesh space
+  EXPECT_FLOAT_EQ(kMesh->aabb.min.x, 0.0f);
+  EXPECT_FLOAT_EQ(kMesh->aabb.max.x, 1.0f);
+  EXPECT_FLOAT_EQ(scene.aabb.max.x, 5.0f);
+
+  const auto uploadResult = sceneUploader->Upload(scene);
+  ASSERT_TRUE(uploadResult.ok()) << uploadResult.error();
+  EXPECT_GT(kMesh->vao, 0u);
+
+  // All three nodes end up in one instanced batch
+  ASSERT_EQ(scene.instanceBatches.size(), 1u);
+  const auto& batch = scene.instanceBatches[0];
+  EXPECT_EQ(batch.mesh, kMesh);
+  EXPECT_GT(batch.instanceVbo, 0u);
+  ASSERT_EQ(batch.instanceMatrices.size(), 3u);
+  EXPECT_FLOAT_EQ(batch.instanceMatrices[2][3][0], 4.0f);
+
+  gltfSceneImporter->Clear(scene);
+  EXPECT_TRUE(scene.instanceBatches.empty());
+}
+
+TEST_F(GltfSceneImporterTest, LoadGpuInstancingExtension) {
+  RecordProperty("Test Description",
+                 "EXT_mesh_gpu_instancing is parsed into per-node instance "
+                 "matrices and uploaded as one instance batch");
+  RecordProperty("Expected Result",
+                 "One matrix per instance, scene bounds cover all instances, "
+                 "one batch holding every instance");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  const std::string kPath = ::testing::TempDir() + "instanced-triangle.gltf";
+  constexpr size_t kInstanceCount = 100;
+  WriteInstancedTriangleGltf(kPath, kInstanceCount);
+
+  Mgtt::Rendering::Scene scene;
+  ASSERT_TRUE(scene.shader.Compile(shaderPaths).ok());
+  const auto loadResult = gltfSceneImporter->Load(scene, kPath);
+  ASSERT_TRUE(loadResult.ok()) << loadResult.error();
+  ASSERT_EQ(scene.nodes.size(), 1u);
+
+  const auto& node = scene.nodes[0];
+  ASSERT_EQ(node.instanceMatrices.size(), kInstanceCount);
+  EXPECT_FLOAT_EQ(node.instanceMatrices[1][3][0], 3.0f);
+  EXPECT_FLOAT_EQ(node.instanceMatrices[kInstanceCount - 1][3][0],
+                  3.0f * (kInstanceCount - 1));
+  EXPECT_FLOAT_EQ(scene.aabb.max.x, 3.0f * (kInstanceCount - 1) + 1.0f);
+
+  ASSERT_TRUE(sceneUploader->Upload(scene).ok());
+  ASSERT_EQ(scene.instanceBatches.size(), 1u);
+  EXPECT_EQ(scene.instanceBatches[0].instanceMatrices.size(), kInstanceCount);
+
+  gltfSceneImporter->Clear(scene);
+}
+
+TEST_F(GltfSceneImporterTest, LoadMismatchedAttributeCount) {
+  RecordProperty("Test Description",
+                 "A vertex attribute whose accessor count differs from the "
+                 "POSITION count is rejected instead of overrunning the "
+                 "vertex arrays");
+  RecordProperty("Expected Result",
+                 "Result::err() for shorter and longer attributes, "
+                 "Result::ok() for a matching one");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  const std::string kPath = ::testing::TempDir() + "attribute-triangle.gltf";
+  const struct {
+    const char* attribute;
+    const char* type;
+    size_t components;
+  } kAttributes[] = {{"NORMAL", "VEC3", 3},
+                     {"TEXCOORD_0", "VEC2", 2},
+                     {"TANGENT", "VEC4", 4}};
+
+  for (const auto& attr : kAttributes) {
+    for (size_t count : {2u, 3u, 64u}) {
+      WriteTriangleAttributeGltf(kPath, attr.attribute, attr.type,
+                                 attr.components, count);
+      Mgtt::Rendering::Scene scene;
+      ASSERT_TRUE(scene.shader.Compile(shaderPaths).ok());
+      Mgtt::Rendering::GltfSceneImporter importer;
+      const auto result = importer.Load(scene, kPath);
+      EXPECT_EQ(result.ok(), count == 3u)
+          << attr.attribute << " count " << count;
+      importer.Clear(scene);
+    }
+  }
+}
+
+TEST_F(GltfSceneImporterTest, LoadGpuInstancingOutOfBounds) {
+  RecordProperty("Test Description",
+                 "An EXT_mesh_gpu_instancing accessor declaring more "
+                 "elements than its buffer holds is rejected");
+  RecordProperty("Expected Result", "Result::err() is true");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  const std::string kPath = ::testing::TempDir() + "overrun-instances.gltf";
+  WriteInstancedTriangleGltf(kPath, 4, 4096);
+
+  Mgtt::Rendering::Scene scene;
+  ASSERT_TRUE(scene.shader.Compile(shaderPaths).ok());
+  const auto result = gltfSceneImporter->Load(scene, kPath);
+  EXPECT_TRUE(result.err());
+  gltfSceneImporter->Clear(scene);
+}
+
+TEST_F(GltfSceneImporterTest, LoadTruncatedBinChunk) {
+  RecordProperty("Test Description",
+                 "A GLB whose BIN chunk ends before the index data its "
+                 "accessors reference is rejected");
+  RecordProperty("Expected Result",
+                 "Result::err() is true in the regular and the "
+                 "memory-mapped GLB path");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  const std::string kPath = ::testing::TempDir() + "truncated-triangle.glb";
+  WriteTriangleGlb(kPath);
+
+  // Cut the BIN chunk after the 36 position bytes, keeping the chunk and
+  // file headers consistent, so that only the index accessor overruns it
+  std::vector<char> glb;
+  {
+    std::ifstream file(kPath, std::ios::binary);
+    glb.assign(std::istreambuf_iterator<char>(file),
+               std::istreambuf_iterator<char>());
+  }
+  ASSERT_GE(glb.size(), 20u);
+  uint32_t jsonLength = 0;
+  std::memcpy(&jsonLength, glb.data() + 12, sizeof(jsonLength));
+  const uint32_t kBinLength = 36;
+  const uint32_t kFileLength = 12 + 8 + jsonLength + 8 + kBinLength;
+  ASSERT_LT(kFileLength, glb.size());
+  glb.resize(kFileLength);
+  std::memcpy(glb.data() + 8, &kFileLength, sizeof(kFileLength));
+  std::memcpy(glb.data() + 20 + jsonLength, &kBinLength, sizeof(kBinLength));
+  {
+    std::ofstream file(kPath, std::ios::binary | std::ios::trunc);
+    file.write(glb.data(), static_cast<std::streamsize>(glb.size()));
+  }
+
+  for (const bool kMemoryMapped : {false, true}) {
+    Mgtt::Rendering::Scene scene;
+    ASSERT_TRUE(scene.shader.Compile(shaderPaths).ok());
+    Mgtt::Rendering::GltfSceneImporter importer;
+    importer.SetMemoryMappedGlb(kMemoryMapped);
+
+    const auto result = importer.Load(scene, kPath);
+    EXPECT_TRUE(result.err()) << "memory-mapped: " << kMemoryMapped;
+    EXPECT_TRUE(scene.nodes.empty());
+    importer.Clear(scene);
+  }
+  std::filesystem::remove(kPath);
+}
+
+TEST_F(GltfSceneImporterTest, LoadFromSceneCache) {
+  RecordProperty("Test Description",
+                 "A second Load of an unchanged file is served from the "
+                 "scene cache");
+  RecordProperty("Expected Result",
+                 "A cache entry is written by the cold load, the warm load "
+                 "restores the shared mesh and uploads");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  const std::string kPath = ::testing::TempDir() + "cached-triangle.glb";
+  const std::string kCacheDir = ::testing::TempDir() + "gltf-scene-cache";
+  WriteTriangleGlb(kPath, {}, 2);
+  std::filesystem::remove_all(kCacheDir);
+
+  Mgtt::Rendering::SceneCache cache;
+  cache.SetDirectory(kCacheDir);
+  gltfSceneImporter->SetCacheDirectory(kCacheDir);
+
+  Mgtt::Rendering::Scene coldScene;
+  ASSERT_TRUE(coldScene.shader.Compile(shaderPaths).ok());
+  ASSERT_TRUE(gltfSceneImporter->Load(coldScene, kPath).ok());
+
+  // The warm load waits for the entry the cold load queued
+  Mgtt::Rendering::Scene warmScene;
+  ASSERT_TRUE(warmScene.shader.Compile(shaderPaths).ok());
+  const auto loadResult = gltfSceneImporter->Load(warmScene, kPath);
+  ASSERT_TRUE(loadResult.ok()) << loadResult.error();
+  EXPECT_TRUE(std::filesystem::exists(cache.EntryPath(kPath)));
+  ASSERT_EQ(warmScene.nodes.size(), 2u);
+  ASSERT_NE(warmScene.nodes[0].mesh, nullptr);
+  EXPECT_EQ(warmScene.nodes[0].mesh, warmScene.nodes[1].mesh);
+  EXPECT_EQ(warmScene.nodes[0].mesh->indices,
+            coldScene.nodes[0].mesh->indices);
+  EXPECT_EQ(warmScene.nodes[1].worldMatrix,
+            coldScene.nodes[1].worldMatrix);
+  EXPECT_FLOAT_EQ(warmScene.aabb.scale, coldScene.aabb.scale);
+
+  const auto uploadResult = sceneUploader->Upload(warmScene);
+  ASSERT_TRUE(uploadResult.ok()) << uploadResult.error();
+  EXPECT_GT(warmScene.nodes[0].mesh->vao, 0u);
+
+  gltfSceneImporter->SetCacheDirectory("");
+  gltfSceneImporter->Clear(coldScene);
+  gltfSceneImporter->Clear(warmScene);
+  std::filesystem::remove_all(kCacheDir);
+}
+
+TEST_F(GltfSceneImporterTest, IncrementalUpload) {
+  RecordProperty("Test Description",
+                 "UploadStep with a one-byte budget uploads one item per "
+                 "call, textures ahead of the mesh that uses them");
+  RecordProperty("Expected Result",
+                 "Several steps until Ok(true), the mesh gets its vao only "
+                 "after its material textures are resident");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  Mgtt::Rendering::Scene scene;
+  ASSERT_TRUE(scene.shader.Compile(shaderPaths).ok());
+  ASSERT_TRUE(gltfSceneImporter
+                  ->Load(scene, "assets/scenes/water-bottle/WaterBottle.gltf")
+                  .ok());
+
+  sceneUploader->BeginUpload(scene);
+  ASSERT_TRUE(sceneUploader->IsUploading());
+  ASSERT_FALSE(scene.instanceBatches.empty());
+  EXPECT_GT(sceneUploader->GetPendingBytes(), 0u);
+
+  Mgtt::Rendering::UploadBudget budget;
+  budget.bytes = 1;
+  size_t steps = 0;
+  bool done = false;
+  while (!done && steps < 100) {
+    const auto kResult = sceneUploader->UploadStep(scene, budget);
+    ASSERT_TRUE(kResult.ok()) << kResult.error();
+    done = kResult.value();
+    ++steps;
+
+    const auto& mesh = *scene.instanceBatches[0].mesh;
+    if (mesh.vao == 0) {
+      continue;
+    }
+    for (const auto& prim : mesh.meshPrimitives) {
+      EXPECT_GT(prim.pbrMaterial.baseColorTexture.id, 0u);
+    }
+  }
+
+  EXPECT_TRUE(done);
+  EXPECT_EQ(steps, scene.textureMap.size() + scene.instanceBatches.size());
+  EXPECT_FALSE(sceneUploader->IsUploading());
+  EXPECT_EQ(sceneUploader->GetPendingBytes(), 0u);
+  for (const auto& [key, texture] : scene.textureMap) {
+    EXPECT_GT(texture.id, 0u);
+    EXPECT_EQ(texture.data, nullptr);
+  }
+  EXPECT_GT(scene.instanceBatches[0].mesh->vao, 0u);
+
+  gltfSceneImporter->Clear(scene);
+}
+
+TEST_F(GltfSceneImporterTest, SharedBufferUpload) {
+  RecordProperty("Test Description",
+                 "Shared-buffer mode suballocates meshes from scene-wide "
+                 "buffers behind one VAO");
+  RecordProperty("Expected Result",
+                 "Meshes reference Scene::sharedGeometry, batches own no "
+                 "instance buffer, Clear releases the shared objects");
+
+  const std::pair<std::string_view, std::string_view> shaderPaths{
+      "assets/shader/core/pbr.vert", "assets/shader/core/pbr.frag"};
+  Mgtt::Rendering::Scene scene;
+  ASSERT_TRUE(scene.shader.Compile(shaderPaths).ok());
+  ASSERT_TRUE(gltfSceneImporter
+                  ->Load(scene, "assets/scenes/water-bottle/WaterBottle.gltf")
+                  .ok());
+
+  sceneUploader->SetSharedBuffers(true);
+  EXPECT_TRUE(sceneUploader->IsSharedBuffers());
+  const auto uploadResult = sceneUploader->Upload(scene);
+  sceneUploader->SetSharedBuffers(false);
+  ASSERT_TRUE(uploadResult.ok()) << uploadResult.error();
+
+  const auto& geometry = scene.sharedGeometry;
+  EXPECT_GT(geometry.vao, 0u);
+  EXPECT_GT(geometry.instanceVbo, 0u);
+  ASSERT_FALSE(scene.instanceBatches.empty());
+  size_t expectedIndexBytes = 0;
+  uint32_t expectedFirstInstance = 0;
+  for (const auto& batch : scene.instanceBatches) {
+    const size_t kIndexSize = GetIndexSize(batch.mesh->indexType);
+    expectedIndexBytes = (expectedIndexBytes + 3) & ~size_t{3};
+    EXPECT_TRUE(batch.mesh->sharedBuffers);
+    EXPECT_EQ(batch.mesh->indexType,
+              SelectIndexType(batch.mesh->vertexPositionAttribs.size()));
+    EXPECT_EQ(batch.mesh->vao, geometry.vao);
+    EXPECT_EQ(batch.mesh->ebo, geometry.ebo);
+    EXPECT_EQ(batch.mesh->baseIndex * kIndexSize, expectedIndexBytes);
+    EXPECT_EQ(batch.firstInstance, expectedFirstInstance);
+    EXPECT_EQ(batch.instanceVbo, 0u);
+    expectedIndexBytes += batch.mesh->indices.size() * kIndexSize;
+    expectedFirstInstance +=
+        static_cast<uint32_t>(batch.instanceMatrices.size());
+  }
+
+  const auto kMesh = scene.instanceBatches[0].mesh;
+  gltfSceneImporter->Clear(scene);
+  EXPECT_EQ(scene.sharedGeometry.vao, 0u);
+  EXPECT_EQ(kMesh->vao, 0u);
+  EXPECT_FALSE(kMesh->sharedBuffers);
+}
+
 TEST_F(GltfSceneImporterTest, ClearScene) {
   RecordProperty("Test Description", "Clear resets all scene fields");
   RecordProperty("Expected Result",
@@ -206,6 +978,7 @@ TEST_F(GltfSceneImporterTest, UploadWithoutLoad) {
   Mgtt::Rendering::Scene emptyScene;
   const auto result = sceneUploader->Upload(emptyScene);
   EXPECT_TRUE(result.ok());
+  EXPECT_TRUE(emptyScene.instanceBatches.empty());
 }
 
 TEST_F(GltfSceneImporterTest, SceneMoveConstruct) {
@@ -269,9 +1042,9 @@ TEST_F(GltfSceneImporterTest, MeshMoveConstruct) {
           .ok());
   ASSERT_TRUE(sceneUploader->Upload(mgttScene).ok());
   ASSERT_FALSE(mgttScene.nodes.empty());
-  ASSERT_NE(mgttScene.nodes[0]->mesh, nullptr);
+  ASSERT_NE(mgttScene.nodes[0].mesh, nullptr);
 
-  auto& srcMesh = *mgttScene.nodes[0]->mesh;
+  auto& srcMesh = *mgttScene.nodes[0].mesh;
   const uint32_t kOriginalVao = srcMesh.vao;
 
   Mgtt::Rendering::Mesh moved(std::move(srcMesh));
@@ -0,0 +1,105 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <index-buffer.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class IndexBufferTest : public ::testing::Test {};
+
+TEST_F(IndexBufferTest, SelectIndexType) {
+  RecordProperty("Test Description",
+                 "Select index types around the 16-bit vertex limit");
+  RecordProperty("Expected Result",
+                 "UInt16 up to 65536 vertices, UInt32 beyond");
+
+  EXPECT_EQ(SelectIndexType(0), IndexType::UInt16);
+  EXPECT_EQ(SelectIndexType(65536), IndexType::UInt16);
+  EXPECT_EQ(SelectIndexType(65537), IndexType::UInt32);
+  EXPECT_EQ(GetIndexSize(IndexType::UInt16), 2u);
+  EXPECT_EQ(GetIndexSize(IndexType::UInt32), 4u);
+  EXPECT_EQ(GetIndexGlType(IndexType::UInt16),
+            static_cast<GLenum>(GL_UNSIGNED_SHORT));
+  EXPECT_EQ(GetIndexGlType(IndexType::UInt32),
+            static_cast<GLenum>(GL_UNSIGNED_INT));
+}
+
+TEST_F(IndexBufferTest, NarrowSmallMesh) {
+  RecordProperty("Test Description",
+                 "Build an index buffer for a mesh with 65536 vertices");
+  RecordProperty("Expected Result",
+                 "Indices are stored as uint16 and keep their values");
+
+  const std::vector<uint32_t> kIndices = {0, 1, 65535};
+  const IndexBuffer kBuffer(kIndices, 65536);
+
+  EXPECT_EQ(kBuffer.type, IndexType::UInt16);
+  EXPECT_EQ(kBuffer.GetCount(), 3u);
+  EXPECT_EQ(kBuffer.GetByteSize(), 6u);
+  EXPECT_TRUE(kBuffer.indices32.empty());
+  EXPECT_EQ(kBuffer.indices16, (std::vector<uint16_t>{0, 1, 65535}));
+  EXPECT_EQ(kBuffer.GetData(), kBuffer.indices16.data());
+}
+
+TEST_F(IndexBufferTest, WidenWhenRebased) {
+  RecordProperty("Test Description",
+                 "Rebase a small mesh past the 16-bit vertex limit");
+  RecordProperty("Expected Result",
+                 "Indices are stored as uint32 with the base vertex added");
+
+  const std::vector<uint32_t> kIndices = {0, 1, 2};
+  const IndexBuffer kSmall(kIndices, 3, 100);
+  EXPECT_EQ(kSmall.type, IndexType::UInt16);
+  EXPECT_EQ(kSmall.indices16, (std::vector<uint16_t>{100, 101, 102}));
+
+  const IndexBuffer kLarge(kIndices, 3, 65534);
+  EXPECT_EQ(kLarge.type, IndexType::UInt32);
+  EXPECT_EQ(kLarge.GetByteSize(), 12u);
+  EXPECT_EQ(kLarge.indices32, (std::vector<uint32_t>{65534, 65535, 65536}));
+}
+
+TEST_F(IndexBufferTest, WidenForOutOfRangeIndex) {
+  RecordProperty("Test Description",
+                 "Build an index buffer whose indices exceed the given "
+                 "vertex count and the 16-bit range");
+  RecordProperty("Expected Result",
+                 "Indices are stored as uint32 without wrapping");
+
+  const std::vector<uint32_t> kIndices = {0, 1, 70000};
+  EXPECT_EQ(SelectIndexType(kIndices, 3), IndexType::UInt32);
+  EXPECT_EQ(SelectIndexType({0, 1, 2}, 3), IndexType::UInt16);
+  const IndexBuffer kBuffer(kIndices, 3);
+  EXPECT_EQ(kBuffer.type, IndexType::UInt32);
+  EXPECT_EQ(kBuffer.indices32, kIndices);
+
+  const IndexBuffer kRebased({0, 65535}, 2, 1);
+  EXPECT_EQ(kRebased.type, IndexType::UInt32);
+  EXPECT_EQ(kRebased.indices32, (std::vector<uint32_t>{1, 65536}));
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
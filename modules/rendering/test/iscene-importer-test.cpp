@@ -0,0 +1,97 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <iscene-importer.h>
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+/**
+ * @brief Importer exposing the post-import mesh processing.
+ */
+class ProcessingImporter : public Mgtt::Rendering::ISceneImporter {
+ public:
+  Mgtt::Common::Result<void> Load(Mgtt::Rendering::Scene&,
+                                  std::string_view) override {
+    return Mgtt::Common::Result<void>::Ok();
+  }
+  void Clear(Mgtt::Rendering::Scene&) noexcept override {}
+
+  using Mgtt::Rendering::ISceneImporter::ProcessMeshes;
+};
+
+class ISceneImporterTest : public ::testing::Test {
+ protected:
+  /**
+   * @brief Folded quad stored as two triangles with six unshared vertices
+   * and zero normals, as Tydra meshes without authored normals arrive.
+   */
+  static void BuildUnsharedQuad(Mgtt::Rendering::Scene& scene) {
+    auto mesh = std::make_shared<Mgtt::Rendering::Mesh>();
+    mesh->vertexPositionAttribs = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f},
+                                   {1.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 0.0f},
+                                   {1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 1.0f}};
+    mesh->vertexNormalAttribs.assign(6, glm::vec3(0.0f));
+    mesh->vertexTextureAttribs.assign(6, glm::vec2(0.0f));
+    mesh->indices = {0, 1, 2, 3, 4, 5};
+    mesh->meshPrimitives.resize(1);
+    mesh->meshPrimitives[0].indexCount = 6;
+    mesh->meshPrimitives[0].vertexCount = 6;
+    mesh->meshPrimitives[0].hasIndices = true;
+    scene.nodes[scene.AddNode()].mesh = std::move(mesh);
+  }
+};
+
+TEST_F(ISceneImporterTest, SharedNormalsAcrossDuplicatedVertices) {
+  RecordProperty("Test Description",
+                 "Generate normals for a folded quad without shared vertices");
+  RecordProperty("Expected Result",
+                 "Diagonal vertices are merged and share one smooth normal");
+
+  Mgtt::Rendering::Scene scene;
+  BuildUnsharedQuad(scene);
+  ProcessingImporter importer;
+  importer.SetTangentGeneration(true);
+
+  const auto kResult = importer.ProcessMeshes(scene);
+  ASSERT_TRUE(kResult.ok()) << kResult.error();
+  const auto& mesh = *scene.nodes[0].mesh;
+  ASSERT_EQ(mesh.vertexPositionAttribs.size(), 4u);
+  EXPECT_EQ(mesh.indices, (std::vector<uint32_t>{0, 1, 2, 0, 2, 3}));
+
+  // Both faces contribute to the diagonal, so its normal is neither face's
+  const glm::vec3 kFlat(0.0f, 0.0f, 1.0f);
+  const glm::vec3& kDiagonal = mesh.vertexNormalAttribs[0];
+  EXPECT_NEAR(glm::length(kDiagonal), 1.0f, 1e-5f);
+  EXPECT_LT(glm::dot(kDiagonal, kFlat), 0.999f);
+  EXPECT_NEAR(glm::distance(mesh.vertexNormalAttribs[2], kDiagonal), 0.0f,
+              1e-5f);
+  EXPECT_NEAR(glm::dot(mesh.vertexNormalAttribs[1], kFlat), 1.0f, 1e-5f);
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
@@ -0,0 +1,95 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <mapped-file.h>
+
+#include <fstream>
+#include <string>
+#include <utility>
+
+namespace Mgtt::Rendering::Test {
+
+class MappedFileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path = ::testing::TempDir() + "mapped-file-test.bin";
+    std::ofstream file(path, std::ios::binary);
+    file << kContent;
+  }
+
+  std::string path;
+  const std::string kContent = "glTF mapped file contents";
+};
+
+TEST_F(MappedFileTest, OpenAndReadFile) {
+  RecordProperty("Test Description",
+                 "Open maps an existing file for reading");
+  RecordProperty("Expected Result",
+                 "Result::ok() is true, mapped bytes equal the file");
+
+  Mgtt::Rendering::MappedFile mappedFile;
+  const auto result = mappedFile.Open(path);
+  ASSERT_TRUE(result.ok()) << result.error();
+
+  EXPECT_TRUE(mappedFile.IsOpen());
+  ASSERT_EQ(mappedFile.Size(), kContent.size());
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(mappedFile.Data()),
+                        mappedFile.Size()),
+            kContent);
+
+  mappedFile.Close();
+  EXPECT_FALSE(mappedFile.IsOpen());
+  EXPECT_EQ(mappedFile.Size(), 0u);
+}
+
+TEST_F(MappedFileTest, OpenMissingFile) {
+  RecordProperty("Test Description", "Open returns Err for a missing file");
+  RecordProperty("Expected Result", "Result::err() is true, nothing mapped");
+
+  Mgtt::Rendering::MappedFile mappedFile;
+  const auto result = mappedFile.Open(path + ".missing");
+
+  EXPECT_TRUE(result.err());
+  EXPECT_FALSE(mappedFile.IsOpen());
+}
+
+TEST_F(MappedFileTest, MoveTransfersMapping) {
+  RecordProperty("Test Description",
+                 "Moving a MappedFile transfers the mapping");
+  RecordProperty("Expected Result",
+                 "Target owns the mapping, source is closed");
+
+  Mgtt::Rendering::MappedFile source;
+  ASSERT_TRUE(source.Open(path).ok());
+  const unsigned char* kData = source.Data();
+
+  Mgtt::Rendering::MappedFile target(std::move(source));
+
+  EXPECT_EQ(target.Data(), kData);
+  EXPECT_EQ(target.Size(), kContent.size());
+  EXPECT_FALSE(source.IsOpen());
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
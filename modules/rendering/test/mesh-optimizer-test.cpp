@@ -0,0 +1,251 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <mesh-optimizer.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class MeshOptimizerTest : public ::testing::Test {
+ protected:
+  using Triangle = std::array<float, 9>;
+
+  /**
+   * @brief Grid of size x size quads in the xy plane with its triangles in
+   * random order, split into two primitives.
+   */
+  static void BuildShuffledGrid(Mgtt::Rendering::Mesh& mesh, uint32_t size) {
+    for (uint32_t y = 0; y <= size; ++y) {
+      for (uint32_t x = 0; x <= size; ++x) {
+        mesh.vertexPositionAttribs.emplace_back(static_cast<float>(x),
+                                                static_cast<float>(y), 0.0f);
+        mesh.vertexNormalAttribs.emplace_back(0.0f, 0.0f, 1.0f);
+        mesh.vertexTextureAttribs.emplace_back(static_cast<float>(x),
+                                               static_cast<float>(y));
+      }
+    }
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (uint32_t y = 0; y < size; ++y) {
+      for (uint32_t x = 0; x < size; ++x) {
+        const uint32_t kCorner = y * (size + 1) + x;
+        triangles.push_back({kCorner, kCorner + 1, kCorner + size + 2});
+        triangles.push_back({kCorner, kCorner + size + 2, kCorner + size + 1});
+      }
+    }
+    std::mt19937 rng(42);
+    std::shuffle(triangles.begin(), triangles.end(), rng);
+    for (const auto& triangle : triangles) {
+      mesh.indices.insert(mesh.indices.end(), triangle.begin(), triangle.end());
+    }
+
+    const auto kHalf = static_cast<uint32_t>(triangles.size() / 2 * 3);
+    mesh.meshPrimitives.resize(2);
+    mesh.meshPrimitives[0].firstIndex = 0;
+    mesh.meshPrimitives[0].indexCount = kHalf;
+    mesh.meshPrimitives[1].firstIndex = kHalf;
+    mesh.meshPrimitives[1].indexCount =
+        static_cast<uint32_t>(mesh.indices.size()) - kHalf;
+  }
+
+  /**
+   * @brief Triangles of an index range as sorted position triples, rotated
+   * to a canonical start so winding is preserved.
+   */
+  static std::vector<Triangle> Triangles(const Mgtt::Rendering::Mesh& mesh,
+                                         uint32_t firstIndex,
+                                         uint32_t indexCount) {
+    std::vector<Triangle> triangles;
+    for (uint32_t idx = firstIndex; idx < firstIndex + indexCount; idx += 3) {
+      std::array<glm::vec3, 3> corners;
+      for (uint32_t corner = 0; corner < 3; ++corner) {
+        corners[corner] =
+            mesh.vertexPositionAttribs[mesh.indices[idx + corner]];
+      }
+      auto less = [](const glm::vec3& lhs, const glm::vec3& rhs) {
+        return std::tie(lhs.x, lhs.y, lhs.z) < std::tie(rhs.x, rhs.y, rhs.z);
+      };
+      std::rotate(corners.begin(),
+                  std::min_element(corners.begin(), corners.end(), less),
+                  corners.end());
+      Triangle triangle;
+      for (uint32_t corner = 0; corner < 3; ++corner) {
+        for (uint32_t axis = 0; axis < 3; ++axis) {
+          triangle[corner * 3 + axis] = corners[corner][axis];
+        }
+      }
+      triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+  }
+};
+
+TEST_F(MeshOptimizerTest, AnalyzeVertexCache) {
+  RecordProperty("Test Description",
+                 "Measure a quad of two triangles sharing an edge");
+  RecordProperty("Expected Result",
+                 "4 transformed vertices: ACMR 2, ATVR 1");
+
+  const std::vector<uint32_t> kIndices = {0, 1, 2, 2, 1, 3};
+  const auto kStats = AnalyzeVertexCache(kIndices.data(), kIndices.size(), 4);
+
+  EXPECT_EQ(kStats.triangleCount, 2u);
+  EXPECT_EQ(kStats.vertexCount, 4u);
+  EXPECT_EQ(kStats.transformedCount, 4u);
+  EXPECT_FLOAT_EQ(kStats.acmr, 2.0f);
+  EXPECT_FLOAT_EQ(kStats.atvr, 1.0f);
+}
+
+TEST_F(MeshOptimizerTest, OptimizeVertexCache) {
+  RecordProperty("Test Description",
+                 "Reorder a grid with randomly ordered triangles");
+  RecordProperty("Expected Result",
+                 "Same triangles, ACMR at least halved and below 1");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildShuffledGrid(mesh, 32);
+  const size_t kVertexCount = mesh.vertexPositionAttribs.size();
+  const auto kBefore =
+      AnalyzeVertexCache(mesh.indices.data(), mesh.indices.size(),
+                         kVertexCount);
+  const auto kExpected = Triangles(
+      mesh, 0, static_cast<uint32_t>(mesh.indices.size()));
+
+  mesh.indices = OptimizeVertexCache(mesh.indices.data(), mesh.indices.size(),
+                                     kVertexCount);
+  const auto kAfter = AnalyzeVertexCache(
+      mesh.indices.data(), mesh.indices.size(), kVertexCount);
+
+  EXPECT_EQ(Triangles(mesh, 0, static_cast<uint32_t>(mesh.indices.size())),
+            kExpected);
+  EXPECT_LT(kAfter.acmr * 2.0f, kBefore.acmr);
+  EXPECT_LT(kAfter.acmr, 1.0f);
+  EXPECT_GE(kAfter.atvr, 1.0f);
+}
+
+TEST_F(MeshOptimizerTest, OptimizeOverdrawOutsideFirst) {
+  RecordProperty("Test Description",
+                 "Reorder two disjoint quads, the outward facing one last");
+  RecordProperty("Expected Result",
+                 "The quad facing away from the center is drawn first");
+
+  // Both quads at z = 1; the first faces -z (towards the center), the
+  // second +z
+  const std::vector<glm::vec3> kPositions = {
+      {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f},
+      {1.0f, 0.0f, 1.0f}, {2.0f, 0.0f, 1.0f}, {3.0f, 0.0f, 1.0f},
+      {3.0f, 1.0f, 1.0f}, {2.0f, 1.0f, 1.0f}};
+  const std::vector<uint32_t> kIndices = {0, 1, 2, 0, 2, 3,
+                                          4, 5, 6, 4, 6, 7};
+
+  const auto kResult =
+      OptimizeOverdraw(kIndices.data(), kIndices.size(), kPositions,
+                       glm::vec3(0.0f), kVertexCacheSize, kOverdrawThreshold);
+
+  const std::vector<uint32_t> kExpected = {4, 5, 6, 4, 6, 7,
+                                           0, 1, 2, 0, 2, 3};
+  EXPECT_EQ(kResult, kExpected);
+}
+
+TEST_F(MeshOptimizerTest, OptimizeVertexFetch) {
+  RecordProperty("Test Description",
+                 "Reorder vertices of a mesh by first use");
+  RecordProperty("Expected Result",
+                 "Indices count up from 0, attributes follow, unused last");
+
+  Mgtt::Rendering::Mesh mesh;
+  mesh.vertexPositionAttribs = {
+      {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f},
+      {3.0f, 0.0f, 0.0f}, {4.0f, 0.0f, 0.0f}};
+  mesh.vertexTextureAttribs = {
+      {0.0f, 0.0f}, {1.0f, 0.0f}, {2.0f, 0.0f}, {3.0f, 0.0f}, {4.0f, 0.0f}};
+  mesh.indices = {3, 1, 4, 4, 1, 0};
+
+  OptimizeVertexFetch(mesh);
+
+  EXPECT_EQ(mesh.indices, (std::vector<uint32_t>{0, 1, 2, 2, 1, 3}));
+  const std::vector<float> kExpectedX = {3.0f, 1.0f, 4.0f, 0.0f, 2.0f};
+  for (size_t idx = 0; idx < kExpectedX.size(); ++idx) {
+    EXPECT_FLOAT_EQ(mesh.vertexPositionAttribs[idx].x, kExpectedX[idx]);
+    EXPECT_FLOAT_EQ(mesh.vertexTextureAttribs[idx].x, kExpectedX[idx]);
+  }
+  // Arrays that do not match the vertex count are left alone
+  EXPECT_TRUE(mesh.vertexNormalAttribs.empty());
+}
+
+TEST_F(MeshOptimizerTest, OptimizeMesh) {
+  RecordProperty("Test Description",
+                 "Run all passes on a shuffled grid with two primitives");
+  RecordProperty("Expected Result",
+                 "Each primitive keeps its triangles, ACMR improves");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildShuffledGrid(mesh, 32);
+  std::vector<std::vector<Triangle>> expected;
+  for (const auto& prim : mesh.meshPrimitives) {
+    expected.push_back(Triangles(mesh, prim.firstIndex, prim.indexCount));
+  }
+
+  const auto kResult = OptimizeMesh(mesh);
+  ASSERT_TRUE(kResult.ok()) << kResult.error();
+
+  for (size_t idx = 0; idx < mesh.meshPrimitives.size(); ++idx) {
+    const auto& prim = mesh.meshPrimitives[idx];
+    EXPECT_EQ(Triangles(mesh, prim.firstIndex, prim.indexCount),
+              expected[idx]);
+  }
+  const auto& report = kResult.value();
+  EXPECT_EQ(report.before.triangleCount, 32u * 32u * 2u);
+  EXPECT_EQ(report.after.triangleCount, report.before.triangleCount);
+  EXPECT_LT(report.after.acmr * 1.5f, report.before.acmr);
+  EXPECT_LT(report.after.atvr, report.before.atvr);
+  // First use order: the first triangle refers to the first vertices
+  EXPECT_LT(*std::max_element(mesh.indices.begin(), mesh.indices.begin() + 3),
+            3u);
+}
+
+TEST_F(MeshOptimizerTest, OptimizeMeshIndexOutOfRange) {
+  RecordProperty("Test Description",
+                 "Optimize a mesh with an index past its vertices");
+  RecordProperty("Expected Result", "Result::err() is true, mesh untouched");
+
+  Mgtt::Rendering::Mesh mesh;
+  mesh.vertexPositionAttribs = {
+      {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+  mesh.indices = {0, 1, 3};
+  mesh.meshPrimitives.resize(1);
+  mesh.meshPrimitives[0].indexCount = 3;
+
+  EXPECT_TRUE(OptimizeMesh(mesh).err());
+  EXPECT_EQ(mesh.indices, (std::vector<uint32_t>{0, 1, 3}));
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
@@ -0,0 +1,214 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <mesh-simplifier.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class MeshSimplifierTest : public ::testing::Test {
+ protected:
+  static constexpr uint32_t kCells = 16;
+  static constexpr float kPi = 3.14159265f;
+
+  /**
+   * @brief Unit grid of kCells x kCells quads lifted by a height function.
+   * With a seam, the column at x = 0.5 is duplicated with its own texture
+   * coordinates and the right half indexes the copies.
+   */
+  template <typename HeightFn>
+  static void BuildGrid(Mgtt::Rendering::Mesh& mesh, HeightFn height,
+                        bool seam = false) {
+    const uint32_t kRow = kCells + 1;
+    auto addVertex = [&](uint32_t col, uint32_t row, float uOffset) {
+      const float kX = static_cast<float>(col) / kCells;
+      const float kY = static_cast<float>(row) / kCells;
+      mesh.vertexPositionAttribs.emplace_back(kX, kY, height(kX, kY));
+      mesh.vertexNormalAttribs.emplace_back(0.0f, 0.0f, 1.0f);
+      mesh.vertexTextureAttribs.emplace_back(kX + uOffset, kY);
+    };
+    for (uint32_t row = 0; row < kRow; ++row) {
+      for (uint32_t col = 0; col < kRow; ++col) {
+        addVertex(col, row, 0.0f);
+      }
+    }
+    const uint32_t kSeamBase = kRow * kRow;
+    if (seam) {
+      for (uint32_t row = 0; row < kRow; ++row) {
+        addVertex(kCells / 2, row, 0.5f);
+      }
+    }
+    auto vertexAt = [&](uint32_t col, uint32_t row, bool right) {
+      return seam && right && col == kCells / 2 ? kSeamBase + row
+                                                : row * kRow + col;
+    };
+    for (uint32_t row = 0; row < kCells; ++row) {
+      for (uint32_t col = 0; col < kCells; ++col) {
+        const bool kRight = col >= kCells / 2;
+        const uint32_t kA = vertexAt(col, row, kRight);
+        const uint32_t kB = vertexAt(col + 1, row, kRight);
+        const uint32_t kC = vertexAt(col + 1, row + 1, kRight);
+        const uint32_t kD = vertexAt(col, row + 1, kRight);
+        mesh.indices.insert(mesh.indices.end(), {kA, kB, kC, kA, kC, kD});
+      }
+    }
+    mesh.meshPrimitives.resize(1);
+    mesh.meshPrimitives[0].indexCount =
+        static_cast<uint32_t>(mesh.indices.size());
+    mesh.meshPrimitives[0].vertexCount =
+        static_cast<uint32_t>(mesh.vertexPositionAttribs.size());
+    mesh.meshPrimitives[0].hasIndices = true;
+  }
+
+  static float Flat(float, float) { return 0.0f; }
+
+  static float Bump(float x, float y) {
+    return 0.2f * std::sin(kPi * x) * std::sin(kPi * y);
+  }
+};
+
+TEST_F(MeshSimplifierTest, FlatGridReachesTargets) {
+  RecordProperty("Test Description",
+                 "Simplify a flat grid to half and a quarter");
+  RecordProperty("Expected Result",
+                 "Both targets met with no error, corners kept");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildGrid(mesh, Flat);
+  const size_t kTriangles = mesh.indices.size() / 3;
+
+  const auto kLevels = SimplifyTriangles(mesh, mesh.indices.data(),
+                                         mesh.indices.size(), {0.5f, 0.25f});
+  ASSERT_EQ(kLevels.size(), 2u);
+  EXPECT_LE(kLevels[0].indices.size() / 3, kTriangles / 2);
+  EXPECT_LE(kLevels[1].indices.size() / 3, kTriangles / 4);
+  EXPECT_GT(kLevels[1].indices.size(), 0u);
+
+  for (const auto& level : kLevels) {
+    EXPECT_LT(level.error, 1.0e-4f);
+    glm::vec3 minPos(1.0f);
+    glm::vec3 maxPos(0.0f);
+    for (const uint32_t kIdx : level.indices) {
+      minPos = glm::min(minPos, mesh.vertexPositionAttribs[kIdx]);
+      maxPos = glm::max(maxPos, mesh.vertexPositionAttribs[kIdx]);
+    }
+    EXPECT_EQ(minPos, glm::vec3(0.0f));
+    EXPECT_EQ(maxPos, glm::vec3(1.0f, 1.0f, 0.0f));
+  }
+}
+
+TEST_F(MeshSimplifierTest, CurvedSurfaceBoundsError) {
+  RecordProperty("Test Description",
+                 "Simplify a curved grid with a tight error limit");
+  RecordProperty("Expected Result",
+                 "Each level coarser, errors increasing and within the limit");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildGrid(mesh, Bump);
+  constexpr float kMaxError = 0.01f;
+
+  const auto kLevels =
+      SimplifyTriangles(mesh, mesh.indices.data(), mesh.indices.size(),
+                        {0.5f, 0.25f, 0.02f}, kMaxError);
+  ASSERT_FALSE(kLevels.empty());
+  // The tight limit stops the chain before 2% of the triangles
+  EXPECT_GT(kLevels.back().indices.size() / 3, mesh.indices.size() / 150);
+
+  size_t previous = mesh.indices.size();
+  float previousError = 0.0f;
+  for (const auto& level : kLevels) {
+    EXPECT_LT(level.indices.size(), previous);
+    EXPECT_GE(level.error, previousError);
+    EXPECT_LE(level.error, kMaxError);
+    previous = level.indices.size();
+    previousError = level.error;
+  }
+}
+
+TEST_F(MeshSimplifierTest, KeepSeams) {
+  RecordProperty("Test Description",
+                 "Simplify a grid split by a texture coordinate seam");
+  RecordProperty("Expected Result",
+                 "No triangle mixes vertices from both sides of the seam");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildGrid(mesh, Flat, true);
+  const uint32_t kSeamBase = (kCells + 1) * (kCells + 1);
+
+  const auto kLevels = SimplifyTriangles(mesh, mesh.indices.data(),
+                                         mesh.indices.size(), {0.5f, 0.25f});
+  ASSERT_EQ(kLevels.size(), 2u);
+  for (const auto& level : kLevels) {
+    for (size_t tri = 0; tri + 2 < level.indices.size(); tri += 3) {
+      int left = 0;
+      int right = 0;
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const uint32_t kIdx = level.indices[tri + corner];
+        const float kX = mesh.vertexPositionAttribs[kIdx].x;
+        if (kIdx >= kSeamBase || kX > 0.5f) {
+          ++right;
+        } else if (kX < 0.5f) {
+          ++left;
+        }
+      }
+      EXPECT_FALSE(left > 0 && right > 0) << "triangle " << tri / 3;
+    }
+  }
+}
+
+TEST_F(MeshSimplifierTest, GenerateLodsAppendsChain) {
+  RecordProperty("Test Description",
+                 "Generate LODs twice for a single-primitive mesh");
+  RecordProperty("Expected Result",
+                 "Ranges follow the base indices; the second run replaces "
+                 "the first");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildGrid(mesh, Bump);
+  const size_t kBaseCount = mesh.indices.size();
+
+  ASSERT_TRUE(GenerateLods(mesh).ok());
+  const auto& kLods = mesh.meshPrimitives[0].lods;
+  ASSERT_FALSE(kLods.empty());
+  uint32_t expectedFirst = static_cast<uint32_t>(kBaseCount);
+  for (const auto& lod : kLods) {
+    EXPECT_EQ(lod.firstIndex, expectedFirst);
+    EXPECT_GT(lod.indexCount, 0u);
+    EXPECT_EQ(lod.indexCount % 3, 0u);
+    expectedFirst += lod.indexCount;
+  }
+  EXPECT_EQ(mesh.indices.size(), expectedFirst);
+
+  const auto kFirstRun = mesh.indices;
+  ASSERT_TRUE(GenerateLods(mesh).ok());
+  EXPECT_EQ(mesh.indices, kFirstRun);
+
+  mesh.indices[0] = static_cast<uint32_t>(mesh.vertexPositionAttribs.size());
+  EXPECT_TRUE(GenerateLods(mesh).err());
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
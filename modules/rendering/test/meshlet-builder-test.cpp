@@ -0,0 +1,156 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <meshlet-builder.h>
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class MeshletBuilderTest : public ::testing::Test {
+ protected:
+  /**
+   * @brief Flat grid of cells x cells quads in the z = 0 plane, facing +z.
+   */
+  static void BuildGrid(Mgtt::Rendering::Mesh& mesh, uint32_t cells) {
+    const uint32_t kRow = cells + 1;
+    for (uint32_t row = 0; row < kRow; ++row) {
+      for (uint32_t col = 0; col < kRow; ++col) {
+        mesh.vertexPositionAttribs.emplace_back(
+            static_cast<float>(col), static_cast<float>(row), 0.0f);
+      }
+    }
+    for (uint32_t row = 0; row < cells; ++row) {
+      for (uint32_t col = 0; col < cells; ++col) {
+        const uint32_t kA = row * kRow + col;
+        mesh.indices.insert(mesh.indices.end(), {kA, kA + 1, kA + kRow + 1,
+                                                 kA, kA + kRow + 1, kA + kRow});
+      }
+    }
+    mesh.meshPrimitives.resize(1);
+    mesh.meshPrimitives[0].indexCount =
+        static_cast<uint32_t>(mesh.indices.size());
+    mesh.meshPrimitives[0].vertexCount =
+        static_cast<uint32_t>(mesh.vertexPositionAttribs.size());
+    mesh.meshPrimitives[0].hasIndices = true;
+  }
+};
+
+TEST_F(MeshletBuilderTest, SplitWithinLimits) {
+  RecordProperty("Test Description", "Build meshlets for a 32 x 32 grid");
+  RecordProperty("Expected Result",
+                 "Consecutive meshlets cover the primitive within the limits");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildGrid(mesh, 32);
+
+  const auto kResult = BuildMeshlets(mesh);
+  ASSERT_TRUE(kResult.ok()) << kResult.error();
+  const auto& prim = mesh.meshPrimitives[0];
+  EXPECT_EQ(kResult.value(), prim.meshlets.size());
+  // At least one meshlet per 124 triangles
+  EXPECT_GE(prim.meshlets.size(), 2048u / kMeshletMaxTriangles + 1);
+
+  uint32_t expectedFirst = prim.firstIndex;
+  for (const auto& meshlet : prim.meshlets) {
+    EXPECT_EQ(meshlet.firstIndex, expectedFirst);
+    EXPECT_EQ(meshlet.indexCount % 3, 0u);
+    EXPECT_LE(meshlet.indexCount / 3, kMeshletMaxTriangles);
+    const std::unordered_set<uint32_t> kVertices(
+        mesh.indices.begin() + meshlet.firstIndex,
+        mesh.indices.begin() + meshlet.firstIndex + meshlet.indexCount);
+    EXPECT_LE(kVertices.size(), kMeshletMaxVertices);
+    for (const uint32_t kIdx : kVertices) {
+      EXPECT_LE(glm::distance(mesh.vertexPositionAttribs[kIdx], meshlet.center),
+                meshlet.radius * 1.0001f);
+    }
+    expectedFirst += meshlet.indexCount;
+  }
+  EXPECT_EQ(expectedFirst, prim.firstIndex + prim.indexCount);
+}
+
+TEST_F(MeshletBuilderTest, BackfaceConeCulling) {
+  RecordProperty("Test Description",
+                 "Test a flat meshlet from in front of and behind it");
+  RecordProperty("Expected Result",
+                 "Visible from the front, culled from behind unless the "
+                 "cone test is off");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildGrid(mesh, 4);
+  const auto kMeshlet =
+      ComputeMeshletBounds(mesh, 0, static_cast<uint32_t>(mesh.indices.size()));
+  EXPECT_EQ(kMeshlet.coneAxis, glm::vec3(0.0f, 0.0f, 1.0f));
+  EXPECT_NEAR(kMeshlet.coneCutoff, 0.0f, 1.0e-6f);
+
+  // Identity clip space is the cube [-1, 1]^3; widen it to hold the grid
+  const auto kPlanes =
+      ExtractFrustumPlanes(glm::mat4(glm::vec4(0.1f, 0.0f, 0.0f, 0.0f),
+                                     glm::vec4(0.0f, 0.1f, 0.0f, 0.0f),
+                                     glm::vec4(0.0f, 0.0f, 0.1f, 0.0f),
+                                     glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)));
+  EXPECT_TRUE(IsMeshletVisible(kMeshlet, kPlanes, glm::vec3(2.0f, 2.0f, 5.0f)));
+  EXPECT_FALSE(
+      IsMeshletVisible(kMeshlet, kPlanes, glm::vec3(2.0f, 2.0f, -5.0f)));
+  EXPECT_TRUE(IsMeshletVisible(kMeshlet, kPlanes, glm::vec3(2.0f, 2.0f, -5.0f),
+                               false));
+  // Grazing views keep it, since the sphere reaches past the plane
+  EXPECT_TRUE(
+      IsMeshletVisible(kMeshlet, kPlanes, glm::vec3(20.0f, 2.0f, -0.5f)));
+}
+
+TEST_F(MeshletBuilderTest, FrustumCulling) {
+  RecordProperty("Test Description",
+                 "Test spheres inside, straddling and outside the frustum");
+  RecordProperty("Expected Result", "Only the sphere outside is culled");
+
+  const auto kPlanes = ExtractFrustumPlanes(glm::mat4(1.0f));
+  Mgtt::Rendering::Meshlet meshlet;
+  meshlet.radius = 1.0f;
+  const glm::vec3 kViewer(0.0f, 0.0f, 10.0f);
+
+  meshlet.center = glm::vec3(0.0f);
+  EXPECT_TRUE(IsMeshletVisible(meshlet, kPlanes, kViewer));
+  meshlet.center = glm::vec3(1.5f, 0.0f, 0.0f);
+  EXPECT_TRUE(IsMeshletVisible(meshlet, kPlanes, kViewer));
+  meshlet.center = glm::vec3(0.0f, -2.5f, 0.0f);
+  EXPECT_FALSE(IsMeshletVisible(meshlet, kPlanes, kViewer));
+}
+
+TEST_F(MeshletBuilderTest, RejectMalformedInput) {
+  RecordProperty("Test Description",
+                 "Build meshlets with a bad index or unusable limits");
+  RecordProperty("Expected Result", "Result::err() is true");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildGrid(mesh, 2);
+  EXPECT_TRUE(BuildMeshlets(mesh, 2, 16).err());
+  EXPECT_TRUE(BuildMeshlets(mesh, 64, 0).err());
+  mesh.indices[4] = static_cast<uint32_t>(mesh.vertexPositionAttribs.size());
+  EXPECT_TRUE(BuildMeshlets(mesh).err());
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
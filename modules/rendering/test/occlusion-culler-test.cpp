@@ -0,0 +1,189 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <occlusion-culler.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class OcclusionCullerTest : public ::testing::Test {
+ protected:
+  /**
+   * @brief Square in the xy plane at z, split into cells x cells quads.
+   */
+  static Mgtt::Rendering::Mesh MakeGrid(float halfSize, float z,
+                                        uint32_t cells) {
+    Mgtt::Rendering::Mesh mesh;
+    const float kStep = 2.0f * halfSize / static_cast<float>(cells);
+    for (uint32_t row = 0; row <= cells; ++row) {
+      for (uint32_t column = 0; column <= cells; ++column) {
+        mesh.vertexPositionAttribs.emplace_back(
+            -halfSize + kStep * static_cast<float>(column),
+            -halfSize + kStep * static_cast<float>(row), z);
+      }
+    }
+    for (uint32_t row = 0; row < cells; ++row) {
+      for (uint32_t column = 0; column < cells; ++column) {
+        const uint32_t kCorner = row * (cells + 1) + column;
+        mesh.indices.insert(mesh.indices.end(),
+                            {kCorner, kCorner + 1, kCorner + cells + 2,
+                             kCorner, kCorner + cells + 2,
+                             kCorner + cells + 1});
+      }
+    }
+    return mesh;
+  }
+
+  static Mgtt::Rendering::AABB MakeBox(const glm::vec3& min,
+                                       const glm::vec3& max) {
+    Mgtt::Rendering::AABB box;
+    box.min = min;
+    box.max = max;
+    return box;
+  }
+};
+
+TEST_F(OcclusionCullerTest, RasterizeOccluder) {
+  RecordProperty("Test Description",
+                 "Rasterize a square covering the middle of an identity "
+                 "clip space at z = 0");
+  RecordProperty("Expected Result",
+                 "Pixels inside hold depth 0.5, pixels outside stay at 1");
+
+  const auto kMesh = MakeGrid(0.5f, 0.0f, 1);
+  OcclusionCuller culler;
+  culler.BeginFrame(glm::mat4(1.0f));
+  culler.AddOccluder(kMesh, 0, static_cast<uint32_t>(kMesh.indices.size()),
+                     glm::mat4(1.0f));
+  EXPECT_EQ(culler.Rasterize(), 2u);
+  EXPECT_EQ(culler.GetOccluderCount(), 1u);
+
+  const uint32_t kWidth = culler.GetWidth();
+  const uint32_t kHeight = culler.GetHeight();
+  EXPECT_EQ(culler.GetDepth(kWidth / 2, kHeight / 2), 0.5f);
+  EXPECT_EQ(culler.GetDepth(kWidth / 4 + 1, kHeight / 4 + 1), 0.5f);
+  EXPECT_EQ(culler.GetDepth(kWidth / 4 - 2, kHeight / 2), 1.0f);
+  EXPECT_EQ(culler.GetDepth(0, 0), 1.0f);
+  EXPECT_EQ(culler.GetDepth(kWidth - 1, kHeight - 1), 1.0f);
+  EXPECT_FLOAT_EQ(culler.GetScreenCoverage(MakeBox(glm::vec3(-0.5f),
+                                                   glm::vec3(0.5f))),
+                  0.25f);
+
+  // A new frame starts from an empty buffer
+  culler.BeginFrame(glm::mat4(1.0f));
+  EXPECT_EQ(culler.GetOccluderCount(), 0u);
+  EXPECT_EQ(culler.GetDepth(kWidth / 2, kHeight / 2), 1.0f);
+}
+
+TEST_F(OcclusionCullerTest, TestBoxesAgainstOccluder) {
+  RecordProperty("Test Description",
+                 "Test boxes behind, in front of, beside and straddling an "
+                 "occluding square");
+  RecordProperty("Expected Result",
+                 "Only boxes fully behind the square are hidden");
+
+  const auto kMesh = MakeGrid(0.5f, 0.0f, 1);
+  OcclusionCuller culler;
+  culler.BeginFrame(glm::mat4(1.0f));
+  culler.AddOccluder(kMesh, 0, static_cast<uint32_t>(kMesh.indices.size()),
+                     glm::mat4(1.0f));
+  culler.Rasterize();
+
+  EXPECT_FALSE(culler.IsVisible(
+      MakeBox(glm::vec3(-0.2f, -0.2f, 0.2f), glm::vec3(0.2f, 0.2f, 0.4f))));
+  EXPECT_TRUE(culler.IsVisible(
+      MakeBox(glm::vec3(-0.2f, -0.2f, -0.4f), glm::vec3(0.2f, 0.2f, -0.2f))));
+  EXPECT_TRUE(culler.IsVisible(
+      MakeBox(glm::vec3(0.6f, 0.6f, 0.2f), glm::vec3(0.8f, 0.8f, 0.4f))));
+  EXPECT_TRUE(culler.IsVisible(
+      MakeBox(glm::vec3(0.3f, -0.2f, 0.2f), glm::vec3(0.7f, 0.2f, 0.4f))));
+  // Touching the occluder plane counts as visible
+  EXPECT_TRUE(culler.IsVisible(
+      MakeBox(glm::vec3(-0.2f, -0.2f, 0.0f), glm::vec3(0.2f, 0.2f, 0.4f))));
+  // Off screen is left to the frustum test
+  EXPECT_TRUE(culler.IsVisible(
+      MakeBox(glm::vec3(2.0f, 2.0f, 0.2f), glm::vec3(3.0f, 3.0f, 0.4f))));
+}
+
+TEST_F(OcclusionCullerTest, SkipTrianglesBehindCamera) {
+  RecordProperty("Test Description",
+                 "Rasterize an occluder through a clip transform that puts "
+                 "it behind the camera");
+  RecordProperty("Expected Result",
+                 "Nothing is drawn and boxes behind the camera stay "
+                 "visible");
+
+  // w = -z, so geometry at z = 1 is behind the camera
+  glm::mat4 clip(1.0f);
+  clip[2][3] = -1.0f;
+  clip[3][3] = 0.0f;
+  const auto kMesh = MakeGrid(0.5f, 1.0f, 2);
+  OcclusionCuller culler;
+  culler.BeginFrame(clip);
+  culler.AddOccluder(kMesh, 0, static_cast<uint32_t>(kMesh.indices.size()),
+                     glm::mat4(1.0f));
+  EXPECT_EQ(culler.Rasterize(), 0u);
+  EXPECT_TRUE(culler.IsVisible(
+      MakeBox(glm::vec3(-0.1f, -0.1f, 0.5f), glm::vec3(0.1f, 0.1f, 2.0f))));
+  EXPECT_EQ(culler.GetScreenCoverage(MakeBox(glm::vec3(-0.5f, -0.5f, 0.5f),
+                                             glm::vec3(0.5f, 0.5f, 2.0f))),
+            0.0f);
+}
+
+TEST_F(OcclusionCullerTest, ThreadedMatchesSerial) {
+  RecordProperty("Test Description",
+                 "Rasterize the same tilted occluders with one and with "
+                 "four threads");
+  RecordProperty("Expected Result", "Both depth buffers are identical");
+
+  const auto kMesh = MakeGrid(0.6f, 0.0f, 16);
+  const glm::mat4 kModels[] = {
+      glm::translate(glm::mat4(1.0f), glm::vec3(-0.3f, 0.1f, 0.2f)),
+      glm::translate(glm::mat4(1.0f), glm::vec3(0.3f, -0.2f, -0.1f)),
+      glm::scale(glm::mat4(1.0f), glm::vec3(2.0f, 0.5f, 1.0f))};
+  std::vector<float> depths[2];
+  for (uint32_t pass = 0; pass < 2; ++pass) {
+    OcclusionCuller culler;
+    culler.Resize(130, 70);
+    culler.SetThreadCount(pass == 0 ? 1 : 4);
+    culler.BeginFrame(glm::mat4(1.0f));
+    for (const auto& model : kModels) {
+      culler.AddOccluder(kMesh, 0,
+                         static_cast<uint32_t>(kMesh.indices.size()), model);
+    }
+    EXPECT_GT(culler.Rasterize(), 0u);
+    EXPECT_EQ(culler.GetWidth(), 132u);
+    for (uint32_t y = 0; y < culler.GetHeight(); ++y) {
+      for (uint32_t x = 0; x < culler.GetWidth(); ++x) {
+        depths[pass].push_back(culler.GetDepth(x, y));
+      }
+    }
+  }
+  EXPECT_EQ(depths[0], depths[1]);
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
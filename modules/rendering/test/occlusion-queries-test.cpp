@@ -0,0 +1,194 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#ifdef __EMSCRIPTEN__
+#include <GLES3/gl3.h>
+#else
+#include <GL/glew.h>
+#endif
+#include <GLFW/glfw3.h>
+#include <gtest/gtest.h>
+#include <occlusion-queries.h>
+
+#include <memory>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class OcclusionQueriesTest : public ::testing::Test {
+ public:
+  static GLFWwindow* window;
+
+ protected:
+  void SetUp() override {
+    if (!glfwInit()) {
+      GTEST_SKIP() << "glfwInit failed — skipping GL test";
+    }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#else
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+#endif
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);  // headless
+
+    window = glfwCreateWindow(64, 64, "test-window", nullptr, nullptr);
+    if (!window) {
+      glfwTerminate();
+      GTEST_SKIP() << "glfwCreateWindow failed — skipping GL test";
+    }
+
+    glfwMakeContextCurrent(window);
+
+    if (glewInit() != GLEW_OK) {
+      glfwDestroyWindow(window);
+      window = nullptr;
+      glfwTerminate();
+      GTEST_SKIP() << "glewInit failed — skipping GL test";
+    }
+  }
+
+  void TearDown() override {
+    if (window) {
+      glfwDestroyWindow(window);
+      window = nullptr;
+      glfwTerminate();
+    }
+  }
+
+  /**
+   * @brief Culler with one draw per box, all inside the identity frustum.
+   */
+  static Mgtt::Rendering::FrustumCuller MakeCuller(
+      const std::vector<Mgtt::Rendering::AABB>& boxes) {
+    std::vector<Mgtt::Rendering::InstanceBatch> batches(1);
+    batches[0].mesh = std::make_shared<Mgtt::Rendering::Mesh>();
+    for (const auto& box : boxes) {
+      Mgtt::Rendering::MeshPrimitive prim;
+      prim.aabb = box;
+      batches[0].mesh->meshPrimitives.push_back(std::move(prim));
+    }
+    batches[0].instanceMatrices = {glm::mat4(1.0f)};
+    Mgtt::Rendering::FrustumCuller culler;
+    culler.Build(batches);
+    return culler;
+  }
+
+  static Mgtt::Rendering::AABB MakeBox(float nearZ, float farZ) {
+    Mgtt::Rendering::AABB box;
+    box.min = glm::vec3(-0.5f, -0.5f, nearZ);
+    box.max = glm::vec3(0.5f, 0.5f, farZ);
+    return box;
+  }
+
+  // Depth 0.5 everywhere, as if a wall at z = 0 had been drawn
+  static void ClearToWall() {
+    glViewport(0, 0, 64, 64);
+    glEnable(GL_DEPTH_TEST);
+    glDepthMask(GL_TRUE);
+    glClearDepth(0.5);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  }
+
+  const std::pair<std::string_view, std::string_view> kShaderPaths{
+      "assets/shader/core/bounds.vert", "assets/shader/core/bounds.frag"};
+};
+
+GLFWwindow* OcclusionQueriesTest::window = nullptr;
+
+TEST_F(OcclusionQueriesTest, ReadResultsInLaterFrame) {
+  RecordProperty("Test Description",
+                 "Query a box in front of and a box behind a depth buffer "
+                 "cleared to 0.5, then read the results a frame later");
+  RecordProperty("Expected Result",
+                 "Both draw until the results arrive, then only the front "
+                 "box is visible and one frame of latency is reported");
+
+  OcclusionQueries queries;
+  ASSERT_TRUE(queries.Init(kShaderPaths).ok());
+  const auto kCuller =
+      MakeCuller({MakeBox(-0.6f, -0.2f), MakeBox(0.2f, 0.6f)});
+
+  ClearToWall();
+  queries.BeginFrame();
+  queries.IssueQueries(glm::mat4(1.0f), kCuller);
+  EXPECT_EQ(queries.GetStats().issued, 2u);
+  EXPECT_TRUE(queries.IsVisible(0));
+  EXPECT_TRUE(queries.IsVisible(1));
+
+  // Only so the test knows the results are there; the queries never wait
+  glFinish();
+  queries.BeginFrame();
+  EXPECT_EQ(queries.GetStats().read, 2u);
+  EXPECT_EQ(queries.GetStats().pending, 0u);
+  EXPECT_FLOAT_EQ(queries.GetStats().averageLatency, 1.0f);
+  EXPECT_TRUE(queries.IsVisible(0));
+  EXPECT_FALSE(queries.IsVisible(1));
+
+  // The hidden draw is tested again every frame
+  ClearToWall();
+  queries.IssueQueries(glm::mat4(1.0f), kCuller);
+  EXPECT_EQ(queries.GetStats().issued, 1u);
+  queries.Clear();
+}
+
+TEST_F(OcclusionQueriesTest, DropResultsAfterReset) {
+  RecordProperty("Test Description",
+                 "Reset the draws while a query for a hidden box is in "
+                 "flight");
+  RecordProperty("Expected Result",
+                 "The stale result is read but every draw stays visible");
+
+  OcclusionQueries queries;
+  ASSERT_TRUE(queries.Init(kShaderPaths).ok());
+  const auto kCuller = MakeCuller({MakeBox(0.2f, 0.6f)});
+
+  ClearToWall();
+  queries.BeginFrame();
+  queries.IssueQueries(glm::mat4(1.0f), kCuller);
+  queries.Reset(kCuller.Size());
+
+  glFinish();
+  queries.BeginFrame();
+  EXPECT_EQ(queries.GetStats().read, 1u);
+  EXPECT_TRUE(queries.IsVisible(0));
+  queries.Clear();
+}
+
+TEST_F(OcclusionQueriesTest, InitInvalidPaths) {
+  RecordProperty("Test Description",
+                 "Init with shader files that do not exist");
+  RecordProperty("Expected Result", "Result::err() is true");
+
+  OcclusionQueries queries;
+  EXPECT_TRUE(queries
+                  .Init({"assets/shader/core/does-not-exist.vert",
+                         "assets/shader/core/does-not-exist.frag"})
+                  .err());
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
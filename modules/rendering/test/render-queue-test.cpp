@@ -0,0 +1,151 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <render-queue.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class RenderQueueTest : public ::testing::Test {
+ protected:
+  static uint64_t Key(Mgtt::Rendering::RenderPass pass, uint32_t material,
+                      float depth) {
+    return RenderQueue::MakeKey(pass, 0, material, 0, 1, depth);
+  }
+};
+
+TEST_F(RenderQueueTest, OrderKeys) {
+  RecordProperty("Test Description",
+                 "Compare keys that differ in pass, state and depth");
+  RecordProperty("Expected Result",
+                 "Pass decides first, then state; opaque draws run front "
+                 "to back and blended draws back to front");
+
+  using Mgtt::Rendering::RenderPass;
+  EXPECT_LT(Key(RenderPass::Opaque, 9, 1.0f), Key(RenderPass::Mask, 0, 0.0f));
+  EXPECT_LT(Key(RenderPass::Mask, 9, 1.0f), Key(RenderPass::Blend, 0, 0.0f));
+  EXPECT_LT(Key(RenderPass::Opaque, 1, 0.9f), Key(RenderPass::Opaque, 2, 0.1f));
+  EXPECT_LT(Key(RenderPass::Opaque, 1, 0.1f), Key(RenderPass::Opaque, 1, 0.2f));
+  EXPECT_LT(Key(RenderPass::Blend, 2, 0.9f), Key(RenderPass::Blend, 1, 0.1f));
+  EXPECT_LT(Key(RenderPass::Blend, 1, 0.9f), Key(RenderPass::Blend, 2, 0.9f));
+
+  // Fields are ordered shader, material, texture set, VAO
+  EXPECT_LT(RenderQueue::MakeKey(RenderPass::Opaque, 0, 5, 5, 5, 0.0f),
+            RenderQueue::MakeKey(RenderPass::Opaque, 1, 0, 0, 0, 0.0f));
+  EXPECT_LT(RenderQueue::MakeKey(RenderPass::Opaque, 0, 0, 1, 0, 0.0f),
+            RenderQueue::MakeKey(RenderPass::Opaque, 0, 1, 0, 0, 0.0f));
+  EXPECT_LT(RenderQueue::MakeKey(RenderPass::Opaque, 0, 0, 0, 1, 0.0f),
+            RenderQueue::MakeKey(RenderPass::Opaque, 0, 0, 1, 0, 0.0f));
+  // Out of range values stay within their field
+  EXPECT_EQ(Key(RenderPass::Opaque, 1u << 20, 0.0f),
+            Key(RenderPass::Opaque, (1u << RenderQueue::kMaterialBits) - 1,
+                0.0f));
+  EXPECT_EQ(Key(RenderPass::Opaque, 0, -1.0f),
+            Key(RenderPass::Opaque, 0, 0.0f));
+  EXPECT_EQ(Key(RenderPass::Opaque, 0, 2.0f), Key(RenderPass::Opaque, 0, 1.0f));
+}
+
+TEST_F(RenderQueueTest, SortLikeStableSort) {
+  RecordProperty("Test Description",
+                 "Radix sort random keys with many duplicates");
+  RecordProperty("Expected Result",
+                 "Same order as std::stable_sort, with ranges kept per "
+                 "draw");
+
+  std::mt19937_64 random(42);
+  RenderQueue queue;
+  std::vector<Mgtt::Rendering::DrawItem> expected;
+  for (uint32_t draw = 0; draw < 5000; ++draw) {
+    // Few distinct high bits, as real keys have
+    const uint64_t kKey = (random() % 7) << 58 | (random() % 50) << 20 |
+                          (random() & 0xfff);
+    queue.AddRange(draw, 3);
+    if (draw % 3 == 0) {
+      queue.AddRange(draw + 100, 6);
+    }
+    queue.Push(kKey, draw, 0);
+    expected.push_back({kKey, draw, 0, 0, 0});
+  }
+  // Without ranges nothing is queued
+  queue.Push(0, 0, 0);
+  ASSERT_EQ(queue.GetItems().size(), expected.size());
+
+  queue.Sort();
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const DrawItem& lhs, const DrawItem& rhs) {
+                     return lhs.key < rhs.key;
+                   });
+  for (size_t idx = 0; idx < expected.size(); ++idx) {
+    const auto& item = queue.GetItems()[idx];
+    ASSERT_EQ(item.key, expected[idx].key) << idx;
+    ASSERT_EQ(item.batch, expected[idx].batch) << idx;
+    ASSERT_EQ(item.rangeCount, item.batch % 3 == 0 ? 2u : 1u);
+    EXPECT_EQ(queue.GetRange(item.firstRange).firstIndex, item.batch);
+  }
+
+  queue.BeginFrame();
+  EXPECT_TRUE(queue.GetItems().empty());
+}
+
+TEST_F(RenderQueueTest, AssignStateIds) {
+  RecordProperty("Test Description",
+                 "Number three primitives, two with equal factors and two "
+                 "with equal textures");
+  RecordProperty("Expected Result",
+                 "Equal materials and texture sets share an id");
+
+  std::vector<Mgtt::Rendering::InstanceBatch> batches(2);
+  batches[0].mesh = std::make_shared<Mgtt::Rendering::Mesh>();
+  batches[0].mesh->meshPrimitives.resize(2);
+  batches[0].mesh->meshPrimitives[0].pbrMaterial.baseColorTexture.id = 3;
+  batches[0].mesh->meshPrimitives[1].pbrMaterial.baseColorTexture.id = 4;
+  batches[0].mesh->meshPrimitives[1].pbrMaterial.alphaCutoff = 0.5f;
+  batches[1].mesh = std::make_shared<Mgtt::Rendering::Mesh>();
+  batches[1].mesh->meshPrimitives.resize(1);
+  batches[1].mesh->meshPrimitives[0].pbrMaterial.baseColorTexture.id = 3;
+  batches[1].mesh->meshPrimitives[0].pbrMaterial.alphaMode =
+      Mgtt::Rendering::AlphaMode::MASK;
+
+  RenderQueue queue;
+  queue.AssignStateIds(batches);
+  EXPECT_EQ(queue.GetMaterialCount(), 2u);
+  EXPECT_EQ(queue.GetTextureSetCount(), 2u);
+  EXPECT_EQ(queue.GetMaterialId(0, 0), queue.GetMaterialId(1, 0));
+  EXPECT_NE(queue.GetMaterialId(0, 0), queue.GetMaterialId(0, 1));
+  EXPECT_EQ(queue.GetTextureSetId(0, 0), queue.GetTextureSetId(1, 0));
+  EXPECT_NE(queue.GetTextureSetId(0, 0), queue.GetTextureSetId(0, 1));
+  EXPECT_EQ(
+      RenderQueue::GetPass(batches[1].mesh->meshPrimitives[0].pbrMaterial),
+      Mgtt::Rendering::RenderPass::Mask);
+
+  queue.Clear();
+  EXPECT_EQ(queue.GetMaterialCount(), 0u);
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
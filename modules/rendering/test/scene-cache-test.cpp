@@ -0,0 +1,396 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <scene-cache.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class SceneCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    directory = ::testing::TempDir() + "scene-cache-test";
+    std::filesystem::remove_all(directory);
+    sourcePath = ::testing::TempDir() + "scene-cache-test.gltf";
+    std::ofstream(sourcePath) << "{\"asset\":{\"version\":\"2.0\"}}";
+    cache.SetDirectory(directory);
+  }
+
+  void TearDown() override {
+    for (auto* scene : {&source, &loaded}) {
+      for (auto& [key, texture] : scene->textureMap) {
+        std::free(texture.data);
+        texture.data = nullptr;
+      }
+    }
+    std::filesystem::remove_all(directory);
+  }
+
+  /**
+   * @brief Two root nodes sharing one mesh, one of them with a child and
+   * instance matrices, plus a single 2x2 RGBA texture.
+   */
+  void BuildSourceScene() {
+    Mgtt::Rendering::Texture texture;
+    texture.name = "albedo";
+    texture.path = "albedo.png";
+    texture.width = 2;
+    texture.height = 2;
+    texture.nrComponents = 4;
+    texture.data = static_cast<unsigned char*>(std::malloc(16));
+    for (int idx = 0; idx < 16; ++idx) {
+      texture.data[idx] = static_cast<unsigned char>(idx * 7);
+    }
+    source.textureMap["albedo.png"] = texture;
+
+    auto mesh = std::make_shared<Mgtt::Rendering::Mesh>();
+    mesh->name = "triangle";
+    mesh->indices = {0, 1, 2};
+    mesh->vertexPositionAttribs = {
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    mesh->vertexNormalAttribs = {
+        {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}};
+    mesh->vertexTextureAttribs = {{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}};
+    mesh->vertexTangentAttribs.assign(3, glm::vec4(1.0f, 0.0f, 0.0f, -1.0f));
+    Mgtt::Rendering::MeshPrimitive prim;
+    prim.indexCount = 3;
+    prim.vertexCount = 3;
+    prim.hasIndices = true;
+    prim.pbrMaterial.name = "painted";
+    prim.pbrMaterial.alphaMode = Mgtt::Rendering::AlphaMode::MASK;
+    prim.pbrMaterial.alphaCutoff = 0.25f;
+    prim.pbrMaterial.baseColorTexture.path = texture.path;
+    prim.pbrMaterial.baseColorTexture.color = glm::vec4(0.5f);
+    prim.pbrMaterial.metallicRoughnessTexture.roughnessFactor = 0.75f;
+    mesh->meshPrimitives.push_back(std::move(prim));
+
+    const uint32_t kFirst = source.AddNode();
+    const uint32_t kChild = source.AddNode(kFirst);
+    const uint32_t kSecond = source.AddNode();
+
+    auto& first = source.nodes[kFirst];
+    first.name = "first";
+    first.mesh = mesh;
+    first.instanceMatrices = {glm::mat4(1.0f), glm::mat4(2.0f)};
+    auto& child = source.nodes[kChild];
+    child.name = "child";
+    child.pos = glm::vec3(1.0f, 2.0f, 3.0f);
+    auto& second = source.nodes[kSecond];
+    second.name = "second";
+    second.mesh = mesh;
+    second.worldMatrix = glm::mat4(3.0f);
+    source.aabb.min = glm::vec3(-1.0f);
+    source.aabb.max = glm::vec3(1.0f);
+    source.aabb.scale = 2.0f;
+  }
+
+  Mgtt::Rendering::SceneCache cache;
+  Mgtt::Rendering::Scene source;
+  Mgtt::Rendering::Scene loaded;
+  std::string directory;
+  std::string sourcePath;
+};
+
+TEST_F(SceneCacheTest, RoundTripScene) {
+  RecordProperty("Test Description",
+                 "A saved scene loads back with the same content");
+  RecordProperty("Expected Result",
+                 "Hierarchy, shared mesh, material and pixels are restored");
+
+  BuildSourceScene();
+  const auto kSaveResult = cache.Save(source, sourcePath);
+  ASSERT_TRUE(kSaveResult.ok()) << kSaveResult.error();
+  const auto kLoadResult = cache.Load(loaded, sourcePath);
+  ASSERT_TRUE(kLoadResult.ok()) << kLoadResult.error();
+
+  ASSERT_EQ(loaded.textureMap.size(), 1u);
+  const auto& texture = loaded.textureMap.at("albedo.png");
+  ASSERT_NE(texture.data, nullptr);
+  EXPECT_NE(texture.data, source.textureMap.at("albedo.png").data);
+  EXPECT_EQ(std::memcmp(texture.data,
+                        source.textureMap.at("albedo.png").data, 16),
+            0);
+
+  ASSERT_EQ(loaded.nodes.size(), 3u);
+  EXPECT_EQ(loaded.rootNodes, std::vector<uint32_t>({0, 2}));
+  const auto& first = loaded.nodes[0];
+  const auto& second = loaded.nodes[2];
+  EXPECT_EQ(first.name, "first");
+  ASSERT_NE(first.mesh, nullptr);
+  EXPECT_EQ(first.mesh, second.mesh);
+  EXPECT_EQ(first.instanceMatrices.size(), 2u);
+  EXPECT_EQ(second.worldMatrix, glm::mat4(3.0f));
+  ASSERT_EQ(first.children, std::vector<uint32_t>({1}));
+  const auto& child = loaded.nodes[1];
+  EXPECT_EQ(child.pos, glm::vec3(1.0f, 2.0f, 3.0f));
+  EXPECT_EQ(child.parent, 0u);
+  EXPECT_EQ(child.mesh, nullptr);
+
+  const auto& mesh = *first.mesh;
+  EXPECT_EQ(mesh.indices, std::vector<uint32_t>({0, 1, 2}));
+  EXPECT_EQ(mesh.vertexPositionAttribs.size(), 3u);
+  ASSERT_EQ(mesh.vertexTangentAttribs.size(), 3u);
+  EXPECT_EQ(mesh.vertexTangentAttribs[2], glm::vec4(1.0f, 0.0f, 0.0f, -1.0f));
+  ASSERT_EQ(mesh.meshPrimitives.size(), 1u);
+  const auto& material = mesh.meshPrimitives[0].pbrMaterial;
+  EXPECT_EQ(material.name, "painted");
+  EXPECT_EQ(material.alphaMode, Mgtt::Rendering::AlphaMode::MASK);
+  EXPECT_FLOAT_EQ(material.alphaCutoff, 0.25f);
+  EXPECT_EQ(material.baseColorTexture.color, glm::vec4(0.5f));
+  EXPECT_EQ(material.baseColorTexture.width, 2);
+  EXPECT_FLOAT_EQ(material.metallicRoughnessTexture.roughnessFactor, 0.75f);
+  EXPECT_FLOAT_EQ(loaded.aabb.scale, 2.0f);
+}
+
+TEST_F(SceneCacheTest, ModifiedSourceMisses) {
+  RecordProperty("Test Description",
+                 "Load rejects an entry whose source changed since Save");
+  RecordProperty("Expected Result", "Result::err() is true, scene untouched");
+
+  BuildSourceScene();
+  ASSERT_TRUE(cache.Save(source, sourcePath).ok());
+
+  std::ofstream(sourcePath, std::ios::app) << ' ';
+  std::filesystem::last_write_time(
+      sourcePath,
+      std::filesystem::last_write_time(sourcePath) + std::chrono::seconds(5));
+
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).err());
+  EXPECT_TRUE(loaded.nodes.empty());
+  EXPECT_TRUE(loaded.textureMap.empty());
+}
+
+TEST_F(SceneCacheTest, ImportOptionsMismatchMisses) {
+  RecordProperty("Test Description",
+                 "Load rejects an entry written with other import options");
+  RecordProperty("Expected Result",
+                 "Result::err() is true until the options match again");
+
+  BuildSourceScene();
+  cache.SetImportOptions("optimize");
+  ASSERT_TRUE(cache.Save(source, sourcePath).ok());
+
+  cache.SetImportOptions("");
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).err());
+  EXPECT_TRUE(loaded.nodes.empty());
+
+  cache.SetImportOptions("optimize");
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).ok());
+}
+
+TEST_F(SceneCacheTest, DependencyChangeMisses) {
+  RecordProperty("Test Description",
+                 "Load rejects an entry once an external file of the source "
+                 "changes or a missing one appears");
+  RecordProperty("Expected Result",
+                 "Result::ok() while the dependencies are unchanged, "
+                 "Result::err() after each change");
+
+  BuildSourceScene();
+  const std::string kBufferPath = ::testing::TempDir() + "scene-cache.bin";
+  const std::string kImagePath = ::testing::TempDir() + "scene-cache.png";
+  std::filesystem::remove(kImagePath);
+  std::ofstream(kBufferPath) << "0123";
+  const std::vector<std::string> kDependencies = {kBufferPath, kImagePath};
+
+  ASSERT_TRUE(cache.Save(source, sourcePath, kDependencies).ok());
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).ok());
+  for (auto& [key, texture] : loaded.textureMap) {
+    std::free(texture.data);
+    texture.data = nullptr;
+  }
+  loaded.Clear();
+
+  std::ofstream(kBufferPath) << "012345";
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).err());
+  EXPECT_TRUE(loaded.nodes.empty());
+
+  ASSERT_TRUE(cache.Save(source, sourcePath, kDependencies).ok());
+  std::ofstream(kImagePath) << "png";
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).err());
+  EXPECT_TRUE(loaded.nodes.empty());
+
+  std::filesystem::remove(kBufferPath);
+  std::filesystem::remove(kImagePath);
+}
+
+TEST_F(SceneCacheTest, CorruptEntryMisses) {
+  RecordProperty("Test Description",
+                 "Load rejects a truncated or version-mismatched entry");
+  RecordProperty("Expected Result", "Result::err() is true, scene untouched");
+
+  BuildSourceScene();
+  ASSERT_TRUE(cache.Save(source, sourcePath).ok());
+  const std::string kEntryPath = cache.EntryPath(sourcePath);
+
+  std::filesystem::resize_file(kEntryPath,
+                               std::filesystem::file_size(kEntryPath) - 8);
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).err());
+  EXPECT_TRUE(loaded.nodes.empty());
+
+  ASSERT_TRUE(cache.Save(source, sourcePath).ok());
+  {
+    std::fstream entry(kEntryPath,
+                       std::ios::binary | std::ios::in | std::ios::out);
+    const uint32_t kVersion = SceneCache::kFormatVersion + 1;
+    entry.seekp(sizeof(uint32_t));
+    entry.write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+  }
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).err());
+  EXPECT_TRUE(loaded.nodes.empty());
+}
+
+TEST_F(SceneCacheTest, OutOfRangeIndexMisses) {
+  RecordProperty("Test Description",
+                 "Load rejects an entry with an index past the vertex count");
+  RecordProperty("Expected Result", "Result::err() is true, scene untouched");
+
+  BuildSourceScene();
+  source.nodes[0].mesh->indices = {0, 1, 3};
+  ASSERT_TRUE(cache.Save(source, sourcePath).ok());
+
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).err());
+  EXPECT_TRUE(loaded.nodes.empty());
+  EXPECT_TRUE(loaded.textureMap.empty());
+}
+
+TEST_F(SceneCacheTest, ShortAttributeArrayMisses) {
+  RecordProperty("Test Description",
+                 "Load rejects an entry whose vertex attribute array is "
+                 "neither empty nor as long as the positions");
+  RecordProperty("Expected Result",
+                 "Result::err() is true for a short attribute, ok for an "
+                 "absent one");
+
+  BuildSourceScene();
+  auto& mesh = *source.nodes[0].mesh;
+  mesh.vertexTextureAttribs.pop_back();
+  ASSERT_TRUE(cache.Save(source, sourcePath).ok());
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).err());
+  EXPECT_TRUE(loaded.nodes.empty());
+
+  mesh.vertexTextureAttribs.clear();
+  ASSERT_TRUE(cache.Save(source, sourcePath).ok());
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).ok());
+}
+
+TEST_F(SceneCacheTest, SaveAsyncWritesOnFlush) {
+  RecordProperty("Test Description",
+                 "SaveAsync encodes the scene immediately and writes the "
+                 "entry in the background");
+  RecordProperty("Expected Result",
+                 "The entry loads after Flush() even though the pixels were "
+                 "released right after SaveAsync()");
+
+  BuildSourceScene();
+  ASSERT_TRUE(cache.SaveAsync(source, sourcePath).ok());
+  auto& texture = source.textureMap.at("albedo.png");
+  std::free(texture.data);
+  texture.data = nullptr;
+
+  const auto kFlushResult = cache.Flush();
+  ASSERT_TRUE(kFlushResult.ok()) << kFlushResult.error();
+  ASSERT_TRUE(cache.Load(loaded, sourcePath).ok());
+  ASSERT_EQ(loaded.textureMap.size(), 1u);
+  EXPECT_EQ(loaded.textureMap.at("albedo.png").data[15], 15 * 7);
+  EXPECT_TRUE(cache.SaveAsync(source, sourcePath).err());
+}
+
+TEST_F(SceneCacheTest, MovedFromCacheWritesSynchronously) {
+  RecordProperty("Test Description",
+                 "SaveAsync and Flush on a moved-from cache do not need its "
+                 "write queue");
+  RecordProperty("Expected Result",
+                 "Both return Ok and the entry is written before SaveAsync "
+                 "returns");
+
+  BuildSourceScene();
+  Mgtt::Rendering::SceneCache moved(std::move(cache));
+  cache.SetDirectory(directory);
+  ASSERT_TRUE(cache.SaveAsync(source, sourcePath).ok());
+  EXPECT_TRUE(std::filesystem::exists(cache.EntryPath(sourcePath)));
+  EXPECT_TRUE(cache.Flush().ok());
+  EXPECT_TRUE(moved.Flush().ok());
+}
+
+TEST_F(SceneCacheTest, SizeLimitEvictsLeastRecentlyUsed) {
+  RecordProperty("Test Description",
+                 "Writing past the size limit evicts the entries that were "
+                 "loaded or saved longest ago");
+  RecordProperty("Expected Result",
+                 "The stale entry is removed, the recently loaded and the "
+                 "new entry are kept");
+
+  BuildSourceScene();
+  std::vector<std::string> sources;
+  for (const char* kName : {"lru-a.gltf", "lru-b.gltf", "lru-c.gltf"}) {
+    sources.push_back(::testing::TempDir() + kName);
+    std::ofstream(sources.back()) << "{\"asset\":{\"version\":\"2.0\"}}";
+  }
+
+  ASSERT_TRUE(cache.Save(source, sources[0]).ok());
+  const auto kEntrySize =
+      std::filesystem::file_size(cache.EntryPath(sources[0]));
+  cache.SetSizeLimit(2 * kEntrySize + kEntrySize / 2);
+  ASSERT_TRUE(cache.Save(source, sources[1]).ok());
+
+  // a was saved first, but loading it makes b the least recently used
+  const auto kOld = std::filesystem::file_time_type::clock::now() -
+                    std::chrono::hours(1);
+  std::filesystem::last_write_time(cache.EntryPath(sources[0]), kOld);
+  std::filesystem::last_write_time(cache.EntryPath(sources[1]),
+                                   kOld + std::chrono::minutes(1));
+  ASSERT_TRUE(cache.Load(loaded, sources[0]).ok());
+
+  ASSERT_TRUE(cache.Save(source, sources[2]).ok());
+  EXPECT_TRUE(std::filesystem::exists(cache.EntryPath(sources[0])));
+  EXPECT_FALSE(std::filesystem::exists(cache.EntryPath(sources[1])));
+  EXPECT_TRUE(std::filesystem::exists(cache.EntryPath(sources[2])));
+
+  for (const auto& path : sources) {
+    std::filesystem::remove(path);
+  }
+}
+
+TEST_F(SceneCacheTest, DisabledCache) {
+  RecordProperty("Test Description",
+                 "An empty directory disables the cache");
+  RecordProperty("Expected Result", "Save and Load return Err");
+
+  cache.SetDirectory("");
+  EXPECT_FALSE(cache.IsEnabled());
+  EXPECT_TRUE(cache.Save(source, sourcePath).err());
+  EXPECT_TRUE(cache.Load(loaded, sourcePath).err());
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
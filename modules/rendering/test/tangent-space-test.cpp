@@ -0,0 +1,236 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <tangent-space.h>
+
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class TangentSpaceTest : public ::testing::Test {
+ protected:
+  /**
+   * @brief Quad of four shared vertices in the xy plane. Texture coordinates
+   * follow x and y, or run against x when mirrored.
+   */
+  static void BuildQuad(Mgtt::Rendering::Mesh& mesh, bool mirrored) {
+    mesh.vertexPositionAttribs = {{0.0f, 0.0f, 0.0f},
+                                  {1.0f, 0.0f, 0.0f},
+                                  {1.0f, 1.0f, 0.0f},
+                                  {0.0f, 1.0f, 0.0f}};
+    for (const auto& position : mesh.vertexPositionAttribs) {
+      mesh.vertexTextureAttribs.emplace_back(
+          mirrored ? 1.0f - position.x : position.x, position.y);
+    }
+    mesh.indices = {0, 1, 2, 0, 2, 3};
+    mesh.meshPrimitives.resize(1);
+    mesh.meshPrimitives[0].indexCount = 6;
+    mesh.meshPrimitives[0].vertexCount = 4;
+    mesh.meshPrimitives[0].hasIndices = true;
+  }
+
+  /**
+   * @brief Append a bumpy grid with its own vertices as a new primitive.
+   */
+  static void AppendGrid(Mgtt::Rendering::Mesh& mesh, uint32_t size,
+                         float phase) {
+    const auto kBase =
+        static_cast<uint32_t>(mesh.vertexPositionAttribs.size());
+    Mgtt::Rendering::MeshPrimitive prim;
+    prim.firstIndex = static_cast<uint32_t>(mesh.indices.size());
+    for (uint32_t y = 0; y <= size; ++y) {
+      for (uint32_t x = 0; x <= size; ++x) {
+        const float kHeight = 0.2f * std::sin(phase + 0.7f * x + 1.3f * y);
+        mesh.vertexPositionAttribs.emplace_back(x, y, kHeight);
+        mesh.vertexTextureAttribs.emplace_back(x * 0.25f, y * 0.5f);
+      }
+    }
+    for (uint32_t y = 0; y < size; ++y) {
+      for (uint32_t x = 0; x < size; ++x) {
+        const uint32_t kCorner = kBase + y * (size + 1) + x;
+        mesh.indices.insert(mesh.indices.end(),
+                            {kCorner, kCorner + 1, kCorner + size + 2, kCorner,
+                             kCorner + size + 2, kCorner + size + 1});
+      }
+    }
+    prim.indexCount =
+        static_cast<uint32_t>(mesh.indices.size()) - prim.firstIndex;
+    prim.vertexCount = (size + 1) * (size + 1);
+    prim.hasIndices = true;
+    mesh.meshPrimitives.push_back(std::move(prim));
+  }
+
+  static void ExpectNear(const glm::vec3& actual, const glm::vec3& expected) {
+    EXPECT_NEAR(actual.x, expected.x, 1.0e-5f);
+    EXPECT_NEAR(actual.y, expected.y, 1.0e-5f);
+    EXPECT_NEAR(actual.z, expected.z, 1.0e-5f);
+  }
+};
+
+TEST_F(TangentSpaceTest, GenerateMissingNormals) {
+  RecordProperty("Test Description",
+                 "Generate normals for two triangles folded along a shared "
+                 "edge");
+  RecordProperty("Expected Result",
+                 "Shared vertices are smoothed, the others keep the face "
+                 "normal");
+
+  Mgtt::Rendering::Mesh mesh;
+  mesh.vertexPositionAttribs = {{0.0f, 0.0f, 0.0f},
+                                {1.0f, 0.0f, 0.0f},
+                                {0.0f, 1.0f, 0.0f},
+                                {0.0f, 0.0f, 1.0f}};
+  mesh.indices = {0, 1, 2, 1, 0, 3};
+  mesh.meshPrimitives.resize(1);
+  mesh.meshPrimitives[0].indexCount = 6;
+  mesh.meshPrimitives[0].vertexCount = 4;
+  mesh.meshPrimitives[0].hasIndices = true;
+
+  const auto kResult = GenerateTangentSpace(mesh);
+  ASSERT_TRUE(kResult.ok()) << kResult.error();
+  EXPECT_EQ(kResult.value(), 4u);
+  ASSERT_EQ(mesh.vertexNormalAttribs.size(), 4u);
+  ASSERT_EQ(mesh.vertexTangentAttribs.size(), 4u);
+  const float kHalf = std::sqrt(0.5f);
+  ExpectNear(mesh.vertexNormalAttribs[0], glm::vec3(0.0f, kHalf, kHalf));
+  ExpectNear(mesh.vertexNormalAttribs[1], glm::vec3(0.0f, kHalf, kHalf));
+  ExpectNear(mesh.vertexNormalAttribs[2], glm::vec3(0.0f, 0.0f, 1.0f));
+  ExpectNear(mesh.vertexNormalAttribs[3], glm::vec3(0.0f, 1.0f, 0.0f));
+  // No texture coordinates, tangents only need to be perpendicular
+  for (size_t vertex = 0; vertex < 4; ++vertex) {
+    const glm::vec3 kTangent(mesh.vertexTangentAttribs[vertex]);
+    EXPECT_NEAR(glm::length(kTangent), 1.0f, 1.0e-5f);
+    EXPECT_NEAR(glm::dot(kTangent, mesh.vertexNormalAttribs[vertex]), 0.0f,
+                1.0e-5f);
+    EXPECT_EQ(mesh.vertexTangentAttribs[vertex].w, 1.0f);
+  }
+}
+
+TEST_F(TangentSpaceTest, TangentsFollowTextureCoordinates) {
+  RecordProperty("Test Description",
+                 "Generate tangents for a quad with regular and mirrored "
+                 "texture coordinates");
+  RecordProperty("Expected Result",
+                 "Tangents point along +u with the bitangent sign in w");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildQuad(mesh, false);
+  ASSERT_TRUE(GenerateTangentSpace(mesh).ok());
+  for (const auto& tangent : mesh.vertexTangentAttribs) {
+    ExpectNear(glm::vec3(tangent), glm::vec3(1.0f, 0.0f, 0.0f));
+    EXPECT_EQ(tangent.w, 1.0f);
+  }
+
+  Mgtt::Rendering::Mesh mirrored;
+  BuildQuad(mirrored, true);
+  ASSERT_TRUE(GenerateTangentSpace(mirrored).ok());
+  for (size_t vertex = 0; vertex < 4; ++vertex) {
+    ExpectNear(mirrored.vertexNormalAttribs[vertex],
+               glm::vec3(0.0f, 0.0f, 1.0f));
+    ExpectNear(glm::vec3(mirrored.vertexTangentAttribs[vertex]),
+               glm::vec3(-1.0f, 0.0f, 0.0f));
+    EXPECT_EQ(mirrored.vertexTangentAttribs[vertex].w, -1.0f);
+  }
+}
+
+TEST_F(TangentSpaceTest, KeepExistingAttributes) {
+  RecordProperty("Test Description",
+                 "Generate with some normals and tangents already present");
+  RecordProperty("Expected Result",
+                 "Present values are untouched, only the rest is counted");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildQuad(mesh, false);
+  mesh.vertexNormalAttribs = {{0.0f, 0.0f, 1.0f},
+                              {0.0f, 0.0f, 1.0f},
+                              {0.0f, 0.0f, 1.0f},
+                              {0.0f, 0.0f, 1.0f}};
+  mesh.vertexTangentAttribs.assign(4, glm::vec4(0.0f, 1.0f, 0.0f, -1.0f));
+  mesh.vertexTangentAttribs[2] = glm::vec4(0.0f);
+
+  const auto kResult = GenerateTangentSpace(mesh);
+  ASSERT_TRUE(kResult.ok()) << kResult.error();
+  EXPECT_EQ(kResult.value(), 1u);
+  EXPECT_EQ(mesh.vertexTangentAttribs[0], glm::vec4(0.0f, 1.0f, 0.0f, -1.0f));
+  EXPECT_EQ(mesh.vertexTangentAttribs[2], glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+
+  EXPECT_EQ(GenerateTangentSpace(mesh).value(), 0u);
+}
+
+TEST_F(TangentSpaceTest, ParallelMatchesSerial) {
+  RecordProperty("Test Description",
+                 "Generate the same multi-primitive mesh with 1 and 4 "
+                 "threads");
+  RecordProperty("Expected Result",
+                 "Identical normals and tangents, unit length and "
+                 "orthogonal");
+
+  Mgtt::Rendering::Mesh serial;
+  Mgtt::Rendering::Mesh parallel;
+  for (uint32_t grid = 0; grid < 6; ++grid) {
+    AppendGrid(serial, 5 + grid, 0.5f * grid);
+    AppendGrid(parallel, 5 + grid, 0.5f * grid);
+  }
+
+  const auto kSerial = GenerateTangentSpace(serial, 1);
+  const auto kParallel = GenerateTangentSpace(parallel, 4);
+  ASSERT_TRUE(kSerial.ok() && kParallel.ok());
+  EXPECT_EQ(kSerial.value(), serial.vertexPositionAttribs.size());
+  EXPECT_EQ(kParallel.value(), kSerial.value());
+  EXPECT_EQ(parallel.vertexNormalAttribs, serial.vertexNormalAttribs);
+  EXPECT_EQ(parallel.vertexTangentAttribs, serial.vertexTangentAttribs);
+  for (size_t vertex = 0; vertex < serial.vertexNormalAttribs.size();
+       ++vertex) {
+    const glm::vec3& kNormal = serial.vertexNormalAttribs[vertex];
+    const glm::vec3 kTangent(serial.vertexTangentAttribs[vertex]);
+    EXPECT_NEAR(glm::length(kNormal), 1.0f, 1.0e-5f);
+    EXPECT_NEAR(glm::length(kTangent), 1.0f, 1.0e-5f);
+    EXPECT_NEAR(glm::dot(kNormal, kTangent), 0.0f, 1.0e-5f);
+    EXPECT_GT(kTangent.x, 0.0f);
+    EXPECT_EQ(serial.vertexTangentAttribs[vertex].w, 1.0f);
+  }
+}
+
+TEST_F(TangentSpaceTest, RejectInvalidMesh) {
+  RecordProperty("Test Description",
+                 "Generate for an out-of-range index and mismatched "
+                 "attributes");
+  RecordProperty("Expected Result", "Both return an error");
+
+  Mgtt::Rendering::Mesh badIndex;
+  BuildQuad(badIndex, false);
+  badIndex.indices[4] = 9;
+  EXPECT_TRUE(GenerateTangentSpace(badIndex).err());
+
+  Mgtt::Rendering::Mesh badNormals;
+  BuildQuad(badNormals, false);
+  badNormals.vertexNormalAttribs.resize(3);
+  EXPECT_TRUE(GenerateTangentSpace(badNormals).err());
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
@@ -0,0 +1,183 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <node.h>
+#include <scene.h>
+#include <transform-hierarchy.h>
+
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class TransformHierarchyTest : public ::testing::Test {
+ protected:
+  static uint32_t AddChild(Mgtt::Rendering::Scene& scene, uint32_t parent,
+                           const glm::vec3& pos) {
+    const uint32_t kIndex = scene.AddNode(parent);
+    scene.nodes[kIndex].pos = pos;
+    return kIndex;
+  }
+
+  static void ExpectNear(const glm::mat4& actual, const glm::mat4& expected) {
+    for (int col = 0; col < 4; ++col) {
+      for (int row = 0; row < 4; ++row) {
+        EXPECT_NEAR(actual[col][row], expected[col][row], 1.0e-4f);
+      }
+    }
+  }
+
+  [[nodiscard]] const Mgtt::Rendering::Node& NodeAt(uint32_t index) const {
+    return scene_.nodes[index];
+  }
+
+  void ExpectGlobal(uint32_t index) const {
+    ExpectNear(NodeAt(index).worldMatrix,
+               NodeAt(index).GetGlobalMatrix(scene_.nodes));
+  }
+
+  /**
+   * @brief root -> (a -> a0, b), each node translated and the root rotated
+   * and scaled.
+   */
+  void SetUp() override {
+    root_ = scene_.AddNode();
+    auto& root = scene_.nodes[root_];
+    root.pos = glm::vec3(1.0f, 2.0f, 3.0f);
+    // 90 degrees around z
+    root.rot = glm::quat(0.70710678f, 0.0f, 0.0f, 0.70710678f);
+    root.scale = glm::vec3(2.0f);
+    a_ = AddChild(scene_, root_, glm::vec3(1.0f, 0.0f, 0.0f));
+    a0_ = AddChild(scene_, a_, glm::vec3(0.0f, 1.0f, 0.0f));
+    scene_.nodes[a0_].matrix[3] = glm::vec4(0.0f, 0.0f, 5.0f, 1.0f);
+    b_ = AddChild(scene_, root_, glm::vec3(0.0f, 0.0f, 1.0f));
+  }
+
+  Mgtt::Rendering::Scene scene_;
+  uint32_t root_{0};
+  uint32_t a_{0};
+  uint32_t a0_{0};
+  uint32_t b_{0};
+};
+
+TEST_F(TransformHierarchyTest, BuildInPreOrder) {
+  RecordProperty("Test Description",
+                 "Flatten a small hierarchy and compute its world matrices");
+  RecordProperty("Expected Result",
+                 "Parents precede children, subtrees are contiguous and "
+                 "world matrices match Node::GetGlobalMatrix()");
+
+  TransformHierarchy hierarchy;
+  hierarchy.Build(scene_.nodes, scene_.rootNodes);
+
+  ASSERT_EQ(hierarchy.Size(), 4u);
+  EXPECT_EQ(hierarchy.GetNodeIndex(0), root_);
+  EXPECT_EQ(hierarchy.GetNodeIndex(1), a_);
+  EXPECT_EQ(hierarchy.GetNodeIndex(2), a0_);
+  EXPECT_EQ(hierarchy.GetNodeIndex(3), b_);
+  EXPECT_EQ(hierarchy.GetParent(0), TransformHierarchy::kNoParent);
+  EXPECT_EQ(hierarchy.GetParent(2), 1u);
+  EXPECT_EQ(hierarchy.GetParent(3), 0u);
+  EXPECT_EQ(hierarchy.GetSubtreeEnd(0), 4u);
+  EXPECT_EQ(hierarchy.GetSubtreeEnd(1), 3u);
+  EXPECT_EQ(hierarchy.GetSubtreeEnd(3), 4u);
+
+  for (size_t slot = 0; slot < hierarchy.Size(); ++slot) {
+    const auto& node = NodeAt(hierarchy.GetNodeIndex(slot));
+    ExpectNear(hierarchy.GetWorldMatrix(slot),
+               node.GetGlobalMatrix(scene_.nodes));
+    EXPECT_EQ(node.worldMatrix, hierarchy.GetWorldMatrix(slot));
+    EXPECT_FALSE(hierarchy.IsDirty(slot));
+  }
+  // (0, 1, 0) + (1, 0, 0) + (0, 0, 5) rotated to (-1, 1, 5), doubled
+  EXPECT_NEAR(NodeAt(a0_).worldMatrix[3].x, -1.0f, 1.0e-4f);
+  EXPECT_NEAR(NodeAt(a0_).worldMatrix[3].y, 4.0f, 1.0e-4f);
+  EXPECT_NEAR(NodeAt(a0_).worldMatrix[3].z, 13.0f, 1.0e-4f);
+}
+
+TEST_F(TransformHierarchyTest, UpdateDirtySubtreeOnly) {
+  RecordProperty("Test Description",
+                 "Move one inner node and update the hierarchy twice");
+  RecordProperty("Expected Result",
+                 "Only the node and its descendants are recomputed, a second "
+                 "update does nothing");
+
+  TransformHierarchy hierarchy;
+  hierarchy.Build(scene_.nodes, scene_.rootNodes);
+  const glm::mat4 kSiblingWorld = NodeAt(b_).worldMatrix;
+
+  hierarchy.SetTranslation(1, glm::vec3(0.0f, 0.0f, 2.0f));
+  EXPECT_TRUE(hierarchy.IsDirty(1));
+  EXPECT_EQ(hierarchy.Update(scene_.nodes), 2u);
+  EXPECT_EQ(hierarchy.Update(scene_.nodes), 0u);
+  EXPECT_EQ(NodeAt(a_).pos, glm::vec3(0.0f, 0.0f, 2.0f));
+
+  ExpectGlobal(a_);
+  ExpectGlobal(a0_);
+  EXPECT_EQ(NodeAt(b_).worldMatrix, kSiblingWorld);
+
+  // Dirty nodes in separate subtrees are both picked up
+  hierarchy.SetScale(3, glm::vec3(0.5f));
+  hierarchy.SetMatrix(2, glm::mat4(1.0f));
+  EXPECT_EQ(hierarchy.Update(scene_.nodes), 2u);
+  ExpectGlobal(a0_);
+  ExpectGlobal(b_);
+
+  hierarchy.SetRotation(0, glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+  EXPECT_EQ(hierarchy.Update(scene_.nodes), 4u);
+  ExpectGlobal(a0_);
+}
+
+TEST_F(TransformHierarchyTest, DeepChain) {
+  RecordProperty("Test Description",
+                 "Build a chain of 100000 nodes, move its root and clear it");
+  RecordProperty("Expected Result",
+                 "No recursion limits, the leaf follows the root and the "
+                 "scene is empty afterwards");
+
+  constexpr uint32_t kDepth = 100000;
+  Mgtt::Rendering::Scene chain;
+  uint32_t leaf = chain.AddNode();
+  for (uint32_t depth = 1; depth < kDepth; ++depth) {
+    leaf = AddChild(chain, leaf, glm::vec3(1.0f, 0.0f, 0.0f));
+  }
+  ASSERT_EQ(chain.rootNodes.size(), 1u);
+  EXPECT_EQ(chain.nodes[leaf].parent, leaf - 1);
+
+  TransformHierarchy hierarchy;
+  hierarchy.Build(chain.nodes, chain.rootNodes);
+  ASSERT_EQ(hierarchy.Size(), kDepth);
+  EXPECT_EQ(hierarchy.GetNodeIndex(kDepth - 1), leaf);
+  EXPECT_NEAR(chain.nodes[leaf].worldMatrix[3].x, kDepth - 1.0f, 1.0f);
+
+  hierarchy.SetTranslation(0, glm::vec3(0.0f, 3.0f, 0.0f));
+  EXPECT_EQ(hierarchy.Update(chain.nodes), kDepth);
+  EXPECT_NEAR(chain.nodes[leaf].worldMatrix[3].y, 3.0f, 1.0e-4f);
+
+  chain.Clear();
+  EXPECT_TRUE(chain.nodes.empty());
+  EXPECT_TRUE(chain.rootNodes.empty());
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
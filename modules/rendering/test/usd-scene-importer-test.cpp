@@ -153,7 +153,7 @@ TEST_F(UsdSceneImporterTest, LoadValidUsdFile) {
   EXPECT_FALSE(mgttScene.path.empty());
   EXPECT_FALSE(mgttScene.nodes.empty());
 
-  const auto& meshAfterLoad = mgttScene.nodes[0]->mesh;
+  const auto& meshAfterLoad = mgttScene.nodes[0].mesh;
   ASSERT_NE(meshAfterLoad, nullptr);
   // CPU-side data is populated
   EXPECT_FALSE(meshAfterLoad->vertexPositionAttribs.empty());
@@ -169,7 +169,7 @@ TEST_F(UsdSceneImporterTest, LoadValidUsdFile) {
   const auto uploadResult = sceneUploader->Upload(mgttScene);
   ASSERT_TRUE(uploadResult.ok()) << "Upload failed: " << uploadResult.error();
 
-  const auto& meshAfterUpload = mgttScene.nodes[0]->mesh;
+  const auto& meshAfterUpload = mgttScene.nodes[0].mesh;
   EXPECT_GT(meshAfterUpload->vao, 0u);
   EXPECT_GT(meshAfterUpload->pos, 0u);
   EXPECT_GT(meshAfterUpload->normal, 0u);
@@ -0,0 +1,133 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <vertex-packing.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class VertexPackingTest : public ::testing::Test {
+ protected:
+  /**
+   * @brief Decode a signed normalized 10-bit field the way GL does.
+   */
+  static float UnpackSnorm10(uint32_t packed, uint32_t shift) {
+    auto value = static_cast<int32_t>((packed >> shift) & 0x3FFu);
+    if (value >= 512) {
+      value -= 1024;
+    }
+    return std::max(static_cast<float>(value) / 511.0f, -1.0f);
+  }
+};
+
+TEST_F(VertexPackingTest, FloatToHalf) {
+  RecordProperty("Test Description",
+                 "Convert representative floats to half precision");
+  RecordProperty("Expected Result",
+                 "Bit patterns match IEEE 754 binary16, overflow is infinity");
+
+  EXPECT_EQ(FloatToHalf(0.0f), 0x0000u);
+  EXPECT_EQ(FloatToHalf(-0.0f), 0x8000u);
+  EXPECT_EQ(FloatToHalf(1.0f), 0x3C00u);
+  EXPECT_EQ(FloatToHalf(0.5f), 0x3800u);
+  EXPECT_EQ(FloatToHalf(-2.0f), 0xC000u);
+  EXPECT_EQ(FloatToHalf(65504.0f), 0x7BFFu);
+  EXPECT_EQ(FloatToHalf(1.0e6f), 0x7C00u);
+  EXPECT_EQ(FloatToHalf(-std::numeric_limits<float>::infinity()), 0xFC00u);
+  // Smallest subnormal half and a value that rounds to it
+  EXPECT_EQ(FloatToHalf(5.9604645e-8f), 0x0001u);
+  EXPECT_EQ(FloatToHalf(std::numeric_limits<float>::quiet_NaN()) & 0x7C00u,
+            0x7C00u);
+}
+
+TEST_F(VertexPackingTest, PackNormal) {
+  RecordProperty("Test Description",
+                 "Pack axis-aligned unit vectors into 2_10_10_10 values");
+  RecordProperty("Expected Result",
+                 "Each component lands in its 10-bit field, w holds the "
+                 "tangent sign");
+
+  EXPECT_EQ(PackNormal(glm::vec3(1.0f, 0.0f, 0.0f)), 0x000001FFu);
+  EXPECT_EQ(PackNormal(glm::vec3(0.0f, 1.0f, 0.0f)), 0x0007FC00u);
+  EXPECT_EQ(PackNormal(glm::vec3(0.0f, 0.0f, -1.0f)), 0x20100000u);
+  EXPECT_EQ(PackNormal(glm::vec3(0.0f, 0.0f, 1.0f)) >> 30, 0u);
+
+  // Tangents carry the bitangent sign in the 2-bit w field
+  EXPECT_EQ(PackTangent(glm::vec4(1.0f, 0.0f, 0.0f, 1.0f)), 0x400001FFu);
+  EXPECT_EQ(PackTangent(glm::vec4(1.0f, 0.0f, 0.0f, -1.0f)), 0xC00001FFu);
+  EXPECT_EQ(PackTangent(glm::vec4(1.0f, 0.0f, 0.0f, 0.0f)), 0x000001FFu);
+}
+
+TEST_F(VertexPackingTest, PackVerticesRoundTrip) {
+  RecordProperty("Test Description",
+                 "Pack a mesh that is flat along z and restore its attributes");
+  RecordProperty("Expected Result",
+                 "Restored attributes are within quantization tolerance");
+
+  Mgtt::Rendering::Mesh mesh;
+  mesh.vertexPositionAttribs = {
+      {-4.0f, 10.0f, 2.5f}, {6.0f, 12.0f, 2.5f}, {1.25f, 11.0f, 2.5f}};
+  mesh.vertexNormalAttribs = {
+      {0.0f, 0.0f, 1.0f}, {0.6f, 0.8f, 0.0f}, {-0.48f, 0.6f, -0.64f}};
+  mesh.vertexTextureAttribs = {{0.0f, 1.0f}, {0.5f, 0.25f}};
+  mesh.vertexTangentAttribs = {{1.0f, 0.0f, 0.0f, -1.0f}};
+
+  glm::vec3 offset(0.0f);
+  glm::vec3 scale(0.0f);
+  const auto kPacked = PackVertices(mesh, offset, scale);
+  ASSERT_EQ(kPacked.size(), 3u);
+  EXPECT_EQ(offset, glm::vec3(1.0f, 11.0f, 2.5f));
+  EXPECT_EQ(scale, glm::vec3(5.0f, 1.0f, 0.0f));
+
+  for (size_t idx = 0; idx < kPacked.size(); ++idx) {
+    const auto& vertex = kPacked[idx];
+    for (int axis = 0; axis < 3; ++axis) {
+      const float kRestored =
+          offset[axis] +
+          static_cast<float>(vertex.position[axis]) / 32767.0f * scale[axis];
+      EXPECT_NEAR(kRestored, mesh.vertexPositionAttribs[idx][axis], 1.0e-3f);
+    }
+    const glm::vec3 kNormal(UnpackSnorm10(vertex.normal, 0),
+                            UnpackSnorm10(vertex.normal, 10),
+                            UnpackSnorm10(vertex.normal, 20));
+    EXPECT_NEAR(glm::length(kNormal - mesh.vertexNormalAttribs[idx]), 0.0f,
+                5.0e-3f);
+  }
+
+  EXPECT_EQ(kPacked[0].textureCoordinates[1], 0x3C00u);
+  EXPECT_EQ(kPacked[1].textureCoordinates[0], 0x3800u);
+  EXPECT_EQ(kPacked[1].textureCoordinates[1], 0x3400u);
+  // Missing texture coordinates are packed as zero
+  EXPECT_EQ(kPacked[2].textureCoordinates[0], 0u);
+  EXPECT_EQ(kPacked[2].textureCoordinates[1], 0u);
+  EXPECT_EQ(kPacked[0].tangent, 0xC00001FFu);
+  EXPECT_EQ(kPacked[1].tangent, 0u);
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
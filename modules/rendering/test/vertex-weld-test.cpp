@@ -0,0 +1,132 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <vertex-weld.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class VertexWeldTest : public ::testing::Test {
+ protected:
+  /**
+   * @brief Quad stored as two triangles with six unshared vertices.
+   */
+  static void BuildUnsharedQuad(Mgtt::Rendering::Mesh& mesh) {
+    mesh.vertexPositionAttribs = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f},
+                                  {1.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 0.0f},
+                                  {1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    mesh.vertexNormalAttribs.assign(6, glm::vec3(0.0f, 0.0f, 1.0f));
+    mesh.vertexTextureAttribs = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f},
+                                 {0.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+    mesh.indices = {0, 1, 2, 3, 4, 5};
+    mesh.meshPrimitives.resize(1);
+    mesh.meshPrimitives[0].indexCount = 6;
+    mesh.meshPrimitives[0].vertexCount = 6;
+    mesh.meshPrimitives[0].hasIndices = true;
+  }
+};
+
+TEST_F(VertexWeldTest, WeldExactDuplicates) {
+  RecordProperty("Test Description",
+                 "Weld a quad whose triangles do not share vertices");
+  RecordProperty("Expected Result",
+                 "2 vertices removed, indices rebuilt, order kept");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildUnsharedQuad(mesh);
+
+  const auto kResult = WeldVertices(mesh);
+  ASSERT_TRUE(kResult.ok()) << kResult.error();
+  EXPECT_EQ(kResult.value(), 2u);
+  EXPECT_EQ(mesh.indices, (std::vector<uint32_t>{0, 1, 2, 0, 2, 3}));
+  ASSERT_EQ(mesh.vertexPositionAttribs.size(), 4u);
+  EXPECT_EQ(mesh.vertexNormalAttribs.size(), 4u);
+  EXPECT_EQ(mesh.vertexTextureAttribs.size(), 4u);
+  EXPECT_EQ(mesh.vertexPositionAttribs[3], glm::vec3(0.0f, 1.0f, 0.0f));
+  EXPECT_EQ(mesh.vertexTextureAttribs[3], glm::vec2(0.0f, 1.0f));
+  EXPECT_EQ(mesh.meshPrimitives[0].vertexCount, 4u);
+}
+
+TEST_F(VertexWeldTest, WeldWithinEpsilon) {
+  RecordProperty("Test Description",
+                 "Weld near duplicates, one pair straddling a hash cell");
+  RecordProperty("Expected Result",
+                 "Nothing merged without epsilon, 2 removed with it");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildUnsharedQuad(mesh);
+  // 0.00999 and 0.01001 fall into different cells of size 0.01
+  mesh.vertexPositionAttribs[0].x = 0.00999f;
+  mesh.vertexPositionAttribs[3].x = 0.01001f;
+  mesh.vertexPositionAttribs[4].y += 1.0e-4f;
+
+  auto result = WeldVertices(mesh);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(result.value(), 0u);
+  EXPECT_EQ(mesh.vertexPositionAttribs.size(), 6u);
+
+  result = WeldVertices(mesh, 0.01f);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(result.value(), 2u);
+  EXPECT_EQ(mesh.indices, (std::vector<uint32_t>{0, 1, 2, 0, 2, 3}));
+}
+
+TEST_F(VertexWeldTest, KeepHardEdges) {
+  RecordProperty("Test Description",
+                 "Weld vertices sharing a position but not a normal");
+  RecordProperty("Expected Result", "No vertex is removed");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildUnsharedQuad(mesh);
+  mesh.vertexNormalAttribs[3] = glm::vec3(1.0f, 0.0f, 0.0f);
+  mesh.vertexNormalAttribs[4] = glm::vec3(1.0f, 0.0f, 0.0f);
+
+  const auto kResult = WeldVertices(mesh, 0.01f);
+  ASSERT_TRUE(kResult.ok());
+  EXPECT_EQ(kResult.value(), 0u);
+  EXPECT_EQ(mesh.indices, (std::vector<uint32_t>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST_F(VertexWeldTest, RejectMalformedMesh) {
+  RecordProperty("Test Description",
+                 "Weld meshes with a short attribute array or a bad index");
+  RecordProperty("Expected Result", "Result::err() is true, mesh untouched");
+
+  Mgtt::Rendering::Mesh mesh;
+  BuildUnsharedQuad(mesh);
+  mesh.vertexTextureAttribs.pop_back();
+  EXPECT_TRUE(WeldVertices(mesh).err());
+  EXPECT_EQ(mesh.vertexPositionAttribs.size(), 6u);
+
+  Mgtt::Rendering::Mesh badIndex;
+  BuildUnsharedQuad(badIndex);
+  badIndex.indices[5] = 6;
+  EXPECT_TRUE(WeldVertices(badIndex).err());
+  EXPECT_EQ(badIndex.vertexPositionAttribs.size(), 6u);
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif
@@ -0,0 +1,97 @@
+// The MIT License
+//
+// Copyright (c) 2026 MGTheTrain
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef MGTT_RENDERING_TEST
+#include <gtest/gtest.h>
+#include <worker-pool.h>
+
+#include <atomic>
+#include <vector>
+
+namespace Mgtt::Rendering::Test {
+
+class WorkerPoolTest : public ::testing::Test {
+ protected:
+  /**
+   * @brief Whether every counter was incremented exactly once.
+   */
+  static bool VisitedOnce(const std::vector<std::atomic<uint32_t>>& visits) {
+    for (const auto& visit : visits) {
+      if (visit.load() != 1) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+TEST_F(WorkerPoolTest, ParallelForVisitsEveryIndex) {
+  RecordProperty("Test Description",
+                 "ParallelFor calls fn once per index for any thread count");
+  RecordProperty("Expected Result",
+                 "Every index below count is visited exactly once");
+
+  for (const uint32_t kThreads : {0u, 1u, 3u, 16u}) {
+    for (const size_t kCount : {size_t{0}, size_t{1}, size_t{5}, size_t{999}}) {
+      std::vector<std::atomic<uint32_t>> visits(kCount);
+      ParallelFor(kCount, kThreads, [&](size_t idx) { ++visits[idx]; });
+      EXPECT_TRUE(VisitedOnce(visits))
+          << kThreads << " threads, " << kCount << " items";
+    }
+  }
+}
+
+TEST_F(WorkerPoolTest, PoolRunsRepeatedLoops) {
+  RecordProperty("Test Description",
+                 "A pool runs many consecutive loops on the same threads");
+  RecordProperty("Expected Result",
+                 "Every loop visits each of its indices exactly once");
+
+  WorkerPool pool;
+  pool.SetThreadCount(4);
+  EXPECT_EQ(pool.GetThreadCount(), 4u);
+  for (size_t loop = 0; loop < 500; ++loop) {
+    const size_t kCount = loop % 37;
+    std::vector<std::atomic<uint32_t>> visits(kCount);
+    pool.ParallelFor(kCount, [&](size_t idx) { ++visits[idx]; });
+    ASSERT_TRUE(VisitedOnce(visits)) << "loop " << loop;
+  }
+}
+
+TEST_F(WorkerPoolTest, PoolChangesThreadCount) {
+  RecordProperty("Test Description",
+                 "SetThreadCount restarts the pool between loops");
+  RecordProperty("Expected Result",
+                 "Loops stay complete before and after every change");
+
+  WorkerPool pool;
+  EXPECT_EQ(pool.GetThreadCount(), 1u);
+  for (const uint32_t kThreads : {3u, 1u, 0u, 8u, 2u}) {
+    pool.SetThreadCount(kThreads);
+    std::vector<std::atomic<uint32_t>> visits(257);
+    pool.ParallelFor(visits.size(), [&](size_t idx) { ++visits[idx]; });
+    EXPECT_TRUE(VisitedOnce(visits)) << kThreads << " threads";
+  }
+}
+
+}  // namespace Mgtt::Rendering::Test
+#endif